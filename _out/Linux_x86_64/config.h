@@ -0,0 +1,4 @@
+#define INSTALLER_OS "Linux"
+#define INSTALLER_ARCH "x86_64"
+#define NVIDIA_INSTALLER_VERSION "460.32.03"
+#define PROGRAM_NAME "nvidia-installer"
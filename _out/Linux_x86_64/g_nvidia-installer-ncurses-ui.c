@@ -0,0 +1,2604 @@
+/*
+ * THIS FILE IS AUTOMATICALLY GENERATED - DO NOT EDIT
+ *
+ * This file contains the contents of the file "_out/Linux_x86_64/nvidia-installer-ncurses-ui.so"
+ * as the byte array ncurses_ui_array[].
+ */
+
+const int ncurses_ui_array_size = 31096;
+
+const unsigned char ncurses_ui_array[31096] = {
+    0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x09, 0x00, 0x40, 0x00, 
+    0x1c, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x0d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x31, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x39, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0xd8, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xd8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe8, 0x5d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xe5, 0x74, 0x64, 0x04, 0x00, 0x00, 0x00, 
+    0xf0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x51, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x51, 0xe5, 0x74, 0x64, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xe5, 0x74, 0x64, 
+    0x04, 0x00, 0x00, 0x00, 0xd8, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x47, 0x4e, 0x55, 0x00, 0xea, 0x9d, 0x9e, 0x49, 
+    0x51, 0xdc, 0xd0, 0xe0, 0x60, 0x50, 0x8f, 0x56, 0xf0, 0xfc, 0xc9, 0x31, 
+    0x97, 0x8c, 0xbb, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x26, 0x00, 0x00, 0x00, 0x59, 0xd7, 0x97, 0x10, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xea, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x5d, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x77, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x6b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x90, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xda, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1e, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xc5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xcc, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xa7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x98, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x80, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xb7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf5, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2c, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xbe, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x42, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x89, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x55, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x55, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4b, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xb0, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x2c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xa0, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x64, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x5b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x46, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x34, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x25, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x65, 0x01, 0x00, 0x00, 0x11, 0x00, 0x16, 0x00, 0x40, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x5f, 0x5f, 0x67, 0x6d, 0x6f, 0x6e, 0x5f, 0x73, 0x74, 0x61, 0x72, 
+    0x74, 0x5f, 0x5f, 0x00, 0x5f, 0x49, 0x54, 0x4d, 0x5f, 0x64, 0x65, 0x72, 
+    0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x54, 0x4d, 0x43, 0x6c, 0x6f, 
+    0x6e, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x5f, 0x49, 0x54, 0x4d, 
+    0x5f, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x54, 0x4d, 0x43, 
+    0x6c, 0x6f, 0x6e, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x5f, 0x5f, 
+    0x63, 0x78, 0x61, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x65, 
+    0x00, 0x77, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x77, 0x61, 0x64, 0x64, 0x6e, 
+    0x73, 0x74, 0x72, 0x00, 0x73, 0x74, 0x72, 0x64, 0x75, 0x70, 0x00, 0x66, 
+    0x72, 0x65, 0x65, 0x00, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x00, 0x77, 
+    0x61, 0x74, 0x74, 0x72, 0x73, 0x65, 0x74, 0x00, 0x77, 0x72, 0x65, 0x66, 
+    0x72, 0x65, 0x73, 0x68, 0x00, 0x6d, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x00, 
+    0x73, 0x74, 0x72, 0x6e, 0x63, 0x70, 0x79, 0x00, 0x69, 0x6e, 0x69, 0x74, 
+    0x73, 0x63, 0x72, 0x00, 0x65, 0x6e, 0x64, 0x77, 0x69, 0x6e, 0x00, 0x73, 
+    0x6e, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x00, 0x77, 0x61, 0x64, 0x64, 
+    0x63, 0x68, 0x00, 0x6d, 0x65, 0x6d, 0x73, 0x65, 0x74, 0x00, 0x63, 0x61, 
+    0x6c, 0x6c, 0x6f, 0x63, 0x00, 0x77, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x00, 
+    0x6e, 0x6f, 0x65, 0x63, 0x68, 0x6f, 0x00, 0x63, 0x62, 0x72, 0x65, 0x61, 
+    0x6b, 0x00, 0x63, 0x75, 0x72, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x00, 0x6b, 
+    0x65, 0x79, 0x70, 0x61, 0x64, 0x00, 0x68, 0x61, 0x73, 0x5f, 0x63, 0x6f, 
+    0x6c, 0x6f, 0x72, 0x73, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5f, 0x63, 
+    0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x69, 0x6e, 0x69, 0x74, 0x5f, 0x70, 0x61, 
+    0x69, 0x72, 0x00, 0x77, 0x61, 0x74, 0x74, 0x72, 0x5f, 0x6f, 0x6e, 0x00, 
+    0x77, 0x61, 0x74, 0x74, 0x72, 0x5f, 0x6f, 0x66, 0x66, 0x00, 0x77, 0x67, 
+    0x65, 0x74, 0x63, 0x68, 0x00, 0x75, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x00, 
+    0x73, 0x74, 0x72, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x5f, 0x5f, 0x63, 0x74, 
+    0x79, 0x70, 0x65, 0x5f, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 0x00, 0x6d, 0x76, 
+    0x70, 0x72, 0x69, 0x6e, 0x74, 0x77, 0x00, 0x77, 0x63, 0x6c, 0x72, 0x74, 
+    0x6f, 0x65, 0x6f, 0x6c, 0x00, 0x6d, 0x65, 0x6d, 0x6d, 0x6f, 0x76, 0x65, 
+    0x00, 0x6e, 0x6f, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x00, 0x75, 0x69, 0x5f, 
+    0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x74, 0x61, 0x62, 
+    0x6c, 0x65, 0x00, 0x6c, 0x69, 0x62, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 
+    0x73, 0x2e, 0x73, 0x6f, 0x2e, 0x36, 0x00, 0x6c, 0x69, 0x62, 0x74, 0x69, 
+    0x6e, 0x66, 0x6f, 0x2e, 0x73, 0x6f, 0x2e, 0x36, 0x00, 0x6c, 0x69, 0x62, 
+    0x63, 0x2e, 0x73, 0x6f, 0x2e, 0x36, 0x00, 0x47, 0x4c, 0x49, 0x42, 0x43, 
+    0x5f, 0x32, 0x2e, 0x33, 0x00, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 
+    0x2e, 0x32, 0x2e, 0x35, 0x00, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 
+    0x36, 0x5f, 0x54, 0x49, 0x4e, 0x46, 0x4f, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 
+    0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x4e, 0x43, 0x55, 
+    0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 
+    0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+    0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x03, 0x00, 
+    0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 
+    0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 
+    0x04, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 
+    0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 
+    0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x95, 0x01, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x13, 0x69, 0x69, 0x0d, 
+    0x00, 0x00, 0x05, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+    0x75, 0x1a, 0x69, 0x09, 0x00, 0x00, 0x04, 0x00, 0xa9, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x87, 0x01, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x4d, 0x57, 0x00, 
+    0x00, 0x00, 0x03, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x01, 0x00, 0x77, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x53, 0xa6, 0xda, 0x04, 0x00, 0x00, 0x02, 0x00, 
+    0xd1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x6d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xc0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x60, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xc0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xa0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xc0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x60, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xa0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x40, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x6f, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x6f, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6f, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x6f, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x05, 0xc5, 
+    0x5f, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 0x02, 0xff, 0xd0, 0x48, 0x83, 
+    0xc4, 0x08, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xff, 0x35, 0xca, 0x5f, 0x00, 0x00, 0xff, 0x25, 0xcc, 0x5f, 0x00, 0x00, 
+    0x0f, 0x1f, 0x40, 0x00, 0xff, 0x25, 0xca, 0x5f, 0x00, 0x00, 0x68, 0x00, 
+    0x00, 0x00, 0x00, 0xe9, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x25, 0xc2, 0x5f, 
+    0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x00, 0xe9, 0xd0, 0xff, 0xff, 0xff, 
+    0xff, 0x25, 0xba, 0x5f, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x00, 0xe9, 
+    0xc0, 0xff, 0xff, 0xff, 0xff, 0x25, 0xb2, 0x5f, 0x00, 0x00, 0x68, 0x03, 
+    0x00, 0x00, 0x00, 0xe9, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x25, 0xaa, 0x5f, 
+    0x00, 0x00, 0x68, 0x04, 0x00, 0x00, 0x00, 0xe9, 0xa0, 0xff, 0xff, 0xff, 
+    0xff, 0x25, 0xa2, 0x5f, 0x00, 0x00, 0x68, 0x05, 0x00, 0x00, 0x00, 0xe9, 
+    0x90, 0xff, 0xff, 0xff, 0xff, 0x25, 0x9a, 0x5f, 0x00, 0x00, 0x68, 0x06, 
+    0x00, 0x00, 0x00, 0xe9, 0x80, 0xff, 0xff, 0xff, 0xff, 0x25, 0x92, 0x5f, 
+    0x00, 0x00, 0x68, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x70, 0xff, 0xff, 0xff, 
+    0xff, 0x25, 0x8a, 0x5f, 0x00, 0x00, 0x68, 0x08, 0x00, 0x00, 0x00, 0xe9, 
+    0x60, 0xff, 0xff, 0xff, 0xff, 0x25, 0x82, 0x5f, 0x00, 0x00, 0x68, 0x09, 
+    0x00, 0x00, 0x00, 0xe9, 0x50, 0xff, 0xff, 0xff, 0xff, 0x25, 0x7a, 0x5f, 
+    0x00, 0x00, 0x68, 0x0a, 0x00, 0x00, 0x00, 0xe9, 0x40, 0xff, 0xff, 0xff, 
+    0xff, 0x25, 0x72, 0x5f, 0x00, 0x00, 0x68, 0x0b, 0x00, 0x00, 0x00, 0xe9, 
+    0x30, 0xff, 0xff, 0xff, 0xff, 0x25, 0x6a, 0x5f, 0x00, 0x00, 0x68, 0x0c, 
+    0x00, 0x00, 0x00, 0xe9, 0x20, 0xff, 0xff, 0xff, 0xff, 0x25, 0x62, 0x5f, 
+    0x00, 0x00, 0x68, 0x0d, 0x00, 0x00, 0x00, 0xe9, 0x10, 0xff, 0xff, 0xff, 
+    0xff, 0x25, 0x5a, 0x5f, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x00, 0xe9, 
+    0x00, 0xff, 0xff, 0xff, 0xff, 0x25, 0x52, 0x5f, 0x00, 0x00, 0x68, 0x0f, 
+    0x00, 0x00, 0x00, 0xe9, 0xf0, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x4a, 0x5f, 
+    0x00, 0x00, 0x68, 0x10, 0x00, 0x00, 0x00, 0xe9, 0xe0, 0xfe, 0xff, 0xff, 
+    0xff, 0x25, 0x42, 0x5f, 0x00, 0x00, 0x68, 0x11, 0x00, 0x00, 0x00, 0xe9, 
+    0xd0, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x3a, 0x5f, 0x00, 0x00, 0x68, 0x12, 
+    0x00, 0x00, 0x00, 0xe9, 0xc0, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x32, 0x5f, 
+    0x00, 0x00, 0x68, 0x13, 0x00, 0x00, 0x00, 0xe9, 0xb0, 0xfe, 0xff, 0xff, 
+    0xff, 0x25, 0x2a, 0x5f, 0x00, 0x00, 0x68, 0x14, 0x00, 0x00, 0x00, 0xe9, 
+    0xa0, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x22, 0x5f, 0x00, 0x00, 0x68, 0x15, 
+    0x00, 0x00, 0x00, 0xe9, 0x90, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x1a, 0x5f, 
+    0x00, 0x00, 0x68, 0x16, 0x00, 0x00, 0x00, 0xe9, 0x80, 0xfe, 0xff, 0xff, 
+    0xff, 0x25, 0x12, 0x5f, 0x00, 0x00, 0x68, 0x17, 0x00, 0x00, 0x00, 0xe9, 
+    0x70, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x0a, 0x5f, 0x00, 0x00, 0x68, 0x18, 
+    0x00, 0x00, 0x00, 0xe9, 0x60, 0xfe, 0xff, 0xff, 0xff, 0x25, 0x02, 0x5f, 
+    0x00, 0x00, 0x68, 0x19, 0x00, 0x00, 0x00, 0xe9, 0x50, 0xfe, 0xff, 0xff, 
+    0xff, 0x25, 0xfa, 0x5e, 0x00, 0x00, 0x68, 0x1a, 0x00, 0x00, 0x00, 0xe9, 
+    0x40, 0xfe, 0xff, 0xff, 0xff, 0x25, 0xf2, 0x5e, 0x00, 0x00, 0x68, 0x1b, 
+    0x00, 0x00, 0x00, 0xe9, 0x30, 0xfe, 0xff, 0xff, 0xff, 0x25, 0xea, 0x5e, 
+    0x00, 0x00, 0x68, 0x1c, 0x00, 0x00, 0x00, 0xe9, 0x20, 0xfe, 0xff, 0xff, 
+    0xff, 0x25, 0xe2, 0x5e, 0x00, 0x00, 0x68, 0x1d, 0x00, 0x00, 0x00, 0xe9, 
+    0x10, 0xfe, 0xff, 0xff, 0xff, 0x25, 0xda, 0x5e, 0x00, 0x00, 0x68, 0x1e, 
+    0x00, 0x00, 0x00, 0xe9, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x25, 0xd2, 0x5e, 
+    0x00, 0x00, 0x68, 0x1f, 0x00, 0x00, 0x00, 0xe9, 0xf0, 0xfd, 0xff, 0xff, 
+    0xff, 0x25, 0xca, 0x5e, 0x00, 0x00, 0x68, 0x20, 0x00, 0x00, 0x00, 0xe9, 
+    0xe0, 0xfd, 0xff, 0xff, 0xff, 0x25, 0x9a, 0x5d, 0x00, 0x00, 0x66, 0x90, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0x59, 
+    0x5f, 0x00, 0x00, 0x48, 0x8d, 0x05, 0x52, 0x5f, 0x00, 0x00, 0x48, 0x39, 
+    0xf8, 0x74, 0x15, 0x48, 0x8b, 0x05, 0x5e, 0x5d, 0x00, 0x00, 0x48, 0x85, 
+    0xc0, 0x74, 0x09, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+    0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0x29, 
+    0x5f, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x22, 0x5f, 0x00, 0x00, 0x48, 0x29, 
+    0xfe, 0x48, 0x89, 0xf0, 0x48, 0xc1, 0xee, 0x3f, 0x48, 0xc1, 0xf8, 0x03, 
+    0x48, 0x01, 0xc6, 0x48, 0xd1, 0xfe, 0x74, 0x14, 0x48, 0x8b, 0x05, 0x2d, 
+    0x5d, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 0x08, 0xff, 0xe0, 0x66, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+    0xf3, 0x0f, 0x1e, 0xfa, 0x80, 0x3d, 0xe5, 0x5e, 0x00, 0x00, 0x00, 0x75, 
+    0x2b, 0x55, 0x48, 0x83, 0x3d, 0x0a, 0x5d, 0x00, 0x00, 0x00, 0x48, 0x89, 
+    0xe5, 0x74, 0x0c, 0x48, 0x8b, 0x3d, 0x3e, 0x5e, 0x00, 0x00, 0xe8, 0x59, 
+    0xff, 0xff, 0xff, 0xe8, 0x64, 0xff, 0xff, 0xff, 0xc6, 0x05, 0xbd, 0x5e, 
+    0x00, 0x00, 0x01, 0x5d, 0xc3, 0x0f, 0x1f, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 
+    0x00, 0x00, 0x00, 0x00, 0xf3, 0x0f, 0x1e, 0xfa, 0xe9, 0x77, 0xff, 0xff, 
+    0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x66, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x40, 0x00, 
+    0x55, 0x48, 0x89, 0xe5, 0x41, 0x54, 0x53, 0x8b, 0x47, 0x0c, 0x8b, 0x5f, 
+    0x04, 0x85, 0xc0, 0x7e, 0x45, 0x49, 0x89, 0xfc, 0x0f, 0x1f, 0x40, 0x00, 
+    0x41, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x3d, 0x75, 0x5e, 0x00, 0x00, 0x89, 
+    0xde, 0xe8, 0x66, 0xfe, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x16, 0x49, 
+    0x8b, 0x74, 0x24, 0x18, 0x48, 0x8b, 0x3d, 0x5d, 0x5e, 0x00, 0x00, 0xba, 
+    0xff, 0xff, 0xff, 0xff, 0xe8, 0x9b, 0xfe, 0xff, 0xff, 0x41, 0x8b, 0x44, 
+    0x24, 0x0c, 0x83, 0xc3, 0x01, 0x41, 0x03, 0x44, 0x24, 0x04, 0x39, 0xd8, 
+    0x7f, 0xc2, 0x5b, 0x41, 0x5c, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x55, 0x48, 0x89, 0xe5, 0x41, 0x55, 0x41, 0x54, 0x53, 0x48, 0x89, 0xfb, 
+    0x48, 0x89, 0xf7, 0x48, 0x83, 0xec, 0x08, 0xe8, 0x58, 0xfe, 0xff, 0xff, 
+    0x48, 0x8b, 0x7b, 0x30, 0x49, 0x89, 0xc4, 0x48, 0x85, 0xff, 0x74, 0x05, 
+    0xe8, 0xb7, 0xfc, 0xff, 0xff, 0x4c, 0x89, 0x63, 0x30, 0x4c, 0x8b, 0x2b, 
+    0x4c, 0x89, 0xe7, 0xe8, 0xf8, 0xfc, 0xff, 0xff, 0x41, 0x8b, 0x75, 0x10, 
+    0x4d, 0x63, 0x65, 0x08, 0x48, 0x8b, 0x3d, 0xf1, 0x5d, 0x00, 0x00, 0x49, 
+    0x29, 0xc4, 0xe8, 0x81, 0xfc, 0xff, 0xff, 0x48, 0x8b, 0x3b, 0x49, 0xd1, 
+    0xec, 0xe8, 0x46, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x03, 0x48, 0x8b, 0x3d, 
+    0xd4, 0x5d, 0x00, 0x00, 0x8b, 0x10, 0x8b, 0x70, 0x04, 0x44, 0x01, 0xe2, 
+    0xe8, 0xbf, 0xfd, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x15, 0x48, 0x8b, 
+    0x73, 0x30, 0x48, 0x8b, 0x3d, 0xb7, 0x5d, 0x00, 0x00, 0xba, 0xff, 0xff, 
+    0xff, 0xff, 0xe8, 0xf5, 0xfd, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0xa6, 0x5d, 
+    0x00, 0x00, 0x48, 0x83, 0xc4, 0x08, 0x31, 0xf6, 0x5b, 0x41, 0x5c, 0x41, 
+    0x5d, 0x5d, 0xe9, 0x2d, 0xfc, 0xff, 0xff, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 
+    0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90, 0x55, 0x48, 0x8b, 0xbf, 
+    0xb8, 0x04, 0x00, 0x00, 0x48, 0x89, 0xe5, 0xe8, 0x40, 0xff, 0xff, 0xff, 
+    0x48, 0x8b, 0x3d, 0x71, 0x5d, 0x00, 0x00, 0x5d, 0xe9, 0xa3, 0xfc, 0xff, 
+    0xff, 0x0f, 0x1f, 0x00, 0x55, 0x48, 0x89, 0xe5, 0x41, 0x55, 0x41, 0x54, 
+    0x49, 0x89, 0xd4, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x89, 0xf7, 0x48, 0x83, 
+    0xec, 0x08, 0xe8, 0x85, 0xfd, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0x49, 0x89, 
+    0xc5, 0xe8, 0x7a, 0xfd, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x38, 0x49, 0x89, 
+    0xc4, 0x48, 0x85, 0xff, 0x74, 0x05, 0xe8, 0xd9, 0xfb, 0xff, 0xff, 0x48, 
+    0x8b, 0x7b, 0x40, 0x48, 0x85, 0xff, 0x74, 0x05, 0xe8, 0xcb, 0xfb, 0xff, 
+    0xff, 0x48, 0x8b, 0x43, 0x08, 0x4c, 0x89, 0x6b, 0x38, 0x4c, 0x89, 0x63, 
+    0x40, 0x48, 0x8b, 0x3d, 0x10, 0x5d, 0x00, 0x00, 0x8b, 0x70, 0x10, 0xe8, 
+    0xa0, 0xfb, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x08, 0xe8, 0x67, 0xfe, 0xff, 
+    0xff, 0x48, 0x83, 0x7b, 0x38, 0x00, 0x74, 0x1d, 0x48, 0x8b, 0x43, 0x08, 
+    0x48, 0x8b, 0x3d, 0xed, 0x5c, 0x00, 0x00, 0x8b, 0x08, 0x8b, 0x70, 0x04, 
+    0x8d, 0x51, 0x01, 0xe8, 0xd8, 0xfc, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x75, 
+    0x73, 0x48, 0x8b, 0x7b, 0x40, 0x4c, 0x8b, 0x25, 0xd0, 0x5c, 0x00, 0x00, 
+    0x48, 0x85, 0xff, 0x74, 0x2d, 0xe8, 0xbe, 0xfb, 0xff, 0xff, 0x4c, 0x8b, 
+    0x6b, 0x08, 0x4c, 0x89, 0xe7, 0x89, 0xc2, 0x41, 0x8b, 0x75, 0x04, 0xf7, 
+    0xd2, 0x41, 0x03, 0x55, 0x08, 0x41, 0x03, 0x55, 0x00, 0xe8, 0xa2, 0xfc, 
+    0xff, 0xff, 0x4c, 0x8b, 0x25, 0xa3, 0x5c, 0x00, 0x00, 0x83, 0xf8, 0xff, 
+    0x75, 0x16, 0x48, 0x83, 0xc4, 0x08, 0x4c, 0x89, 0xe7, 0x31, 0xf6, 0x5b, 
+    0x41, 0x5c, 0x41, 0x5d, 0x5d, 0xe9, 0x22, 0xfb, 0xff, 0xff, 0x66, 0x90, 
+    0x48, 0x8b, 0x73, 0x40, 0x4c, 0x89, 0xe7, 0xba, 0xff, 0xff, 0xff, 0xff, 
+    0xe8, 0xbf, 0xfc, 0xff, 0xff, 0x4c, 0x8b, 0x25, 0x70, 0x5c, 0x00, 0x00, 
+    0xeb, 0xd0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x73, 0x38, 
+    0x48, 0x8b, 0x3d, 0x5d, 0x5c, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 
+    0xe8, 0x9b, 0xfc, 0xff, 0xff, 0xe9, 0x73, 0xff, 0xff, 0xff, 0x66, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x55, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x41, 0x56, 
+    0x49, 0x89, 0xf6, 0x41, 0x55, 0x41, 0x89, 0xd5, 0x41, 0x54, 0x4c, 0x63, 
+    0xe1, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x47, 
+    0x10, 0x48, 0x8b, 0x3d, 0x20, 0x5c, 0x00, 0x00, 0x8b, 0x70, 0x10, 0xe8, 
+    0xb0, 0xfa, 0xff, 0xff, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0x0d, 
+    0x5c, 0x00, 0x00, 0x8b, 0x70, 0x04, 0x8b, 0x10, 0x44, 0x01, 0xee, 0xe8, 
+    0xf8, 0xfb, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x19, 0x48, 0x8b, 0x43, 
+    0x10, 0x48, 0x8b, 0x3d, 0xf0, 0x5b, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 
+    0xff, 0x48, 0x8b, 0x70, 0x18, 0xe8, 0x2a, 0xfc, 0xff, 0xff, 0x4d, 0x85, 
+    0xf6, 0x74, 0x75, 0x41, 0x8d, 0x7c, 0x24, 0x01, 0x48, 0x63, 0xff, 0xe8, 
+    0xa8, 0xfb, 0xff, 0xff, 0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xf6, 0x48, 0x89, 
+    0xc7, 0x49, 0x89, 0xc7, 0xe8, 0x77, 0xfa, 0xff, 0xff, 0x48, 0x8b, 0x43, 
+    0x10, 0x43, 0xc6, 0x04, 0x27, 0x00, 0x48, 0x8b, 0x3d, 0xaf, 0x5b, 0x00, 
+    0x00, 0x8b, 0x08, 0x8b, 0x70, 0x04, 0x8d, 0x51, 0x01, 0x44, 0x01, 0xee, 
+    0xe8, 0x97, 0xfb, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x75, 0x1a, 0x48, 0x83, 
+    0xc4, 0x08, 0x4c, 0x89, 0xff, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 
+    0x41, 0x5f, 0x5d, 0xe9, 0x2c, 0xfa, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+    0x48, 0x8b, 0x3d, 0x79, 0x5b, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 
+    0x4c, 0x89, 0xfe, 0xe8, 0xb4, 0xfb, 0xff, 0xff, 0xeb, 0xd0, 0x66, 0x90, 
+    0x48, 0x83, 0xc4, 0x08, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 
+    0x5f, 0x5d, 0xc3, 0x90, 0x55, 0x48, 0x89, 0xe5, 0xe8, 0x77, 0xfa, 0xff, 
+    0xff, 0x48, 0x89, 0x05, 0x48, 0x5b, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 
+    0x20, 0x66, 0x83, 0x78, 0x06, 0x26, 0x7e, 0x14, 0x66, 0x83, 0x78, 0x04, 
+    0x08, 0xba, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x08, 0x89, 0xd0, 0x5d, 0xc3, 
+    0x0f, 0x1f, 0x40, 0x00, 0xe8, 0x4b, 0xfb, 0xff, 0xff, 0x31, 0xd2, 0x5d, 
+    0x89, 0xd0, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x57, 0x49, 0x89, 0xff, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x53, 
+    0x48, 0x89, 0xf3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x8b, 0x46, 0x08, 0x8b, 
+    0x56, 0x18, 0x48, 0x8b, 0x3d, 0xf3, 0x5a, 0x00, 0x00, 0x8b, 0x48, 0x0c, 
+    0x44, 0x8d, 0x74, 0x11, 0xff, 0x48, 0x8b, 0x16, 0x8b, 0x70, 0x10, 0x8b, 
+    0x52, 0x08, 0x41, 0x39, 0xd6, 0x44, 0x0f, 0x4f, 0xf2, 0xe8, 0x6e, 0xf9, 
+    0xff, 0xff, 0x44, 0x8b, 0x63, 0x18, 0x45, 0x39, 0xe6, 0x0f, 0x8e, 0x69, 
+    0x01, 0x00, 0x00, 0x4d, 0x63, 0xec, 0x48, 0x8b, 0x43, 0x08, 0x44, 0x89, 
+    0xe1, 0x49, 0xc1, 0xe5, 0x03, 0xeb, 0x04, 0x90, 0x8b, 0x4b, 0x18, 0x8b, 
+    0x70, 0x04, 0x8b, 0x10, 0x48, 0x8b, 0x3d, 0xa9, 0x5a, 0x00, 0x00, 0x44, 
+    0x01, 0xe6, 0x29, 0xce, 0xe8, 0x97, 0xfa, 0xff, 0xff, 0x83, 0xf8, 0xff, 
+    0x74, 0x19, 0x48, 0x8b, 0x43, 0x08, 0x48, 0x8b, 0x3d, 0x8f, 0x5a, 0x00, 
+    0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x70, 0x18, 0xe8, 0xc9, 
+    0xfa, 0xff, 0xff, 0x48, 0x8b, 0x13, 0x48, 0x8b, 0x43, 0x08, 0x48, 0x8b, 
+    0x12, 0x4a, 0x83, 0x3c, 0x2a, 0x00, 0x74, 0x3b, 0x8b, 0x70, 0x04, 0x8b, 
+    0x10, 0x48, 0x8b, 0x3d, 0x64, 0x5a, 0x00, 0x00, 0x44, 0x01, 0xe6, 0x2b, 
+    0x73, 0x18, 0xe8, 0x51, 0xfa, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x1b, 
+    0x48, 0x8b, 0x03, 0x48, 0x8b, 0x3d, 0x4a, 0x5a, 0x00, 0x00, 0xba, 0xff, 
+    0xff, 0xff, 0xff, 0x48, 0x8b, 0x00, 0x4a, 0x8b, 0x34, 0x28, 0xe8, 0x81, 
+    0xfa, 0xff, 0xff, 0x48, 0x8b, 0x43, 0x08, 0x41, 0x83, 0xc4, 0x01, 0x49, 
+    0x83, 0xc5, 0x08, 0x45, 0x39, 0xe6, 0x0f, 0x85, 0x6c, 0xff, 0xff, 0xff, 
+    0x48, 0x8b, 0x13, 0x8b, 0x40, 0x0c, 0x8b, 0x52, 0x08, 0x8d, 0x70, 0xff, 
+    0x89, 0xd1, 0x29, 0xf1, 0x85, 0xc9, 0x7e, 0x78, 0x39, 0xc2, 0x7c, 0x44, 
+    0x66, 0x0f, 0xef, 0xc0, 0x66, 0x0f, 0xef, 0xc9, 0xf3, 0x0f, 0x2a, 0x43, 
+    0x18, 0xf3, 0x0f, 0x2a, 0xc9, 0xf3, 0x0f, 0x5a, 0xc0, 0xf2, 0x0f, 0x59, 
+    0x05, 0xff, 0x39, 0x00, 0x00, 0xf3, 0x0f, 0x5a, 0xc9, 0xf2, 0x0f, 0x5e, 
+    0xc1, 0xf2, 0x0f, 0x2c, 0xc8, 0x85, 0xc9, 0x7f, 0x58, 0xc7, 0x45, 0xc6, 
+    0x54, 0x6f, 0x70, 0x00, 0x4c, 0x8d, 0x65, 0xc6, 0xeb, 0x15, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x45, 0xc6, 0x41, 
+    0x6c, 0x6c, 0x00, 0x4c, 0x8d, 0x65, 0xc6, 0x48, 0x8b, 0x73, 0x10, 0x4c, 
+    0x89, 0xe2, 0x4c, 0x89, 0xff, 0xe8, 0x46, 0xfc, 0xff, 0xff, 0x48, 0x83, 
+    0xc4, 0x18, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 
+    0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc2, 0x7c, 0xcc, 
+    0xc7, 0x45, 0xc6, 0x42, 0x6f, 0x74, 0x00, 0x4c, 0x8d, 0x65, 0xc6, 0xeb, 
+    0xca, 0x83, 0xf9, 0x63, 0x7f, 0xee, 0x4c, 0x8d, 0x65, 0xc6, 0x48, 0x8d, 
+    0x15, 0xbf, 0x37, 0x00, 0x00, 0xbe, 0x0a, 0x00, 0x00, 0x00, 0x31, 0xc0, 
+    0x4c, 0x89, 0xe7, 0xe8, 0x80, 0xf8, 0xff, 0xff, 0xeb, 0xa9, 0x66, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x08, 0xe9, 0x33, 0xff, 0xff, 
+    0xff, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0x1f, 0x40, 0x00, 0x55, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x49, 0x89, 
+    0xff, 0x41, 0x56, 0x41, 0x89, 0xd6, 0x41, 0x55, 0x44, 0x8d, 0x2c, 0x0e, 
+    0x41, 0x54, 0x41, 0x89, 0xd4, 0x53, 0x48, 0x83, 0xec, 0x18, 0x89, 0x75, 
+    0xcc, 0x85, 0xc9, 0x78, 0x6a, 0x0f, 0x1f, 0x00, 0x8b, 0x5d, 0xcc, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x41, 0x8b, 0x17, 0x41, 0x8b, 0x77, 0x04, 0x48, 
+    0x8b, 0x3d, 0x0a, 0x59, 0x00, 0x00, 0x01, 0xda, 0x44, 0x01, 0xe6, 0xe8, 
+    0xf8, 0xf8, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x13, 0x41, 0x8b, 0x77, 
+    0x10, 0x48, 0x8b, 0x3d, 0xf0, 0x58, 0x00, 0x00, 0x83, 0xce, 0x20, 0xe8, 
+    0x00, 0xf9, 0xff, 0xff, 0x83, 0xc3, 0x01, 0x44, 0x39, 0xeb, 0x7e, 0xc8, 
+    0x41, 0x8d, 0x44, 0x24, 0x01, 0x45, 0x39, 0xe6, 0x7c, 0x0e, 0x41, 0x89, 
+    0xc4, 0xeb, 0xb1, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x83, 0xc4, 0x18, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 
+    0x5f, 0x5d, 0xc3, 0x41, 0x8d, 0x44, 0x24, 0x01, 0x45, 0x39, 0xe6, 0x7c, 
+    0xe7, 0x41, 0x89, 0xc4, 0xeb, 0x83, 0x66, 0x90, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x57, 0x49, 0x89, 0xff, 0xbf, 0x20, 0x00, 0x00, 0x00, 0x41, 0x56, 
+    0x45, 0x89, 0xc6, 0x41, 0x55, 0x45, 0x89, 0xcd, 0x41, 0x54, 0x4c, 0x63, 
+    0xe2, 0x53, 0x48, 0x83, 0xec, 0x18, 0x89, 0x75, 0xc8, 0x89, 0x4d, 0xcc, 
+    0xe8, 0x53, 0xf8, 0xff, 0xff, 0x8b, 0x4d, 0xcc, 0x8b, 0x75, 0xc8, 0x41, 
+    0x8d, 0x7c, 0x24, 0x01, 0x41, 0x80, 0x7f, 0x20, 0x00, 0x44, 0x89, 0x60, 
+    0x08, 0x48, 0x63, 0xff, 0x48, 0x89, 0xc3, 0x45, 0x0f, 0x45, 0xee, 0x89, 
+    0x48, 0x0c, 0x89, 0x70, 0x04, 0x44, 0x89, 0x68, 0x10, 0xc7, 0x00, 0x01, 
+    0x00, 0x00, 0x00, 0xe8, 0x20, 0xf8, 0xff, 0xff, 0x4c, 0x89, 0xe2, 0xbe, 
+    0x20, 0x00, 0x00, 0x00, 0x48, 0x89, 0x43, 0x18, 0x48, 0x89, 0xc7, 0xe8, 
+    0x7c, 0xf7, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x2d, 0x58, 0x00, 0x00, 0x42, 
+    0xc6, 0x04, 0x20, 0x00, 0x8b, 0x73, 0x10, 0xe8, 0xb8, 0xf6, 0xff, 0xff, 
+    0x48, 0x89, 0xdf, 0xe8, 0x80, 0xf9, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x11, 
+    0x58, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0xa2, 0xf6, 0xff, 0xff, 0x48, 0x83, 
+    0xc4, 0x18, 0x48, 0x89, 0xd8, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 
+    0x41, 0x5f, 0x5d, 0xc3, 0x55, 0x48, 0x89, 0xe5, 0x41, 0x55, 0x49, 0x89, 
+    0xf5, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x41, 0x54, 0x49, 0x89, 0xfc, 0xbf, 
+    0x50, 0x00, 0x00, 0x00, 0x53, 0x48, 0x83, 0xec, 0x08, 0xe8, 0x6e, 0xf7, 
+    0xff, 0xff, 0x41, 0x8b, 0x54, 0x24, 0x1c, 0x4c, 0x89, 0x68, 0x18, 0x48, 
+    0x89, 0xc3, 0x85, 0xd2, 0x0f, 0x94, 0x40, 0x20, 0x0f, 0x84, 0xe6, 0x00, 
+    0x00, 0x00, 0x48, 0x8b, 0x3d, 0xb7, 0x57, 0x00, 0x00, 0xe8, 0x9a, 0xf6, 
+    0xff, 0xff, 0xe8, 0xb5, 0xf6, 0xff, 0xff, 0xe8, 0x60, 0xf7, 0xff, 0xff, 
+    0x31, 0xff, 0xe8, 0x69, 0xf6, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x9a, 0x57, 
+    0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x08, 0xf7, 0xff, 0xff, 
+    0x48, 0x8b, 0x05, 0x89, 0x57, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 
+    0xd8, 0x00, 0x00, 0x00, 0x0f, 0xbf, 0x50, 0x04, 0x83, 0xc2, 0x01, 0x89, 
+    0x53, 0x28, 0x0f, 0xbf, 0x50, 0x06, 0x8d, 0x42, 0x01, 0x83, 0xea, 0x01, 
+    0x89, 0x43, 0x24, 0x48, 0x89, 0xdf, 0x41, 0xb9, 0x00, 0x00, 0x04, 0x00, 
+    0x31, 0xf6, 0x41, 0xb8, 0x00, 0x01, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x00, 
+    0x00, 0xe8, 0xa6, 0xfe, 0xff, 0xff, 0x41, 0xb9, 0x00, 0x00, 0x04, 0x00, 
+    0xb9, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x48, 0x89, 0x03, 0x8b, 
+    0x43, 0x24, 0x41, 0xb8, 0x00, 0x00, 0x04, 0x00, 0x8d, 0x50, 0xfe, 0x8b, 
+    0x43, 0x28, 0x8d, 0x70, 0xfe, 0xe8, 0x7e, 0xfe, 0xff, 0xff, 0x49, 0x89, 
+    0x9c, 0x24, 0xb8, 0x04, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x4c, 0x8d, 0x25, 
+    0x04, 0x36, 0x00, 0x00, 0x48, 0x89, 0x43, 0x08, 0x4c, 0x89, 0xe6, 0xe8, 
+    0xd0, 0xf8, 0xff, 0xff, 0x4c, 0x89, 0xe6, 0x48, 0x89, 0xdf, 0x48, 0x8d, 
+    0x15, 0x49, 0x35, 0x00, 0x00, 0xe8, 0x8e, 0xf9, 0xff, 0xff, 0x48, 0x8b, 
+    0x3d, 0xef, 0x56, 0x00, 0x00, 0xe8, 0x22, 0xf6, 0xff, 0xff, 0x48, 0x83, 
+    0xc4, 0x08, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 
+    0x5d, 0xc3, 0x66, 0x90, 0xe8, 0x4b, 0xf5, 0xff, 0xff, 0x84, 0xc0, 0x74, 
+    0x14, 0x80, 0x7b, 0x20, 0x00, 0x0f, 0x84, 0x07, 0xff, 0xff, 0xff, 0xe8, 
+    0x18, 0xf6, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x75, 0x33, 0xc6, 0x43, 0x20, 
+    0x00, 0xe9, 0xf4, 0xfe, 0xff, 0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc7, 0x43, 0x28, 0xff, 0xff, 0xff, 0xff, 0xba, 
+    0xfd, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26, 0xff, 
+    0xff, 0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x31, 0xf6, 0xba, 0x02, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+    0xe8, 0x3f, 0xf6, 0xff, 0xff, 0xba, 0x04, 0x00, 0x00, 0x00, 0xbe, 0x07, 
+    0x00, 0x00, 0x00, 0xbf, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x2b, 0xf6, 0xff, 
+    0xff, 0xba, 0x01, 0x00, 0x00, 0x00, 0xbe, 0x07, 0x00, 0x00, 0x00, 0xbf, 
+    0x03, 0x00, 0x00, 0x00, 0xe8, 0x17, 0xf6, 0xff, 0xff, 0x31, 0xd2, 0xbe, 
+    0x02, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0xe8, 0x06, 0xf6, 
+    0xff, 0xff, 0xe9, 0x7b, 0xfe, 0xff, 0xff, 0x90, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x56, 0x49, 0x89, 0xd6, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xfc, 
+    0x53, 0x8b, 0x42, 0x08, 0x39, 0xc6, 0x0f, 0x4e, 0xc6, 0x8b, 0x77, 0x10, 
+    0x48, 0x8b, 0x3d, 0x15, 0x56, 0x00, 0x00, 0x4c, 0x63, 0xe8, 0xe8, 0xa5, 
+    0xf4, 0xff, 0xff, 0x45, 0x85, 0xed, 0x7e, 0x4a, 0x31, 0xdb, 0x66, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x41, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x3d, 0xf5, 
+    0x55, 0x00, 0x00, 0x8d, 0x50, 0x01, 0x41, 0x8b, 0x44, 0x24, 0x04, 0x8d, 
+    0x74, 0x18, 0x01, 0xe8, 0xdc, 0xf5, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 
+    0x18, 0x49, 0x8b, 0x06, 0x48, 0x8b, 0x3d, 0xd5, 0x55, 0x00, 0x00, 0xba, 
+    0xff, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x34, 0xd8, 0xe8, 0x0f, 0xf6, 0xff, 
+    0xff, 0x48, 0x83, 0xc3, 0x01, 0x49, 0x39, 0xdd, 0x75, 0xbe, 0x48, 0x8b, 
+    0x3d, 0xb7, 0x55, 0x00, 0x00, 0x5b, 0x31, 0xf6, 0x41, 0x5c, 0x41, 0x5d, 
+    0x41, 0x5e, 0x5d, 0xe9, 0x40, 0xf4, 0xff, 0xff, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x57, 0x41, 0x89, 0xff, 0x41, 0x56, 0x41, 0x55, 0x41, 0x89, 0xcd, 
+    0x41, 0x54, 0x45, 0x89, 0xc4, 0x53, 0x48, 0x89, 0xf3, 0x48, 0x83, 0xec, 
+    0x28, 0x8b, 0x45, 0x10, 0x80, 0x7d, 0x18, 0x00, 0x89, 0x55, 0xc8, 0x4c, 
+    0x89, 0x4d, 0xb8, 0x89, 0x45, 0xc4, 0x74, 0x0a, 0x83, 0xc2, 0x01, 0x41, 
+    0x83, 0xc5, 0x01, 0x89, 0x55, 0xc8, 0x48, 0x8b, 0x7d, 0xb8, 0xe8, 0x5d, 
+    0xf4, 0xff, 0xff, 0x44, 0x89, 0xe2, 0x29, 0xc2, 0xd1, 0xfa, 0x41, 0x39, 
+    0xc4, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0xc2, 0xba, 0x00, 0x03, 
+    0x00, 0x00, 0x89, 0x45, 0xc0, 0x0f, 0xb6, 0x45, 0xc4, 0xc1, 0xe0, 0x12, 
+    0x45, 0x84, 0xff, 0x0f, 0x44, 0xd0, 0x8b, 0x45, 0xc8, 0x41, 0x01, 0xc4, 
+    0x41, 0x89, 0xd7, 0x44, 0x39, 0xe0, 0x7d, 0x44, 0x41, 0x89, 0xc6, 0x89, 
+    0xd0, 0x83, 0xc8, 0x20, 0x89, 0x45, 0xcc, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x8b, 0x13, 0x8b, 0x73, 0x04, 0x48, 0x8b, 0x3d, 0x14, 0x55, 0x00, 0x00, 
+    0x44, 0x01, 0xf2, 0x44, 0x01, 0xee, 0xe8, 0x01, 0xf5, 0xff, 0xff, 0x83, 
+    0xf8, 0xff, 0x74, 0x0f, 0x8b, 0x75, 0xcc, 0x48, 0x8b, 0x3d, 0xfa, 0x54, 
+    0x00, 0x00, 0xe8, 0x0d, 0xf5, 0xff, 0xff, 0x41, 0x83, 0xc6, 0x01, 0x45, 
+    0x39, 0xf4, 0x75, 0xcc, 0x44, 0x89, 0xf8, 0x48, 0x8b, 0x3d, 0xe2, 0x54, 
+    0x00, 0x00, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x80, 0x7d, 0xc4, 0x00, 0x44, 
+    0x0f, 0x45, 0xf8, 0x31, 0xd2, 0x44, 0x89, 0xfe, 0xe8, 0x53, 0xf4, 0xff, 
+    0xff, 0x8b, 0x55, 0xc0, 0x8b, 0x73, 0x04, 0x44, 0x8b, 0x75, 0xc8, 0x48, 
+    0x8b, 0x3d, 0xba, 0x54, 0x00, 0x00, 0x44, 0x03, 0x33, 0x44, 0x01, 0xee, 
+    0x44, 0x01, 0xf2, 0xe8, 0xa4, 0xf4, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 
+    0x15, 0x48, 0x8b, 0x75, 0xb8, 0x48, 0x8b, 0x3d, 0x9c, 0x54, 0x00, 0x00, 
+    0xba, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xda, 0xf4, 0xff, 0xff, 0x48, 0x8b, 
+    0x3d, 0x8b, 0x54, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0x44, 0x89, 0xfe, 
+    0x31, 0xd2, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 
+    0xe9, 0xcb, 0xf4, 0xff, 0xff, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x41, 0x89, 
+    0xcf, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x41, 0x56, 0x41, 0x55, 0x49, 0x89, 
+    0xfd, 0x48, 0x89, 0xf7, 0x48, 0x89, 0xd6, 0x41, 0x54, 0x53, 0x44, 0x89, 
+    0xc3, 0x48, 0x83, 0xec, 0x08, 0x41, 0x8b, 0x55, 0x24, 0x44, 0x8d, 0x72, 
+    0xfe, 0x83, 0xea, 0x04, 0x41, 0xff, 0x55, 0x18, 0xbe, 0x02, 0x00, 0x00, 
+    0x00, 0x49, 0x89, 0xc4, 0x8b, 0x40, 0x08, 0x01, 0xd8, 0x8d, 0x48, 0x02, 
+    0x45, 0x85, 0xff, 0x75, 0x1f, 0x8d, 0x50, 0x05, 0x41, 0x8b, 0x45, 0x28, 
+    0x29, 0xd0, 0x48, 0x63, 0xf0, 0xc1, 0xf8, 0x1f, 0x48, 0x69, 0xf6, 0x56, 
+    0x55, 0x55, 0x55, 0x48, 0xc1, 0xee, 0x20, 0x29, 0xc6, 0x83, 0xc6, 0x01, 
+    0x45, 0x31, 0xc9, 0x41, 0xb8, 0x00, 0x02, 0x00, 0x00, 0x44, 0x89, 0xf2, 
+    0x4c, 0x89, 0xef, 0xe8, 0x44, 0xfb, 0xff, 0xff, 0x89, 0xde, 0x4c, 0x89, 
+    0xe2, 0x49, 0x89, 0x45, 0x10, 0x48, 0x89, 0xc7, 0xf7, 0xd6, 0x03, 0x70, 
+    0x0c, 0xe8, 0x9e, 0xfd, 0xff, 0xff, 0x41, 0x8b, 0x44, 0x24, 0x08, 0x85, 
+    0xc0, 0x7e, 0x1d, 0x31, 0xdb, 0x0f, 0x1f, 0x00, 0x49, 0x8b, 0x04, 0x24, 
+    0x48, 0x8b, 0x3c, 0xd8, 0x48, 0x83, 0xc3, 0x01, 0xe8, 0x5f, 0xf2, 0xff, 
+    0xff, 0x41, 0x39, 0x5c, 0x24, 0x08, 0x7f, 0xe8, 0x49, 0x8b, 0x3c, 0x24, 
+    0x48, 0x85, 0xff, 0x74, 0x05, 0xe8, 0x4a, 0xf2, 0xff, 0xff, 0x48, 0x83, 
+    0xc4, 0x08, 0x4c, 0x89, 0xe7, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 
+    0x41, 0x5f, 0x5d, 0xe9, 0x34, 0xf2, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+    0x55, 0x41, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x31, 0xc9, 0x31, 0xf6, 0x48, 
+    0x89, 0xe5, 0x41, 0x57, 0x41, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x41, 0x56, 
+    0x41, 0x55, 0x41, 0x54, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x28, 
+    0x48, 0x8b, 0x57, 0x48, 0xe8, 0xf3, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x43, 
+    0x10, 0x48, 0x8b, 0x3d, 0x50, 0x53, 0x00, 0x00, 0x44, 0x8b, 0x70, 0x08, 
+    0x8b, 0x70, 0x10, 0x44, 0x8b, 0x60, 0x0c, 0x41, 0x8d, 0x4e, 0xfe, 0x45, 
+    0x8d, 0x6e, 0xff, 0x89, 0x4d, 0xbc, 0xe8, 0xcd, 0xf1, 0xff, 0xff, 0x8b, 
+    0x55, 0xbc, 0x85, 0xd2, 0x7e, 0x48, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0x1d, 0x53, 0x00, 0x00, 0x8b, 
+    0x70, 0x04, 0x8b, 0x10, 0x44, 0x01, 0xe6, 0x44, 0x01, 0xfa, 0x83, 0xee, 
+    0x04, 0xe8, 0x02, 0xf3, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x16, 0x48, 
+    0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0xfa, 0x52, 0x00, 0x00, 0x8b, 0x70, 
+    0x10, 0x83, 0xce, 0x5f, 0xe8, 0x07, 0xf3, 0xff, 0xff, 0x41, 0x83, 0xc7, 
+    0x01, 0x45, 0x39, 0xef, 0x75, 0xbe, 0x41, 0x8d, 0x46, 0xfc, 0x48, 0x8d, 
+    0x55, 0xcf, 0x41, 0x89, 0xc5, 0x41, 0xc1, 0xed, 0x1f, 0x41, 0x01, 0xc5, 
+    0x41, 0xd1, 0xfd, 0x41, 0x8d, 0x45, 0x01, 0x89, 0x45, 0xb8, 0x41, 0x8d, 
+    0x45, 0x02, 0x89, 0x45, 0xb4, 0x41, 0x8d, 0x45, 0x03, 0x89, 0x45, 0xb0, 
+    0x8b, 0x05, 0xce, 0x32, 0x00, 0x00, 0x89, 0x45, 0xcc, 0x48, 0x8d, 0x45, 
+    0xcc, 0x80, 0x38, 0x30, 0x75, 0x0c, 0xc6, 0x00, 0x00, 0x48, 0x83, 0xc0, 
+    0x01, 0x48, 0x39, 0xc2, 0x75, 0xef, 0x80, 0x7b, 0x20, 0x00, 0xc6, 0x45, 
+    0xce, 0x30, 0x0f, 0x84, 0xb8, 0x00, 0x00, 0x00, 0x8b, 0x45, 0xbc, 0x41, 
+    0x83, 0xee, 0x01, 0x41, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x85, 0xc0, 0x7e, 
+    0x64, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x10, 
+    0x48, 0x8b, 0x3d, 0x6d, 0x52, 0x00, 0x00, 0x8b, 0x70, 0x04, 0x8b, 0x10, 
+    0x44, 0x01, 0xe6, 0x44, 0x01, 0xfa, 0x83, 0xee, 0x02, 0xe8, 0x52, 0xf2, 
+    0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x31, 0x45, 0x39, 0xfd, 0x74, 0x48, 
+    0x44, 0x39, 0x7d, 0xb8, 0x74, 0x62, 0xbe, 0x30, 0x04, 0x00, 0x00, 0x44, 
+    0x39, 0x7d, 0xb4, 0x74, 0x0f, 0xbe, 0x20, 0x04, 0x00, 0x00, 0x44, 0x39, 
+    0x7d, 0xb0, 0x0f, 0x84, 0x40, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0x29, 
+    0x52, 0x00, 0x00, 0xe8, 0x3c, 0xf2, 0xff, 0xff, 0x41, 0x83, 0xc7, 0x01, 
+    0x45, 0x39, 0xf7, 0x75, 0xa3, 0x48, 0x83, 0xc4, 0x28, 0x5b, 0x41, 0x5c, 
+    0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 
+    0x0f, 0xbe, 0x75, 0xcc, 0x89, 0xf0, 0x81, 0xce, 0x00, 0x04, 0x00, 0x00, 
+    0x84, 0xc0, 0xb8, 0x20, 0x04, 0x00, 0x00, 0x0f, 0x44, 0xf0, 0xeb, 0xc0, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbe, 0x75, 0xcd, 
+    0xeb, 0xde, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0xcd, 0x51, 0x00, 0x00, 0x8b, 
+    0x70, 0x04, 0x8b, 0x08, 0x44, 0x01, 0xe6, 0x8d, 0x51, 0x01, 0x83, 0xee, 
+    0x02, 0xe8, 0xb2, 0xf1, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x0f, 0x85, 0x09, 
+    0x01, 0x00, 0x00, 0x83, 0x7d, 0xbc, 0x02, 0x41, 0xbe, 0x02, 0x00, 0x00, 
+    0x00, 0x7e, 0x6b, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x10, 
+    0x48, 0x8b, 0x3d, 0x95, 0x51, 0x00, 0x00, 0x8b, 0x70, 0x04, 0x8b, 0x10, 
+    0x44, 0x01, 0xe6, 0x44, 0x01, 0xf2, 0x83, 0xee, 0x02, 0xe8, 0x7a, 0xf1, 
+    0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x39, 0x45, 0x39, 0xf5, 0x0f, 0x84, 
+    0x9c, 0x00, 0x00, 0x00, 0x44, 0x39, 0x75, 0xb8, 0x0f, 0x84, 0xaa, 0x00, 
+    0x00, 0x00, 0xbe, 0x30, 0x00, 0x00, 0x00, 0x44, 0x39, 0x75, 0xb4, 0x74, 
+    0x0f, 0xbe, 0x2d, 0x00, 0x00, 0x00, 0x44, 0x39, 0x75, 0xb0, 0x0f, 0x84, 
+    0xc8, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0x49, 0x51, 0x00, 0x00, 0xe8, 
+    0x5c, 0xf1, 0xff, 0xff, 0x41, 0x83, 0xc6, 0x01, 0x44, 0x39, 0x75, 0xbc, 
+    0x75, 0x9a, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0x2f, 0x51, 0x00, 
+    0x00, 0x8b, 0x55, 0xbc, 0x44, 0x03, 0x60, 0x04, 0x03, 0x10, 0x41, 0x8d, 
+    0x74, 0x24, 0xfe, 0xe8, 0x14, 0xf1, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x0f, 
+    0x84, 0xf8, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x0c, 0x51, 0x00, 0x00, 
+    0x48, 0x83, 0xc4, 0x28, 0xbe, 0x5d, 0x00, 0x00, 0x00, 0x5b, 0x41, 0x5c, 
+    0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 0xe9, 0x0c, 0xf1, 0xff, 0xff, 
+    0x0f, 0x1f, 0x40, 0x00, 0x0f, 0xbe, 0x45, 0xcf, 0x89, 0xc2, 0x80, 0xcc, 
+    0x04, 0x84, 0xd2, 0x0f, 0x45, 0xf0, 0xe9, 0xad, 0xfe, 0xff, 0xff, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x0f, 0xbe, 0x75, 0xcc, 0xb8, 0x2d, 0x00, 0x00, 
+    0x00, 0x40, 0x84, 0xf6, 0x0f, 0x44, 0xf0, 0xe9, 0x74, 0xff, 0xff, 0xff, 
+    0x0f, 0x1f, 0x40, 0x00, 0x0f, 0xbe, 0x75, 0xcd, 0xb8, 0x2d, 0x00, 0x00, 
+    0x00, 0x40, 0x84, 0xf6, 0x0f, 0x44, 0xf0, 0xe9, 0x5c, 0xff, 0xff, 0xff, 
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0x8b, 0x3d, 0xa1, 0x50, 0x00, 0x00, 0xbe, 
+    0x5b, 0x00, 0x00, 0x00, 0xe8, 0xaf, 0xf0, 0xff, 0xff, 0xe9, 0xe1, 0xfe, 
+    0xff, 0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0xbe, 0x55, 0xcf, 0x84, 0xd2, 0x0f, 0x45, 0xf2, 0xe9, 0x2a, 0xff, 
+    0xff, 0xff, 0x66, 0x90, 0x55, 0x48, 0x89, 0xe5, 0x41, 0x54, 0x53, 0x48, 
+    0x85, 0xff, 0x74, 0x70, 0x4c, 0x8b, 0xa7, 0xb8, 0x04, 0x00, 0x00, 0x49, 
+    0x8b, 0x1c, 0x24, 0x48, 0x85, 0xdb, 0x74, 0x27, 0x48, 0x8b, 0x3d, 0x55, 
+    0x50, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0xe6, 0xee, 0xff, 0xff, 0x48, 0x89, 
+    0xdf, 0xe8, 0xae, 0xf1, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x18, 0xe8, 0xe5, 
+    0xee, 0xff, 0xff, 0x48, 0x89, 0xdf, 0xe8, 0xdd, 0xee, 0xff, 0xff, 0x49, 
+    0x8b, 0x5c, 0x24, 0x08, 0x48, 0x85, 0xdb, 0x74, 0x27, 0x48, 0x8b, 0x3d, 
+    0x24, 0x50, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0xb5, 0xee, 0xff, 0xff, 0x48, 
+    0x89, 0xdf, 0xe8, 0x7d, 0xf1, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x18, 0xe8, 
+    0xb4, 0xee, 0xff, 0xff, 0x48, 0x89, 0xdf, 0xe8, 0xac, 0xee, 0xff, 0xff, 
+    0x4c, 0x89, 0xe7, 0xe8, 0xa4, 0xee, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0xf5, 
+    0x4f, 0x00, 0x00, 0xe8, 0xd8, 0xee, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0xe9, 
+    0x4f, 0x00, 0x00, 0xe8, 0x1c, 0xef, 0xff, 0xff, 0x5b, 0x41, 0x5c, 0x5d, 
+    0xe9, 0x03, 0xf0, 0xff, 0xff, 0x0f, 0x1f, 0x00, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x8b, 
+    0x3d, 0xc3, 0x4f, 0x00, 0x00, 0x48, 0x85, 0xff, 0x0f, 0x84, 0x0a, 0x01, 
+    0x00, 0x00, 0x44, 0x0f, 0xbf, 0x6f, 0x04, 0x44, 0x0f, 0xbf, 0x67, 0x06, 
+    0x41, 0x83, 0xc5, 0x01, 0x41, 0x83, 0xc4, 0x01, 0x40, 0x84, 0xf6, 0x75, 
+    0x0a, 0x44, 0x39, 0x63, 0x24, 0x0f, 0x84, 0x01, 0x01, 0x00, 0x00, 0x4c, 
+    0x8b, 0x33, 0x4d, 0x85, 0xf6, 0x74, 0x27, 0x31, 0xf6, 0xe8, 0x22, 0xee, 
+    0xff, 0xff, 0x4c, 0x89, 0xf7, 0xe8, 0xea, 0xf0, 0xff, 0xff, 0x49, 0x8b, 
+    0x7e, 0x18, 0xe8, 0x21, 0xee, 0xff, 0xff, 0x4c, 0x89, 0xf7, 0xe8, 0x19, 
+    0xee, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x6a, 0x4f, 0x00, 0x00, 0x4c, 0x8b, 
+    0x73, 0x08, 0x4d, 0x85, 0xf6, 0x74, 0x27, 0x31, 0xf6, 0xe8, 0xf2, 0xed, 
+    0xff, 0xff, 0x4c, 0x89, 0xf7, 0xe8, 0xba, 0xf0, 0xff, 0xff, 0x49, 0x8b, 
+    0x7e, 0x18, 0xe8, 0xf1, 0xed, 0xff, 0xff, 0x4c, 0x89, 0xf7, 0xe8, 0xe9, 
+    0xed, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x3a, 0x4f, 0x00, 0x00, 0xe8, 0x1d, 
+    0xee, 0xff, 0xff, 0x44, 0x89, 0x6b, 0x28, 0x41, 0x8d, 0x54, 0x24, 0xfe, 
+    0x31, 0xf6, 0x44, 0x89, 0x63, 0x24, 0x41, 0xb9, 0x00, 0x00, 0x04, 0x00, 
+    0xb9, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x41, 0xb8, 0x00, 0x01, 
+    0x00, 0x00, 0xe8, 0x65, 0xf6, 0xff, 0xff, 0x41, 0xb9, 0x00, 0x00, 0x04, 
+    0x00, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x48, 0x89, 0x03, 
+    0x8b, 0x43, 0x24, 0x41, 0xb8, 0x00, 0x00, 0x04, 0x00, 0x8d, 0x50, 0xfe, 
+    0x8b, 0x43, 0x28, 0x8d, 0x70, 0xfe, 0xe8, 0x3d, 0xf6, 0xff, 0xff, 0x48, 
+    0x8b, 0x73, 0x30, 0x48, 0x89, 0xdf, 0x48, 0x89, 0x43, 0x08, 0xe8, 0x9d, 
+    0xf0, 0xff, 0xff, 0x48, 0x8b, 0x53, 0x40, 0x48, 0x8b, 0x73, 0x38, 0x48, 
+    0x89, 0xdf, 0xe8, 0x5d, 0xf1, 0xff, 0xff, 0xb8, 0x01, 0x00, 0x00, 0x00, 
+    0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x5d, 0xc3, 0x0f, 0x1f, 0x80, 
+    0x00, 0x00, 0x00, 0x00, 0x41, 0xbd, 0xff, 0xff, 0xff, 0xff, 0x41, 0xbc, 
+    0xff, 0xff, 0xff, 0xff, 0xe9, 0xf7, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x80, 
+    0x00, 0x00, 0x00, 0x00, 0x31, 0xc0, 0x44, 0x39, 0x6b, 0x28, 0x0f, 0x85, 
+    0xf3, 0xfe, 0xff, 0xff, 0xeb, 0xca, 0x66, 0x90, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x55, 0x49, 0x89, 0xf5, 0x31, 0xf6, 0x41, 0x54, 0x49, 0x89, 0xd4, 
+    0x53, 0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x9f, 0xb8, 0x04, 0x00, 0x00, 
+    0x48, 0x89, 0xdf, 0xe8, 0x8c, 0xfe, 0xff, 0xff, 0x4c, 0x89, 0xef, 0xe8, 
+    0x94, 0xee, 0xff, 0xff, 0x48, 0x89, 0xdf, 0x48, 0x89, 0x43, 0x48, 0xe8, 
+    0xc8, 0xfa, 0xff, 0xff, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x89, 0xdf, 0x4c, 
+    0x89, 0xe6, 0x8b, 0x50, 0x0c, 0x8b, 0x48, 0x08, 0x83, 0xea, 0x03, 0xe8, 
+    0xf0, 0xf1, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x31, 0x4e, 0x00, 0x00, 0x48, 
+    0x83, 0xc4, 0x08, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x5d, 0xe9, 0x5a, 0xed, 
+    0xff, 0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x55, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 
+    0x53, 0x48, 0x83, 0xec, 0x28, 0x48, 0x8b, 0x9f, 0xb8, 0x04, 0x00, 0x00, 
+    0x48, 0x89, 0x75, 0xb8, 0x31, 0xf6, 0x48, 0x89, 0xdf, 0xe8, 0x1a, 0xfe, 
+    0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0x0a, 0x01, 0x00, 0x00, 0x48, 0x8b, 
+    0x43, 0x10, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0x2e, 0x01, 0x00, 0x00, 0x44, 
+    0x8b, 0x78, 0x08, 0x44, 0x8b, 0x68, 0x0c, 0x48, 0x89, 0xdf, 0x48, 0x8b, 
+    0x75, 0xb8, 0x41, 0x8d, 0x57, 0xfc, 0x45, 0x8d, 0x77, 0xfe, 0x41, 0x89, 
+    0xd4, 0x41, 0xc1, 0xec, 0x1f, 0x41, 0x01, 0xd4, 0x41, 0x8d, 0x55, 0xfd, 
+    0x41, 0xd1, 0xfc, 0x41, 0x8d, 0x4c, 0x24, 0x01, 0x89, 0x4d, 0xc8, 0x41, 
+    0x8d, 0x4c, 0x24, 0x02, 0x89, 0x4d, 0xcc, 0x41, 0x8d, 0x4c, 0x24, 0x03, 
+    0x89, 0x4d, 0xc4, 0x44, 0x89, 0xf1, 0xe8, 0x4d, 0xf1, 0xff, 0xff, 0x80, 
+    0x7b, 0x20, 0x00, 0x0f, 0x85, 0x03, 0x01, 0x00, 0x00, 0x41, 0xbf, 0x02, 
+    0x00, 0x00, 0x00, 0x41, 0x83, 0xfe, 0x02, 0x7e, 0x6e, 0x0f, 0x1f, 0x80, 
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0x6d, 
+    0x4d, 0x00, 0x00, 0x8b, 0x70, 0x04, 0x8b, 0x10, 0x44, 0x01, 0xee, 0x44, 
+    0x01, 0xfa, 0x83, 0xee, 0x02, 0xe8, 0x52, 0xed, 0xff, 0xff, 0x83, 0xf8, 
+    0xff, 0x74, 0x3b, 0xbe, 0x31, 0x00, 0x04, 0x00, 0x45, 0x39, 0xfc, 0x74, 
+    0x25, 0x44, 0x39, 0x7d, 0xcc, 0x0f, 0x84, 0xa9, 0x00, 0x00, 0x00, 0x44, 
+    0x39, 0x7d, 0xc8, 0x0f, 0x84, 0x9f, 0x00, 0x00, 0x00, 0x31, 0xf6, 0x44, 
+    0x39, 0x7d, 0xc4, 0x40, 0x0f, 0x94, 0xc6, 0x8d, 0xb4, 0xb6, 0x20, 0x00, 
+    0x04, 0x00, 0x48, 0x8b, 0x3d, 0x1f, 0x4d, 0x00, 0x00, 0xe8, 0x32, 0xed, 
+    0xff, 0xff, 0x41, 0x83, 0xc7, 0x01, 0x45, 0x39, 0xfe, 0x75, 0x99, 0x48, 
+    0x8b, 0x3d, 0x0a, 0x4d, 0x00, 0x00, 0xe8, 0x3d, 0xec, 0xff, 0xff, 0x48, 
+    0x8b, 0x7b, 0x48, 0xe8, 0xa4, 0xeb, 0xff, 0xff, 0x48, 0xc7, 0x43, 0x48, 
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0x5b, 0x41, 0x5c, 0x41, 
+    0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x4c, 0x8b, 0x63, 0x10, 0x4d, 0x85, 0xe4, 0x74, 0x28, 0x48, 0x8b, 0x3d, 
+    0xd0, 0x4c, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0x61, 0xeb, 0xff, 0xff, 0x4c, 
+    0x89, 0xe7, 0xe8, 0x29, 0xee, 0xff, 0xff, 0x49, 0x8b, 0x7c, 0x24, 0x18, 
+    0xe8, 0x5f, 0xeb, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x57, 0xeb, 0xff, 
+    0xff, 0x48, 0x89, 0xdf, 0xe8, 0x1f, 0xf9, 0xff, 0xff, 0x48, 0x8b, 0x43, 
+    0x10, 0xe9, 0xc1, 0xfe, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0xbe, 0x30, 0x00, 0x04, 0x00, 0xe9, 0x68, 0xff, 0xff, 0xff, 0x66, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x0f, 0x8e, 0x6e, 0xff, 0xff, 
+    0xff, 0x45, 0x8d, 0x77, 0xff, 0x41, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0x65, 
+    0x4c, 0x00, 0x00, 0x8b, 0x70, 0x04, 0x8b, 0x10, 0x44, 0x01, 0xee, 0x44, 
+    0x01, 0xfa, 0x83, 0xee, 0x02, 0xe8, 0x4a, 0xec, 0xff, 0xff, 0x83, 0xf8, 
+    0xff, 0x74, 0x33, 0xbe, 0x31, 0x04, 0x04, 0x00, 0x45, 0x39, 0xfc, 0x74, 
+    0x1d, 0x44, 0x39, 0x7d, 0xcc, 0x74, 0x35, 0x44, 0x39, 0x7d, 0xc8, 0x74, 
+    0x2f, 0x31, 0xf6, 0x44, 0x39, 0x7d, 0xc4, 0x40, 0x0f, 0x94, 0xc6, 0x8d, 
+    0xb4, 0xb6, 0x20, 0x04, 0x04, 0x00, 0x48, 0x8b, 0x3d, 0x1f, 0x4c, 0x00, 
+    0x00, 0xe8, 0x32, 0xec, 0xff, 0xff, 0x41, 0x83, 0xc7, 0x01, 0x45, 0x39, 
+    0xf7, 0x75, 0xa1, 0xe9, 0xfb, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+    0xbe, 0x30, 0x04, 0x04, 0x00, 0xeb, 0xdb, 0x66, 0x0f, 0x1f, 0x84, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x85, 0xf6, 0x0f, 0x84, 0x40, 0x02, 0x00, 0x00, 
+    0x55, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x41, 0x56, 0x49, 0x89, 0xd6, 0x41, 
+    0x55, 0x41, 0x54, 0x53, 0x48, 0x83, 0xec, 0x08, 0x48, 0x85, 0xd2, 0x74, 
+    0x16, 0x83, 0xfe, 0x02, 0x0f, 0x84, 0x0e, 0x02, 0x00, 0x00, 0x83, 0xfe, 
+    0x03, 0x74, 0x21, 0x45, 0x31, 0xff, 0x83, 0xfe, 0x01, 0x74, 0x20, 0x48, 
+    0x8d, 0x65, 0xd8, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+    0x5d, 0xc3, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x4c, 0x8d, 0x3d, 0x08, 0x2a, 0x00, 0x00, 0x48, 0x8b, 0x9f, 0xb8, 0x04, 
+    0x00, 0x00, 0x4c, 0x8b, 0x63, 0x10, 0x4d, 0x85, 0xe4, 0x74, 0x30, 0x48, 
+    0x8b, 0x3d, 0x8a, 0x4b, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0x1b, 0xea, 0xff, 
+    0xff, 0x4c, 0x89, 0xe7, 0xe8, 0xe3, 0xec, 0xff, 0xff, 0x49, 0x8b, 0x7c, 
+    0x24, 0x18, 0xe8, 0x19, 0xea, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x11, 
+    0xea, 0xff, 0xff, 0x48, 0xc7, 0x43, 0x10, 0x00, 0x00, 0x00, 0x00, 0x41, 
+    0xb8, 0x02, 0x00, 0x00, 0x00, 0x31, 0xc9, 0x4c, 0x89, 0xf2, 0x4c, 0x89, 
+    0xfe, 0x48, 0x89, 0xdf, 0xe8, 0xe3, 0xf6, 0xff, 0xff, 0x48, 0x8b, 0x73, 
+    0x10, 0x0f, 0xb6, 0x7b, 0x20, 0x4c, 0x8d, 0x0d, 0xab, 0x29, 0x00, 0x00, 
+    0x41, 0xb8, 0x06, 0x00, 0x00, 0x00, 0x8b, 0x46, 0x08, 0x83, 0xe8, 0x06, 
+    0x41, 0x89, 0xc4, 0x41, 0xc1, 0xec, 0x1f, 0x41, 0x01, 0xc4, 0x8b, 0x46, 
+    0x0c, 0x6a, 0x00, 0x6a, 0x01, 0x41, 0xd1, 0xfc, 0x44, 0x8d, 0x68, 0xfe, 
+    0x44, 0x89, 0xe2, 0x44, 0x89, 0xe9, 0xe8, 0x65, 0xf5, 0xff, 0xff, 0x48, 
+    0x8b, 0x3d, 0x06, 0x4b, 0x00, 0x00, 0xe8, 0x39, 0xea, 0xff, 0xff, 0x58, 
+    0x5a, 0xeb, 0x0a, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x83, 0xf8, 0x0a, 0x74, 
+    0x3b, 0x31, 0xf6, 0x48, 0x89, 0xdf, 0xe8, 0x11, 0xfb, 0xff, 0xff, 0x85, 
+    0xc0, 0x0f, 0x85, 0x47, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0xda, 0x4a, 
+    0x00, 0x00, 0xe8, 0xad, 0xe9, 0xff, 0xff, 0x83, 0xf8, 0x0c, 0x75, 0xd8, 
+    0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0xeb, 0xfa, 0xff, 
+    0xff, 0xe9, 0x24, 0xff, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x48, 0x8b, 0x7b, 0x10, 0x44, 0x89, 0xe6, 0xb9, 0x06, 0x00, 0x00, 0x00, 
+    0x44, 0x89, 0xea, 0xe8, 0x5c, 0xf1, 0xff, 0xff, 0x48, 0x8b, 0x73, 0x10, 
+    0x0f, 0xb6, 0x7b, 0x20, 0x6a, 0x01, 0x6a, 0x01, 0x4c, 0x8d, 0x0d, 0x00, 
+    0x29, 0x00, 0x00, 0x44, 0x89, 0xe2, 0x44, 0x89, 0xe9, 0x41, 0xb8, 0x06, 
+    0x00, 0x00, 0x00, 0xe8, 0xd8, 0xf4, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x79, 
+    0x4a, 0x00, 0x00, 0xe8, 0xac, 0xe9, 0xff, 0xff, 0xbf, 0x48, 0xe8, 0x01, 
+    0x00, 0xe8, 0xe2, 0xea, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x10, 0x44, 0x89, 
+    0xe6, 0x44, 0x89, 0xea, 0xb9, 0x06, 0x00, 0x00, 0x00, 0xe8, 0x0e, 0xf1, 
+    0xff, 0xff, 0x48, 0x8b, 0x73, 0x10, 0x0f, 0xb6, 0x7b, 0x20, 0x6a, 0x00, 
+    0x6a, 0x01, 0x44, 0x89, 0xe2, 0x4c, 0x8d, 0x0d, 0xaf, 0x28, 0x00, 0x00, 
+    0x44, 0x89, 0xe9, 0x41, 0xb8, 0x06, 0x00, 0x00, 0x00, 0xe8, 0x8a, 0xf4, 
+    0xff, 0xff, 0x48, 0x8b, 0x3d, 0x2b, 0x4a, 0x00, 0x00, 0x48, 0x83, 0xc4, 
+    0x20, 0xe8, 0x5a, 0xe9, 0xff, 0xff, 0xbf, 0x48, 0xe8, 0x01, 0x00, 0xe8, 
+    0x90, 0xea, 0xff, 0xff, 0x4c, 0x8b, 0x63, 0x10, 0x4d, 0x85, 0xe4, 0x74, 
+    0x28, 0x48, 0x8b, 0x3d, 0x08, 0x4a, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0x99, 
+    0xe8, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x61, 0xeb, 0xff, 0xff, 0x49, 
+    0x8b, 0x7c, 0x24, 0x18, 0xe8, 0x97, 0xe8, 0xff, 0xff, 0x4c, 0x89, 0xe7, 
+    0xe8, 0x8f, 0xe8, 0xff, 0xff, 0x48, 0xc7, 0x43, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x48, 0x8b, 0x3d, 0xd8, 0x49, 0x00, 0x00, 0x48, 0x8d, 0x65, 0xd8, 
+    0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 0xe9, 0xfd, 
+    0xe8, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x4c, 0x8d, 0x3d, 0x16, 
+    0x28, 0x00, 0x00, 0xe9, 0x13, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+    0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x57, 0x41, 0x56, 0x4d, 0x63, 0xf1, 0x41, 0x55, 0x4a, 0x8d, 0x04, 
+    0xb5, 0x00, 0x00, 0x00, 0x00, 0x41, 0x54, 0x4d, 0x89, 0xc4, 0x53, 0x48, 
+    0x83, 0xec, 0x78, 0x48, 0x89, 0x45, 0xb8, 0x48, 0x83, 0xc0, 0x0f, 0x48, 
+    0x8b, 0x9f, 0xb8, 0x04, 0x00, 0x00, 0x48, 0x83, 0xe0, 0xf0, 0x48, 0x89, 
+    0x75, 0x90, 0x31, 0xf6, 0x48, 0x29, 0xc4, 0x48, 0x89, 0xdf, 0x4c, 0x89, 
+    0x45, 0x88, 0x48, 0x89, 0x95, 0x70, 0xff, 0xff, 0xff, 0x49, 0x89, 0xe5, 
+    0x48, 0x89, 0x8d, 0x68, 0xff, 0xff, 0xff, 0x44, 0x89, 0x75, 0xc8, 0x4c, 
+    0x89, 0x75, 0xc0, 0xe8, 0x70, 0xf9, 0xff, 0xff, 0x45, 0x85, 0xf6, 0x0f, 
+    0x8e, 0x5b, 0x07, 0x00, 0x00, 0x4d, 0x89, 0xe7, 0x4f, 0x8d, 0x24, 0xf4, 
+    0x45, 0x31, 0xf6, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x49, 0x8b, 0x3f, 0xe8, 
+    0x20, 0xe8, 0xff, 0xff, 0x41, 0x39, 0xc6, 0x44, 0x0f, 0x4c, 0xf0, 0x49, 
+    0x83, 0xc7, 0x08, 0x4d, 0x39, 0xfc, 0x75, 0xe8, 0x41, 0x8d, 0x4e, 0x04, 
+    0x89, 0xc8, 0x89, 0x4d, 0xcc, 0xc1, 0xe8, 0x1f, 0x01, 0xc8, 0xd1, 0xf8, 
+    0xf7, 0xd8, 0x89, 0x45, 0x84, 0x48, 0x83, 0xbd, 0x70, 0xff, 0xff, 0xff, 
+    0x00, 0x4c, 0x8b, 0x63, 0x10, 0x0f, 0x95, 0xc2, 0x48, 0x83, 0xbd, 0x68, 
+    0xff, 0xff, 0xff, 0x00, 0x0f, 0x95, 0xc0, 0x21, 0xc2, 0x0f, 0xb6, 0xc2, 
+    0x88, 0x55, 0x9f, 0x89, 0x45, 0x98, 0x48, 0x8b, 0x45, 0xb8, 0x4c, 0x01, 
+    0xe8, 0x48, 0x89, 0x85, 0x78, 0xff, 0xff, 0xff, 0x4d, 0x85, 0xe4, 0x0f, 
+    0x84, 0xd0, 0x06, 0x00, 0x00, 0x48, 0xc7, 0x45, 0xb0, 0x00, 0x00, 0x00, 
+    0x00, 0x45, 0x31, 0xf6, 0xc7, 0x45, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0xa9, 0x48, 0x00, 0x00, 0x31, 
+    0xf6, 0xe8, 0x3a, 0xe7, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x02, 0xea, 
+    0xff, 0xff, 0x49, 0x8b, 0x7c, 0x24, 0x18, 0xe8, 0x38, 0xe7, 0xff, 0xff, 
+    0x4c, 0x89, 0xe7, 0xe8, 0x30, 0xe7, 0xff, 0xff, 0x48, 0x83, 0x7d, 0xb0, 
+    0x00, 0x4c, 0x8b, 0x7d, 0x88, 0x48, 0xc7, 0x43, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x0f, 0x85, 0xf1, 0x01, 0x00, 0x00, 0x4d, 0x85, 0xf6, 0x74, 0x3f, 
+    0x45, 0x8b, 0x56, 0x08, 0x45, 0x31, 0xe4, 0x45, 0x85, 0xd2, 0x7e, 0x1e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x8b, 0x06, 0x4a, 
+    0x8b, 0x3c, 0xe0, 0x49, 0x83, 0xc4, 0x01, 0xe8, 0xf0, 0xe6, 0xff, 0xff, 
+    0x45, 0x39, 0x66, 0x08, 0x7f, 0xea, 0x49, 0x8b, 0x3e, 0x48, 0x85, 0xff, 
+    0x74, 0x05, 0xe8, 0xdd, 0xe6, 0xff, 0xff, 0x4c, 0x89, 0xf7, 0xe8, 0xd5, 
+    0xe6, 0xff, 0xff, 0x8b, 0x4d, 0x98, 0x48, 0x8b, 0x55, 0x90, 0x31, 0xf6, 
+    0x41, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0xae, 0xf3, 
+    0xff, 0xff, 0x48, 0x8b, 0x73, 0x10, 0x8b, 0x46, 0x0c, 0x44, 0x8d, 0x60, 
+    0xfe, 0x8b, 0x45, 0xc8, 0x85, 0xc0, 0x7e, 0x6b, 0x8d, 0x48, 0x01, 0x8b, 
+    0x46, 0x08, 0x48, 0x8b, 0xbd, 0x78, 0xff, 0xff, 0xff, 0x99, 0xf7, 0xf9, 
+    0x8b, 0x55, 0x84, 0x8d, 0x0c, 0x10, 0x4c, 0x89, 0xea, 0x0f, 0x1f, 0x00, 
+    0x89, 0x0a, 0x48, 0x83, 0xc2, 0x04, 0x01, 0xc1, 0x48, 0x39, 0xfa, 0x75, 
+    0xf3, 0x45, 0x31, 0xf6, 0xeb, 0x0a, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x48, 0x8b, 0x73, 0x10, 0x43, 0x8b, 0x54, 0xb5, 0x00, 0x0f, 0xb6, 0x7b, 
+    0x20, 0x31, 0xc9, 0x6a, 0x00, 0x44, 0x39, 0x75, 0x10, 0x0f, 0x94, 0xc1, 
+    0x51, 0x4f, 0x8b, 0x0c, 0xf7, 0x44, 0x89, 0xe1, 0x49, 0x83, 0xc6, 0x01, 
+    0x44, 0x8b, 0x45, 0xcc, 0xe8, 0xfb, 0xf1, 0xff, 0xff, 0x41, 0x58, 0x41, 
+    0x59, 0x4c, 0x39, 0x75, 0xc0, 0x75, 0xc9, 0x80, 0x7d, 0x9f, 0x00, 0x0f, 
+    0x84, 0x0f, 0x05, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0xb5, 
+    0x68, 0xff, 0xff, 0xff, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x31, 0xff, 0x8b, 
+    0x50, 0x08, 0xff, 0x53, 0x18, 0x8b, 0x4b, 0x28, 0xbf, 0x20, 0x00, 0x00, 
+    0x00, 0x49, 0x89, 0xc6, 0x48, 0x8b, 0x43, 0x10, 0x8b, 0x70, 0x0c, 0x8b, 
+    0x50, 0x08, 0x29, 0xf1, 0x89, 0x75, 0xa4, 0x89, 0x4d, 0xb8, 0x89, 0x55, 
+    0xa8, 0xe8, 0x2a, 0xe7, 0xff, 0xff, 0x8b, 0x4d, 0xb8, 0x8b, 0x75, 0xa4, 
+    0x48, 0x89, 0xdf, 0x4c, 0x89, 0x30, 0x8b, 0x55, 0xa8, 0x45, 0x31, 0xc9, 
+    0x45, 0x31, 0xc0, 0x83, 0xe9, 0x04, 0x83, 0xc6, 0x02, 0x48, 0x89, 0x45, 
+    0xb0, 0xe8, 0x86, 0xee, 0xff, 0xff, 0x48, 0x8b, 0x75, 0xb0, 0x8b, 0x4d, 
+    0xb8, 0x48, 0x89, 0xdf, 0x48, 0x89, 0x46, 0x08, 0x48, 0x8b, 0x85, 0x70, 
+    0xff, 0xff, 0xff, 0x48, 0x89, 0x46, 0x10, 0x8b, 0x45, 0xa0, 0x89, 0x46, 
+    0x18, 0x8d, 0x41, 0xfa, 0x89, 0x46, 0x1c, 0xe8, 0xec, 0xeb, 0xff, 0xff, 
+    0x48, 0x8b, 0x3d, 0xfd, 0x46, 0x00, 0x00, 0xe8, 0x30, 0xe6, 0xff, 0xff, 
+    0x4c, 0x89, 0x75, 0xa8, 0x31, 0xf6, 0x48, 0x89, 0xdf, 0xe8, 0x12, 0xf7, 
+    0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0xa2, 0x01, 0x00, 0x00, 0x48, 0x8b, 
+    0x3d, 0xdb, 0x46, 0x00, 0x00, 0xe8, 0xae, 0xe5, 0xff, 0xff, 0x89, 0xc1, 
+    0x3d, 0x04, 0x01, 0x00, 0x00, 0x0f, 0x84, 0x31, 0x02, 0x00, 0x00, 0x0f, 
+    0x8f, 0xb3, 0x01, 0x00, 0x00, 0x83, 0xf8, 0x09, 0x0f, 0x84, 0x82, 0x00, 
+    0x00, 0x00, 0x83, 0xf8, 0x0c, 0x0f, 0x85, 0xee, 0x00, 0x00, 0x00, 0xbe, 
+    0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x4c, 0x8b, 0x75, 0xa8, 0xe8, 
+    0xc8, 0xf6, 0xff, 0xff, 0x48, 0x8b, 0x45, 0xb0, 0x48, 0x85, 0xc0, 0x0f, 
+    0x84, 0x6b, 0x01, 0x00, 0x00, 0x8b, 0x40, 0x18, 0x4c, 0x8b, 0x63, 0x10, 
+    0x89, 0x45, 0xa0, 0x4d, 0x85, 0xe4, 0x0f, 0x85, 0xd0, 0xfd, 0xff, 0xff, 
+    0x48, 0x8b, 0x45, 0xb0, 0x4c, 0x8b, 0x60, 0x08, 0x4d, 0x85, 0xe4, 0x74, 
+    0x28, 0x48, 0x8b, 0x3d, 0x6c, 0x46, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0xfd, 
+    0xe4, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0xc5, 0xe7, 0xff, 0xff, 0x49, 
+    0x8b, 0x7c, 0x24, 0x18, 0xe8, 0xfb, 0xe4, 0xff, 0xff, 0x4c, 0x89, 0xe7, 
+    0xe8, 0xf3, 0xe4, 0xff, 0xff, 0x48, 0x8b, 0x7d, 0xb0, 0xe8, 0xea, 0xe4, 
+    0xff, 0xff, 0x4c, 0x8b, 0x7d, 0x88, 0xe9, 0xc8, 0xfd, 0xff, 0xff, 0x90, 
+    0x8b, 0x45, 0x10, 0x8b, 0x75, 0xc8, 0x45, 0x31, 0xf6, 0x83, 0xc0, 0x01, 
+    0x99, 0xf7, 0xfe, 0x89, 0x55, 0x10, 0x85, 0xf6, 0x7e, 0x4d, 0x89, 0x4d, 
+    0xa4, 0x44, 0x89, 0x65, 0xb8, 0x4d, 0x89, 0xf4, 0x41, 0x89, 0xd6, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x31, 0xc9, 0x45, 0x39, 0xe6, 0x43, 0x8b, 0x54, 
+    0xa5, 0x00, 0x48, 0x8b, 0x73, 0x10, 0x0f, 0x94, 0xc1, 0x0f, 0xb6, 0x7b, 
+    0x20, 0x6a, 0x00, 0x51, 0x4f, 0x8b, 0x0c, 0xe7, 0x49, 0x83, 0xc4, 0x01, 
+    0x44, 0x8b, 0x45, 0xcc, 0x8b, 0x4d, 0xb8, 0xe8, 0x3c, 0xf0, 0xff, 0xff, 
+    0x5e, 0x5f, 0x4c, 0x39, 0x65, 0xc0, 0x75, 0xcc, 0x44, 0x8b, 0x65, 0xb8, 
+    0x8b, 0x4d, 0xa4, 0x48, 0x8b, 0x3d, 0xce, 0x45, 0x00, 0x00, 0x89, 0x4d, 
+    0xb8, 0xe8, 0xfe, 0xe4, 0xff, 0xff, 0x8b, 0x4d, 0xb8, 0x48, 0x83, 0x7d, 
+    0xb0, 0x00, 0x0f, 0x84, 0x98, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x55, 0xb0, 
+    0x48, 0x8b, 0x02, 0x48, 0x8b, 0x52, 0x08, 0x8b, 0x52, 0x0c, 0x8b, 0x40, 
+    0x08, 0x83, 0xea, 0x01, 0x29, 0xd0, 0x81, 0xf9, 0x03, 0x01, 0x00, 0x00, 
+    0x0f, 0x84, 0x6e, 0x03, 0x00, 0x00, 0x0f, 0x8f, 0xac, 0x00, 0x00, 0x00, 
+    0x81, 0xf9, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x85, 0x64, 0x01, 0x00, 0x00, 
+    0x48, 0x8b, 0x4d, 0xb0, 0x8b, 0x51, 0x18, 0x39, 0xd0, 0x0f, 0x8e, 0x81, 
+    0xfe, 0xff, 0xff, 0x83, 0xc2, 0x01, 0x48, 0x89, 0xce, 0x48, 0x89, 0xdf, 
+    0x89, 0x51, 0x18, 0xe8, 0x4c, 0xea, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x5d, 
+    0x45, 0x00, 0x00, 0xe8, 0x90, 0xe4, 0xff, 0xff, 0x31, 0xf6, 0x48, 0x89, 
+    0xdf, 0xe8, 0x76, 0xf5, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x84, 0x64, 0xfe, 
+    0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x45, 0xb0, 
+    0x4c, 0x8b, 0x75, 0xa8, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x9c, 0xfe, 0xff, 
+    0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x8b, 0x63, 0x10, 
+    0x4d, 0x85, 0xe4, 0x0f, 0x85, 0x6b, 0xfc, 0xff, 0xff, 0xe9, 0xa5, 0xfc, 
+    0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x3d, 0x05, 0x01, 0x00, 
+    0x00, 0x0f, 0x84, 0xcd, 0xfe, 0xff, 0xff, 0x48, 0x83, 0x7d, 0xb0, 0x00, 
+    0x0f, 0x84, 0x06, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x75, 0xb0, 0x48, 0x8b, 
+    0x56, 0x08, 0x48, 0x8b, 0x06, 0x8b, 0x52, 0x0c, 0x8b, 0x40, 0x08, 0x83, 
+    0xea, 0x01, 0x29, 0xd0, 0x81, 0xf9, 0x52, 0x01, 0x00, 0x00, 0x0f, 0x85, 
+    0x70, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x7d, 0xb0, 0x8b, 0x57, 0x18, 0x39, 
+    0xc2, 0x0f, 0x8d, 0xd5, 0xfd, 0xff, 0xff, 0x03, 0x57, 0x1c, 0x48, 0x89, 
+    0xfe, 0x39, 0xc2, 0x0f, 0x4f, 0xd0, 0x89, 0x57, 0x18, 0x48, 0x89, 0xdf, 
+    0xe8, 0x9b, 0xe9, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0xac, 0x44, 0x00, 0x00, 
+    0xe8, 0xdf, 0xe3, 0xff, 0xff, 0xe9, 0xae, 0xfd, 0xff, 0xff, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x75, 0xc8, 0x8b, 
+    0x45, 0x10, 0x45, 0x31, 0xf6, 0x8d, 0x44, 0x06, 0xff, 0x99, 0xf7, 0xfe, 
+    0x89, 0x55, 0x10, 0x85, 0xf6, 0x7e, 0x4d, 0x44, 0x89, 0x65, 0xb8, 0x4d, 
+    0x89, 0xf4, 0x49, 0x89, 0xde, 0x89, 0xd3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x31, 0xc9, 0x44, 0x39, 0xe3, 0x43, 0x8b, 0x54, 0xa5, 0x00, 0x49, 0x8b, 
+    0x76, 0x10, 0x0f, 0x94, 0xc1, 0x41, 0x0f, 0xb6, 0x7e, 0x20, 0x6a, 0x00, 
+    0x51, 0x4f, 0x8b, 0x0c, 0xe7, 0x49, 0x83, 0xc4, 0x01, 0x8b, 0x4d, 0xb8, 
+    0x44, 0x8b, 0x45, 0xcc, 0xe8, 0x9b, 0xee, 0xff, 0xff, 0x5a, 0x59, 0x4c, 
+    0x39, 0x65, 0xc0, 0x75, 0xcb, 0x44, 0x8b, 0x65, 0xb8, 0x4c, 0x89, 0xf3, 
+    0x48, 0x8b, 0x3d, 0x2d, 0x44, 0x00, 0x00, 0xe8, 0x60, 0xe3, 0xff, 0xff, 
+    0xe9, 0x2f, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x00, 0x83, 0xf9, 0x0a, 0x0f, 
+    0x85, 0x23, 0xfd, 0xff, 0xff, 0x4c, 0x63, 0x7d, 0x10, 0x48, 0x8b, 0x7b, 
+    0x10, 0x44, 0x89, 0xe2, 0x8b, 0x4d, 0xcc, 0x4c, 0x8b, 0x75, 0xa8, 0x47, 
+    0x8b, 0x6c, 0xbd, 0x00, 0x44, 0x89, 0xee, 0xe8, 0xb0, 0xea, 0xff, 0xff, 
+    0x48, 0x8b, 0x45, 0x88, 0x48, 0x8b, 0x73, 0x10, 0x44, 0x89, 0xe1, 0x0f, 
+    0xb6, 0x7b, 0x20, 0x6a, 0x01, 0x44, 0x89, 0xea, 0x6a, 0x01, 0x4e, 0x8d, 
+    0x3c, 0xf8, 0x44, 0x8b, 0x45, 0xcc, 0x4d, 0x8b, 0x0f, 0xe8, 0x2a, 0xee, 
+    0xff, 0xff, 0x48, 0x8b, 0x3d, 0xcb, 0x43, 0x00, 0x00, 0xe8, 0xfe, 0xe2, 
+    0xff, 0xff, 0xbf, 0x48, 0xe8, 0x01, 0x00, 0xe8, 0x34, 0xe4, 0xff, 0xff, 
+    0x48, 0x8b, 0x7b, 0x10, 0x8b, 0x4d, 0xcc, 0x44, 0x89, 0xe2, 0x44, 0x89, 
+    0xee, 0xe8, 0x62, 0xea, 0xff, 0xff, 0x48, 0x8b, 0x73, 0x10, 0x0f, 0xb6, 
+    0x7b, 0x20, 0x6a, 0x00, 0x6a, 0x01, 0x4d, 0x8b, 0x0f, 0x44, 0x89, 0xea, 
+    0x44, 0x89, 0xe1, 0x44, 0x8b, 0x45, 0xcc, 0xe8, 0xe4, 0xed, 0xff, 0xff, 
+    0x48, 0x8b, 0x3d, 0x85, 0x43, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0xe8, 
+    0xb4, 0xe2, 0xff, 0xff, 0xbf, 0x48, 0xe8, 0x01, 0x00, 0xe8, 0xea, 0xe3, 
+    0xff, 0xff, 0x48, 0x8d, 0x15, 0xb9, 0x21, 0x00, 0x00, 0x48, 0x8d, 0x35, 
+    0x54, 0x22, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0xf4, 0xe5, 0xff, 0xff, 
+    0x4d, 0x85, 0xf6, 0x74, 0x3a, 0x41, 0x8b, 0x46, 0x08, 0x45, 0x31, 0xe4, 
+    0x85, 0xc0, 0x7e, 0x1a, 0x0f, 0x1f, 0x40, 0x00, 0x49, 0x8b, 0x06, 0x4a, 
+    0x8b, 0x3c, 0xe0, 0x49, 0x83, 0xc4, 0x01, 0xe8, 0xe0, 0xe1, 0xff, 0xff, 
+    0x45, 0x39, 0x66, 0x08, 0x7f, 0xea, 0x49, 0x8b, 0x3e, 0x48, 0x85, 0xff, 
+    0x74, 0x05, 0xe8, 0xcd, 0xe1, 0xff, 0xff, 0x4c, 0x89, 0xf7, 0xe8, 0xc5, 
+    0xe1, 0xff, 0xff, 0x48, 0x8b, 0x45, 0xb0, 0x48, 0x85, 0xc0, 0x74, 0x3a, 
+    0x4c, 0x8b, 0x60, 0x08, 0x4d, 0x85, 0xe4, 0x74, 0x28, 0x48, 0x8b, 0x3d, 
+    0x04, 0x43, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0x95, 0xe1, 0xff, 0xff, 0x4c, 
+    0x89, 0xe7, 0xe8, 0x5d, 0xe4, 0xff, 0xff, 0x49, 0x8b, 0x7c, 0x24, 0x18, 
+    0xe8, 0x93, 0xe1, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x8b, 0xe1, 0xff, 
+    0xff, 0x48, 0x8b, 0x7d, 0xb0, 0xe8, 0x82, 0xe1, 0xff, 0xff, 0x4c, 0x8b, 
+    0x63, 0x10, 0x4d, 0x85, 0xe4, 0x74, 0x28, 0x48, 0x8b, 0x3d, 0xca, 0x42, 
+    0x00, 0x00, 0x31, 0xf6, 0xe8, 0x5b, 0xe1, 0xff, 0xff, 0x4c, 0x89, 0xe7, 
+    0xe8, 0x23, 0xe4, 0xff, 0xff, 0x49, 0x8b, 0x7c, 0x24, 0x18, 0xe8, 0x59, 
+    0xe1, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x51, 0xe1, 0xff, 0xff, 0x48, 
+    0xc7, 0x43, 0x10, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0x9a, 0x42, 
+    0x00, 0x00, 0xe8, 0xcd, 0xe1, 0xff, 0xff, 0x8b, 0x45, 0x10, 0x48, 0x8d, 
+    0x65, 0xd8, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 
+    0xc3, 0x0f, 0x1f, 0x00, 0x48, 0xc7, 0x45, 0xb0, 0x00, 0x00, 0x00, 0x00, 
+    0x45, 0x31, 0xf6, 0xe9, 0x6c, 0xfb, 0xff, 0xff, 0x0f, 0x1f, 0x84, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x81, 0xf9, 0x53, 0x01, 0x00, 0x00, 0x0f, 0x85, 
+    0x68, 0xfb, 0xff, 0xff, 0x48, 0x8b, 0x4d, 0xb0, 0x8b, 0x41, 0x18, 0x85, 
+    0xc0, 0x0f, 0x8e, 0x59, 0xfb, 0xff, 0xff, 0x2b, 0x41, 0x1c, 0xba, 0x00, 
+    0x00, 0x00, 0x00, 0x48, 0x89, 0xce, 0x48, 0x89, 0xdf, 0x0f, 0x48, 0xc2, 
+    0x89, 0x41, 0x18, 0xe8, 0x1c, 0xe7, 0xff, 0xff, 0xe9, 0xfb, 0xfd, 0xff, 
+    0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x55, 0xb0, 
+    0x8b, 0x42, 0x18, 0x85, 0xc0, 0x0f, 0x8e, 0x25, 0xfb, 0xff, 0xff, 0x83, 
+    0xe8, 0x01, 0x48, 0x89, 0xdf, 0x48, 0x89, 0xd6, 0x89, 0x42, 0x18, 0xe8, 
+    0xf0, 0xe6, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x01, 0x42, 0x00, 0x00, 0xe8, 
+    0x34, 0xe1, 0xff, 0xff, 0xe9, 0x03, 0xfb, 0xff, 0xff, 0xc7, 0x45, 0xa0, 
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0x8b, 0x7d, 0x88, 0x45, 0x31, 0xf6, 0xe9, 
+    0x73, 0xf9, 0xff, 0xff, 0xc7, 0x45, 0x84, 0xfe, 0xff, 0xff, 0xff, 0xc7, 
+    0x45, 0xcc, 0x04, 0x00, 0x00, 0x00, 0xe9, 0xce, 0xf8, 0xff, 0xff, 0x66, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x41, 0x89, 0xc9, 
+    0x31, 0xc9, 0x48, 0x89, 0xe5, 0x48, 0x83, 0xec, 0x08, 0x41, 0x50, 0x49, 
+    0x89, 0xd0, 0x31, 0xd2, 0xe8, 0x07, 0xf8, 0xff, 0xff, 0xc9, 0xc3, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x55, 0x89, 0xf0, 0x48, 0x8d, 0x0d, 0x10, 0x20, 
+    0x00, 0x00, 0x48, 0x89, 0xd6, 0x48, 0x8d, 0x15, 0x0a, 0x20, 0x00, 0x00, 
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x41, 0xb9, 0x02, 0x00, 0x00, 0x00, 0x66, 
+    0x48, 0x0f, 0x6e, 0xca, 0x48, 0x89, 0xe5, 0x48, 0x83, 0xec, 0x18, 0x66, 
+    0x0f, 0x6c, 0xc1, 0x85, 0xc0, 0x0f, 0x94, 0xc0, 0x0f, 0x29, 0x45, 0xf0, 
+    0x31, 0xc9, 0x31, 0xd2, 0x0f, 0xb6, 0xc0, 0x4c, 0x8d, 0x45, 0xf0, 0x50, 
+    0xe8, 0xb7, 0xf7, 0xff, 0xff, 0x5a, 0x59, 0xc9, 0x85, 0xc0, 0x0f, 0x94, 
+    0xc0, 0x0f, 0xb6, 0xc0, 0xc3, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x48, 0x8d, 0x05, 0xb6, 0x1f, 0x00, 0x00, 
+    0x66, 0x48, 0x0f, 0x6e, 0xc8, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x49, 0x89, 
+    0xf7, 0x41, 0x56, 0x41, 0x55, 0x49, 0x89, 0xd5, 0x41, 0x54, 0x53, 0x48, 
+    0x8d, 0x1d, 0x94, 0x1f, 0x00, 0x00, 0x66, 0x48, 0x0f, 0x6e, 0xc3, 0x66, 
+    0x0f, 0x6c, 0xc1, 0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7d, 0x98, 0x48, 
+    0x89, 0xd7, 0x0f, 0x29, 0x45, 0xc0, 0xe8, 0xfd, 0xdf, 0xff, 0xff, 0x8d, 
+    0xb8, 0x01, 0x01, 0x00, 0x00, 0x48, 0x89, 0xc3, 0x48, 0x63, 0xff, 0xe8, 
+    0xcc, 0xe0, 0xff, 0xff, 0x8d, 0xb3, 0x00, 0x01, 0x00, 0x00, 0x4c, 0x89, 
+    0xe9, 0x48, 0x8d, 0x15, 0x04, 0x20, 0x00, 0x00, 0x48, 0x89, 0xc7, 0x48, 
+    0x63, 0xf6, 0x49, 0x89, 0xc4, 0x31, 0xc0, 0xe8, 0xec, 0xdf, 0xff, 0xff, 
+    0x48, 0x8d, 0x3d, 0x33, 0x1f, 0x00, 0x00, 0xe8, 0x00, 0xe1, 0xff, 0xff, 
+    0x41, 0x8b, 0x0f, 0x48, 0x89, 0x45, 0xb8, 0x85, 0xc9, 0x0f, 0x8e, 0x0b, 
+    0x01, 0x00, 0x00, 0x4c, 0x89, 0x65, 0x90, 0x45, 0x31, 0xf6, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x8b, 0x57, 0x08, 
+    0x4b, 0x8d, 0x04, 0xb6, 0x4c, 0x8d, 0x24, 0xc2, 0x41, 0x83, 0x3c, 0x24, 
+    0x05, 0x0f, 0x87, 0xd2, 0x00, 0x00, 0x00, 0x41, 0x8b, 0x04, 0x24, 0x48, 
+    0x8d, 0x0d, 0x7a, 0x20, 0x00, 0x00, 0x48, 0x63, 0x04, 0x81, 0x48, 0x01, 
+    0xc8, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x4d, 0x8b, 0x6c, 0x24, 
+    0x08, 0x4c, 0x89, 0xef, 0xe8, 0x63, 0xdf, 0xff, 0xff, 0x8d, 0x78, 0x41, 
+    0x49, 0x89, 0xc4, 0x48, 0x63, 0xff, 0xe8, 0x35, 0xe0, 0xff, 0xff, 0x41, 
+    0x8d, 0x74, 0x24, 0x40, 0x4c, 0x89, 0xe9, 0x48, 0x8d, 0x15, 0xf6, 0x1e, 
+    0x00, 0x00, 0x48, 0x89, 0xc3, 0x48, 0x89, 0xc7, 0x48, 0x63, 0xf6, 0x31, 
+    0xc0, 0xe8, 0x56, 0xdf, 0xff, 0xff, 0x48, 0x85, 0xdb, 0x74, 0x7a, 0x48, 
+    0x8b, 0x7d, 0xb8, 0xe8, 0x28, 0xdf, 0xff, 0xff, 0x48, 0x89, 0xdf, 0x49, 
+    0x89, 0xc5, 0xe8, 0x1d, 0xdf, 0xff, 0xff, 0x46, 0x8d, 0x04, 0x28, 0x48, 
+    0x89, 0x45, 0xa8, 0x41, 0x8d, 0x78, 0x02, 0x44, 0x89, 0x45, 0xb0, 0x48, 
+    0x63, 0xff, 0xe8, 0xe5, 0xdf, 0xff, 0xff, 0x49, 0x63, 0xd5, 0x4c, 0x8b, 
+    0x6d, 0xb8, 0xc6, 0x00, 0x00, 0x48, 0x89, 0xc7, 0x49, 0x89, 0xc4, 0x4c, 
+    0x89, 0xee, 0xe8, 0x5d, 0xdf, 0xff, 0xff, 0x48, 0x8b, 0x4d, 0xa8, 0x48, 
+    0x89, 0xde, 0x4c, 0x89, 0xe7, 0x48, 0x63, 0xd1, 0xe8, 0x4b, 0xdf, 0xff, 
+    0xff, 0x48, 0x63, 0x45, 0xb0, 0x0f, 0xb7, 0x35, 0xf4, 0x1f, 0x00, 0x00, 
+    0x48, 0x89, 0xdf, 0x66, 0x41, 0x89, 0x34, 0x04, 0xe8, 0x73, 0xde, 0xff, 
+    0xff, 0x4c, 0x89, 0xef, 0xe8, 0x6b, 0xde, 0xff, 0xff, 0x4c, 0x89, 0x65, 
+    0xb8, 0x49, 0x83, 0xc6, 0x01, 0x45, 0x39, 0x37, 0x0f, 0x8f, 0x0a, 0xff, 
+    0xff, 0xff, 0x4c, 0x8b, 0x65, 0x90, 0x48, 0x83, 0xec, 0x08, 0x4c, 0x8d, 
+    0x45, 0xc0, 0x4c, 0x89, 0xe6, 0x41, 0xb9, 0x02, 0x00, 0x00, 0x00, 0x6a, 
+    0x00, 0x4c, 0x8b, 0x7d, 0xb8, 0x48, 0x8d, 0x15, 0x4d, 0x1e, 0x00, 0x00, 
+    0x48, 0x8b, 0x7d, 0x98, 0x4c, 0x89, 0xf9, 0xe8, 0xdc, 0xf5, 0xff, 0xff, 
+    0x4c, 0x89, 0xe7, 0x89, 0xc3, 0xe8, 0x22, 0xde, 0xff, 0xff, 0x4c, 0x89, 
+    0xff, 0xe8, 0x1a, 0xde, 0xff, 0xff, 0x58, 0x31, 0xc0, 0x85, 0xdb, 0x0f, 
+    0x94, 0xc0, 0x5a, 0x48, 0x8d, 0x65, 0xd8, 0x5b, 0x41, 0x5c, 0x41, 0x5d, 
+    0x41, 0x5e, 0x41, 0x5f, 0x5d, 0xc3, 0x66, 0x90, 0x4d, 0x8b, 0x6c, 0x24, 
+    0x08, 0x4c, 0x89, 0xef, 0xe8, 0x43, 0xde, 0xff, 0xff, 0x8d, 0x78, 0x41, 
+    0x49, 0x89, 0xc4, 0x48, 0x63, 0xff, 0xe8, 0x15, 0xdf, 0xff, 0xff, 0x41, 
+    0x8d, 0x74, 0x24, 0x40, 0x4c, 0x89, 0xe9, 0x48, 0x8d, 0x15, 0xc0, 0x1d, 
+    0x00, 0x00, 0x48, 0x89, 0xc3, 0x48, 0x89, 0xc7, 0x48, 0x63, 0xf6, 0x31, 
+    0xc0, 0xe8, 0x36, 0xde, 0xff, 0xff, 0xe9, 0xdb, 0xfe, 0xff, 0xff, 0x90, 
+    0x4d, 0x8b, 0x6c, 0x24, 0x08, 0x4c, 0x89, 0xef, 0xe8, 0x03, 0xde, 0xff, 
+    0xff, 0x4d, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc3, 0x4c, 0x89, 0xc7, 
+    0x4c, 0x89, 0x45, 0xb0, 0xe8, 0xef, 0xdd, 0xff, 0xff, 0x44, 0x8d, 0x24, 
+    0x03, 0x41, 0x8d, 0x7c, 0x24, 0x41, 0x48, 0x63, 0xff, 0xe8, 0xbe, 0xde, 
+    0xff, 0xff, 0x41, 0x8d, 0x74, 0x24, 0x40, 0x4c, 0x8b, 0x45, 0xb0, 0x4c, 
+    0x89, 0xe9, 0x48, 0x89, 0xc3, 0x48, 0x89, 0xc7, 0x48, 0x63, 0xf6, 0x31, 
+    0xc0, 0x48, 0x8d, 0x15, 0x98, 0x1e, 0x00, 0x00, 0xe8, 0xdb, 0xdd, 0xff, 
+    0xff, 0xe9, 0x80, 0xfe, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x4d, 0x8b, 0x6c, 0x24, 0x08, 0x4c, 0x89, 0xef, 0xe8, 0xa3, 0xdd, 0xff, 
+    0xff, 0x8d, 0x78, 0x41, 0x49, 0x89, 0xc4, 0x48, 0x63, 0xff, 0xe8, 0x75, 
+    0xde, 0xff, 0xff, 0x41, 0x8d, 0x74, 0x24, 0x40, 0x4c, 0x89, 0xe9, 0x48, 
+    0x8d, 0x15, 0x07, 0x1d, 0x00, 0x00, 0x48, 0x89, 0xc3, 0x48, 0x89, 0xc7, 
+    0x48, 0x63, 0xf6, 0x31, 0xc0, 0xe8, 0x96, 0xdd, 0xff, 0xff, 0xe9, 0x3b, 
+    0xfe, 0xff, 0xff, 0x90, 0xbf, 0x0a, 0x00, 0x00, 0x00, 0x41, 0x8b, 0x5c, 
+    0x24, 0x20, 0xe8, 0x41, 0xde, 0xff, 0xff, 0x49, 0x89, 0xc5, 0x48, 0xb8, 
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x49, 0x89, 0x45, 0x00, 
+    0x41, 0xc6, 0x45, 0x08, 0x2d, 0xf6, 0xc7, 0x01, 0x74, 0x05, 0x41, 0xc6, 
+    0x45, 0x00, 0x72, 0xf6, 0xc3, 0x80, 0x74, 0x05, 0x41, 0xc6, 0x45, 0x01, 
+    0x77, 0xf6, 0xc3, 0x40, 0x74, 0x05, 0x41, 0xc6, 0x45, 0x02, 0x78, 0xf6, 
+    0xc3, 0x20, 0x74, 0x05, 0x41, 0xc6, 0x45, 0x03, 0x72, 0xf6, 0xc3, 0x10, 
+    0x74, 0x05, 0x41, 0xc6, 0x45, 0x04, 0x77, 0xf6, 0xc3, 0x08, 0x74, 0x05, 
+    0x41, 0xc6, 0x45, 0x05, 0x78, 0xf6, 0xc3, 0x04, 0x74, 0x05, 0x41, 0xc6, 
+    0x45, 0x06, 0x72, 0xf6, 0xc3, 0x02, 0x74, 0x05, 0x41, 0xc6, 0x45, 0x07, 
+    0x77, 0x83, 0xe3, 0x01, 0x74, 0x05, 0x41, 0xc6, 0x45, 0x08, 0x78, 0x41, 
+    0xc6, 0x45, 0x09, 0x00, 0x49, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xc7, 
+    0x48, 0x89, 0x45, 0xb0, 0xe8, 0xdb, 0xdc, 0xff, 0xff, 0x48, 0x89, 0x45, 
+    0xa0, 0x49, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0x48, 0x89, 0x45, 
+    0xa8, 0xe8, 0xc6, 0xdc, 0xff, 0xff, 0x4c, 0x89, 0xef, 0x48, 0x89, 0xc3, 
+    0xe8, 0xbb, 0xdc, 0xff, 0xff, 0x48, 0x8b, 0x55, 0xa0, 0x49, 0x8b, 0x7c, 
+    0x24, 0x18, 0x8d, 0x74, 0x1a, 0x40, 0x01, 0xc6, 0x48, 0x85, 0xff, 0x74, 
+    0x0f, 0x89, 0x75, 0xa0, 0xe8, 0x9f, 0xdc, 0xff, 0xff, 0x8b, 0x75, 0xa0, 
+    0x8d, 0x74, 0x06, 0x40, 0x8d, 0x7e, 0x01, 0x89, 0x75, 0xa0, 0x48, 0x63, 
+    0xff, 0xe8, 0x6a, 0xdd, 0xff, 0xff, 0x48, 0x63, 0x75, 0xa0, 0x4c, 0x8b, 
+    0x45, 0xa8, 0x4d, 0x89, 0xe9, 0x48, 0x8b, 0x4d, 0xb0, 0x48, 0x89, 0xc7, 
+    0x48, 0x8d, 0x15, 0xf1, 0x1c, 0x00, 0x00, 0x48, 0x89, 0xc3, 0x31, 0xc0, 
+    0xe8, 0x87, 0xdc, 0xff, 0xff, 0x4c, 0x89, 0xef, 0xe8, 0x0f, 0xdc, 0xff, 
+    0xff, 0x4d, 0x8b, 0x6c, 0x24, 0x18, 0x4d, 0x85, 0xed, 0x0f, 0x84, 0x1b, 
+    0xfd, 0xff, 0xff, 0x4c, 0x89, 0xef, 0xe8, 0x49, 0xdc, 0xff, 0xff, 0x48, 
+    0x89, 0xdf, 0x49, 0x89, 0xc4, 0xe8, 0x3e, 0xdc, 0xff, 0xff, 0x41, 0x8d, 
+    0x74, 0x24, 0x40, 0x4c, 0x89, 0xe9, 0x48, 0x8d, 0x15, 0xe7, 0x1c, 0x00, 
+    0x00, 0x48, 0x8d, 0x3c, 0x03, 0x48, 0x63, 0xf6, 0x31, 0xc0, 0xe8, 0x41, 
+    0xdc, 0xff, 0xff, 0xe9, 0xeb, 0xfc, 0xff, 0xff, 0x66, 0x66, 0x2e, 0x0f, 
+    0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x55, 0x48, 0x89, 0xe5, 
+    0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x53, 0x48, 0x81, 0xec, 
+    0x68, 0x04, 0x00, 0x00, 0x48, 0x89, 0xbd, 0xb8, 0xfb, 0xff, 0xff, 0x4c, 
+    0x8b, 0xaf, 0xb8, 0x04, 0x00, 0x00, 0x48, 0x89, 0xb5, 0x80, 0xfb, 0xff, 
+    0xff, 0x48, 0x85, 0xd2, 0x0f, 0x84, 0x79, 0x07, 0x00, 0x00, 0x4c, 0x89, 
+    0xef, 0x49, 0x89, 0xf6, 0x31, 0xf6, 0x48, 0x89, 0xd3, 0xe8, 0xfe, 0xec, 
+    0xff, 0xff, 0x41, 0x80, 0x7d, 0x20, 0x01, 0x48, 0x89, 0xdf, 0x19, 0xc0, 
+    0x25, 0x00, 0xfc, 0x03, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x89, 0x85, 
+    0x8c, 0xfb, 0xff, 0xff, 0xe8, 0xaf, 0xdb, 0xff, 0xff, 0x44, 0x8d, 0x78, 
+    0x02, 0x83, 0xc0, 0x03, 0x48, 0x63, 0xf8, 0x44, 0x89, 0xbd, 0x88, 0xfb, 
+    0xff, 0xff, 0x89, 0x85, 0x7c, 0xfb, 0xff, 0xff, 0xe8, 0x73, 0xdc, 0xff, 
+    0xff, 0x48, 0x89, 0xd9, 0x49, 0x63, 0xf7, 0x48, 0x8d, 0x15, 0x60, 0x1b, 
+    0x00, 0x00, 0x48, 0x89, 0xc7, 0x48, 0x89, 0x85, 0x90, 0xfb, 0xff, 0xff, 
+    0x31, 0xc0, 0xe8, 0x95, 0xdb, 0xff, 0xff, 0x48, 0x8d, 0xbd, 0xd0, 0xfb, 
+    0xff, 0xff, 0xb9, 0x80, 0x00, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x89, 0xbd, 
+    0xa8, 0xfb, 0xff, 0xff, 0x48, 0x89, 0xfb, 0xf3, 0x48, 0xab, 0x4d, 0x85, 
+    0xf6, 0x74, 0x15, 0xba, 0x00, 0x04, 0x00, 0x00, 0x4c, 0x89, 0xf6, 0x48, 
+    0x89, 0xdf, 0xe8, 0x05, 0xdb, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x49, 0x8b, 0x5d, 0x10, 0x48, 0x85, 0xdb, 0x74, 0x2f, 0x48, 0x8b, 0x3d, 
+    0x38, 0x3c, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0xc9, 0xda, 0xff, 0xff, 0x48, 
+    0x89, 0xdf, 0xe8, 0x91, 0xdd, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x18, 0xe8, 
+    0xc8, 0xda, 0xff, 0xff, 0x48, 0x89, 0xdf, 0xe8, 0xc0, 0xda, 0xff, 0xff, 
+    0x49, 0xc7, 0x45, 0x10, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x85, 0x80, 
+    0xfb, 0xff, 0xff, 0xbb, 0x20, 0x00, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 
+    0x15, 0x48, 0x89, 0xc7, 0xe8, 0xef, 0xda, 0xff, 0xff, 0x8d, 0x1c, 0x00, 
+    0xb8, 0x20, 0x00, 0x00, 0x00, 0x39, 0xc3, 0x0f, 0x4c, 0xd8, 0x45, 0x8b, 
+    0x7d, 0x24, 0x48, 0x8b, 0xb5, 0x90, 0xfb, 0xff, 0xff, 0xb9, 0x01, 0x00, 
+    0x00, 0x00, 0x31, 0xff, 0x45, 0x8d, 0x67, 0xfc, 0x44, 0x89, 0xe2, 0x41, 
+    0xff, 0x55, 0x18, 0x49, 0x89, 0xc6, 0x8b, 0x85, 0x88, 0xfb, 0xff, 0xff, 
+    0x8d, 0x44, 0x18, 0x01, 0x44, 0x39, 0xe0, 0x0f, 0x8c, 0x17, 0x05, 0x00, 
+    0x00, 0x41, 0x8b, 0x46, 0x08, 0x41, 0x8b, 0x55, 0x24, 0x45, 0x31, 0xc9, 
+    0x4c, 0x89, 0xef, 0x41, 0xb8, 0x00, 0x02, 0x00, 0x00, 0x44, 0x8d, 0x60, 
+    0x01, 0x8d, 0x48, 0x03, 0x83, 0xea, 0x02, 0x8d, 0x70, 0x06, 0x41, 0x8b, 
+    0x45, 0x28, 0x44, 0x89, 0xa5, 0xc4, 0xfb, 0xff, 0xff, 0x29, 0xf0, 0x48, 
+    0x63, 0xf0, 0xc1, 0xf8, 0x1f, 0x48, 0x69, 0xf6, 0x56, 0x55, 0x55, 0x55, 
+    0x48, 0xc1, 0xee, 0x20, 0x29, 0xc6, 0x83, 0xc6, 0x01, 0xe8, 0xc6, 0xe2, 
+    0xff, 0xff, 0x4c, 0x89, 0xf2, 0x44, 0x89, 0xe6, 0x49, 0x89, 0x45, 0x10, 
+    0x48, 0x89, 0xc7, 0xe8, 0x24, 0xe5, 0xff, 0xff, 0xc7, 0x85, 0xcc, 0xfb, 
+    0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x41, 0x8b, 0x56, 0x08, 0x45, 0x31, 
+    0xe4, 0x85, 0xd2, 0x7e, 0x1d, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+    0x49, 0x8b, 0x06, 0x4a, 0x8b, 0x3c, 0xe0, 0x49, 0x83, 0xc4, 0x01, 0xe8, 
+    0xd8, 0xd9, 0xff, 0xff, 0x45, 0x39, 0x66, 0x08, 0x7f, 0xea, 0x49, 0x8b, 
+    0x3e, 0x48, 0x85, 0xff, 0x74, 0x05, 0xe8, 0xc5, 0xd9, 0xff, 0xff, 0x4c, 
+    0x89, 0xf7, 0xe8, 0xbd, 0xd9, 0xff, 0xff, 0x41, 0x83, 0xef, 0x06, 0xbf, 
+    0x01, 0x00, 0x00, 0x00, 0x41, 0x39, 0xdf, 0x41, 0x0f, 0x4e, 0xdf, 0x89, 
+    0x9d, 0xb4, 0xfb, 0xff, 0xff, 0x41, 0x89, 0xde, 0xe8, 0xbf, 0xd9, 0xff, 
+    0xff, 0x48, 0x8b, 0xbd, 0xa8, 0xfb, 0xff, 0xff, 0xe8, 0xe3, 0xd9, 0xff, 
+    0xff, 0x8b, 0x8d, 0xcc, 0xfb, 0xff, 0xff, 0x44, 0x8b, 0xa5, 0xc4, 0xfb, 
+    0xff, 0xff, 0x89, 0x85, 0xc8, 0xfb, 0xff, 0xff, 0x48, 0x89, 0xc3, 0x49, 
+    0x8b, 0x45, 0x10, 0x03, 0x08, 0x44, 0x03, 0x60, 0x04, 0x41, 0x8d, 0x46, 
+    0xff, 0x41, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x89, 0x8d, 0xcc, 0xfb, 0xff, 
+    0xff, 0x89, 0x85, 0xc4, 0xfb, 0xff, 0xff, 0x8b, 0x85, 0xc4, 0xfb, 0xff, 
+    0xff, 0x89, 0xde, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x29, 0xc6, 0x0f, 0x49, 
+    0xce, 0x41, 0x89, 0xcf, 0x45, 0x85, 0xf6, 0x0f, 0x85, 0x89, 0x01, 0x00, 
+    0x00, 0x8b, 0x95, 0xcc, 0xfb, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x8a, 0x3a, 
+    0x00, 0x00, 0x44, 0x89, 0xe6, 0x44, 0x29, 0xfa, 0x01, 0xda, 0xe8, 0x75, 
+    0xda, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x76, 0x3a, 0x00, 0x00, 0xe8, 0xa9, 
+    0xd9, 0xff, 0xff, 0x31, 0xf6, 0x4c, 0x89, 0xef, 0xe8, 0x8f, 0xea, 0xff, 
+    0xff, 0x41, 0x89, 0xc6, 0x85, 0xc0, 0x0f, 0x85, 0x14, 0xfe, 0xff, 0xff, 
+    0x48, 0x8b, 0x3d, 0x55, 0x3a, 0x00, 0x00, 0xe8, 0x28, 0xd9, 0xff, 0xff, 
+    0x41, 0x89, 0xc7, 0x3d, 0x05, 0x01, 0x00, 0x00, 0x0f, 0x84, 0x3a, 0x03, 
+    0x00, 0x00, 0x0f, 0x8f, 0xc4, 0x02, 0x00, 0x00, 0x83, 0xf8, 0x0c, 0x0f, 
+    0x84, 0x4b, 0x03, 0x00, 0x00, 0x3d, 0x04, 0x01, 0x00, 0x00, 0x0f, 0x85, 
+    0x5b, 0x02, 0x00, 0x00, 0x85, 0xdb, 0x7e, 0x0c, 0x83, 0xeb, 0x01, 0x41, 
+    0xbe, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x00, 0xe8, 0x7b, 0xda, 0xff, 
+    0xff, 0x48, 0x89, 0xc2, 0x49, 0x63, 0xc7, 0x48, 0x8b, 0x12, 0xf6, 0x44, 
+    0x42, 0x01, 0x40, 0x74, 0x10, 0x81, 0xbd, 0xc8, 0xfb, 0xff, 0xff, 0xfe, 
+    0x03, 0x00, 0x00, 0x0f, 0x8e, 0xfb, 0x03, 0x00, 0x00, 0x48, 0x8b, 0x85, 
+    0xb8, 0xfb, 0xff, 0xff, 0x8b, 0x40, 0x10, 0x85, 0xc0, 0x0f, 0x85, 0x89, 
+    0x00, 0x00, 0x00, 0x41, 0x83, 0xff, 0x0a, 0x0f, 0x85, 0x22, 0xff, 0xff, 
+    0xff, 0x49, 0x8b, 0x5d, 0x10, 0x48, 0x85, 0xdb, 0x74, 0x27, 0x48, 0x8b, 
+    0x3d, 0xc7, 0x39, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0x58, 0xd8, 0xff, 0xff, 
+    0x48, 0x89, 0xdf, 0xe8, 0x20, 0xdb, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x18, 
+    0xe8, 0x57, 0xd8, 0xff, 0xff, 0x48, 0x89, 0xdf, 0xe8, 0x4f, 0xd8, 0xff, 
+    0xff, 0x49, 0xc7, 0x45, 0x10, 0x00, 0x00, 0x00, 0x00, 0x31, 0xff, 0xe8, 
+    0x60, 0xd8, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x91, 0x39, 0x00, 0x00, 0xe8, 
+    0xc4, 0xd8, 0xff, 0xff, 0x48, 0x8b, 0xbd, 0x90, 0xfb, 0xff, 0xff, 0xe8, 
+    0x28, 0xd8, 0xff, 0xff, 0x48, 0x8b, 0xbd, 0xa8, 0xfb, 0xff, 0xff, 0xe8, 
+    0xac, 0xd9, 0xff, 0xff, 0x48, 0x81, 0xc4, 0x68, 0x04, 0x00, 0x00, 0x5b, 
+    0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 0xc3, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x8b, 0x45, 0x10, 
+    0x45, 0x89, 0xf9, 0x45, 0x89, 0xf8, 0x89, 0xd9, 0x48, 0x8d, 0x15, 0x1c, 
+    0x18, 0x00, 0x00, 0x8b, 0x78, 0x04, 0x8b, 0x30, 0x31, 0xc0, 0xe8, 0xe1, 
+    0xd8, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x32, 0x39, 0x00, 0x00, 0xe8, 0x35, 
+    0xd9, 0xff, 0xff, 0x41, 0x83, 0xff, 0x0a, 0x0f, 0x84, 0x4c, 0xff, 0xff, 
+    0xff, 0x8b, 0x85, 0xc4, 0xfb, 0xff, 0xff, 0x89, 0xde, 0xb9, 0x00, 0x00, 
+    0x00, 0x00, 0x29, 0xc6, 0x0f, 0x49, 0xce, 0x41, 0x89, 0xcf, 0x8b, 0x85, 
+    0xcc, 0xfb, 0xff, 0xff, 0x8b, 0x8d, 0xb4, 0xfb, 0xff, 0xff, 0x8d, 0x14, 
+    0x01, 0x41, 0x89, 0xc6, 0x89, 0x95, 0xc0, 0xfb, 0xff, 0xff, 0x44, 0x89, 
+    0xfa, 0x29, 0xc2, 0x85, 0xc9, 0x0f, 0x8e, 0x91, 0x00, 0x00, 0x00, 0x89, 
+    0xb5, 0xb0, 0xfb, 0xff, 0xff, 0x44, 0x89, 0xbd, 0xa4, 0xfb, 0xff, 0xff, 
+    0x44, 0x8b, 0xbd, 0xc0, 0xfb, 0xff, 0xff, 0x4c, 0x89, 0xad, 0x98, 0xfb, 
+    0xff, 0xff, 0x44, 0x8b, 0xad, 0x8c, 0xfb, 0xff, 0xff, 0x89, 0x9d, 0xa0, 
+    0xfb, 0xff, 0xff, 0x44, 0x89, 0xf3, 0x41, 0x89, 0xd6, 0x0f, 0x1f, 0x00, 
+    0x48, 0x8b, 0x3d, 0xb1, 0x38, 0x00, 0x00, 0x89, 0xda, 0x44, 0x89, 0xe6, 
+    0xe8, 0x9f, 0xd8, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x28, 0x41, 0x8d, 
+    0x04, 0x1e, 0x48, 0x8b, 0x3d, 0x97, 0x38, 0x00, 0x00, 0x48, 0x98, 0x0f, 
+    0xbe, 0xb4, 0x05, 0xd0, 0xfb, 0xff, 0xff, 0xb8, 0x20, 0x00, 0x00, 0x00, 
+    0x40, 0x84, 0xf6, 0x0f, 0x44, 0xf0, 0x44, 0x09, 0xee, 0xe8, 0x92, 0xd8, 
+    0xff, 0xff, 0x83, 0xc3, 0x01, 0x41, 0x39, 0xdf, 0x75, 0xba, 0x8b, 0xb5, 
+    0xb0, 0xfb, 0xff, 0xff, 0x44, 0x8b, 0xbd, 0xa4, 0xfb, 0xff, 0xff, 0x8b, 
+    0x9d, 0xa0, 0xfb, 0xff, 0xff, 0x4c, 0x8b, 0xad, 0x98, 0xfb, 0xff, 0xff, 
+    0x8b, 0x85, 0xcc, 0xfb, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x4b, 0x38, 0x00, 
+    0x00, 0x8d, 0x50, 0xff, 0x85, 0xf6, 0x0f, 0x8e, 0x18, 0x02, 0x00, 0x00, 
+    0x44, 0x89, 0xe6, 0xe8, 0x30, 0xd8, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 
+    0x16, 0x49, 0x8b, 0x45, 0x10, 0x48, 0x8b, 0x3d, 0x28, 0x38, 0x00, 0x00, 
+    0x8b, 0x70, 0x10, 0x83, 0xce, 0x3c, 0xe8, 0x35, 0xd8, 0xff, 0xff, 0x8b, 
+    0x85, 0xc4, 0xfb, 0xff, 0xff, 0x8b, 0x8d, 0xc8, 0xfb, 0xff, 0xff, 0x44, 
+    0x89, 0xe6, 0x48, 0x8b, 0x3d, 0x07, 0x38, 0x00, 0x00, 0x8b, 0x95, 0xc0, 
+    0xfb, 0xff, 0xff, 0x44, 0x01, 0xf8, 0x39, 0xc8, 0x0f, 0x8d, 0x26, 0x01, 
+    0x00, 0x00, 0xe8, 0xe9, 0xd7, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x0f, 0x84, 
+    0x51, 0xfd, 0xff, 0xff, 0x49, 0x8b, 0x45, 0x10, 0x48, 0x8b, 0x3d, 0xdd, 
+    0x37, 0x00, 0x00, 0x8b, 0x70, 0x10, 0x83, 0xce, 0x3e, 0xe8, 0xea, 0xd7, 
+    0xff, 0xff, 0xe9, 0x36, 0xfd, 0xff, 0xff, 0x83, 0xf8, 0x08, 0x0f, 0x85, 
+    0xac, 0xfd, 0xff, 0xff, 0x85, 0xdb, 0x0f, 0x8e, 0xa4, 0xfd, 0xff, 0xff, 
+    0x39, 0x9d, 0xc8, 0xfb, 0xff, 0xff, 0x7c, 0x24, 0x8b, 0x95, 0xc8, 0xfb, 
+    0xff, 0xff, 0x48, 0x8b, 0x8d, 0xa8, 0xfb, 0xff, 0xff, 0x48, 0x63, 0xc3, 
+    0x29, 0xda, 0x48, 0x8d, 0x34, 0x01, 0x48, 0x8d, 0x7c, 0x01, 0xff, 0x48, 
+    0x83, 0xc2, 0x01, 0xe8, 0x78, 0xd7, 0xff, 0xff, 0x83, 0xad, 0xc8, 0xfb, 
+    0xff, 0xff, 0x01, 0x83, 0xeb, 0x01, 0x41, 0xbe, 0x01, 0x00, 0x00, 0x00, 
+    0xe9, 0x63, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x00, 0x3d, 0x07, 0x01, 0x00, 
+    0x00, 0x74, 0xad, 0x3d, 0x4a, 0x01, 0x00, 0x00, 0x0f, 0x85, 0x4e, 0xfd, 
+    0xff, 0xff, 0x39, 0x9d, 0xc8, 0xfb, 0xff, 0xff, 0x0f, 0x85, 0xa2, 0x01, 
+    0x00, 0x00, 0xe8, 0xbd, 0xd7, 0xff, 0xff, 0x48, 0x89, 0xc2, 0x49, 0x63, 
+    0xc7, 0x48, 0x8b, 0x12, 0xf6, 0x44, 0x42, 0x01, 0x40, 0x0f, 0x84, 0x4e, 
+    0xfd, 0xff, 0xff, 0x81, 0xbd, 0xc8, 0xfb, 0xff, 0xff, 0xfe, 0x03, 0x00, 
+    0x00, 0x0f, 0x8f, 0x3e, 0xfd, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x84, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x63, 0xc3, 0x83, 0x85, 0xc8, 0xfb, 0xff, 
+    0xff, 0x01, 0x83, 0xc3, 0x01, 0x41, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x44, 
+    0x88, 0xbc, 0x05, 0xd0, 0xfb, 0xff, 0xff, 0xe9, 0x15, 0xfd, 0xff, 0xff, 
+    0x39, 0x9d, 0xc8, 0xfb, 0xff, 0xff, 0x7e, 0xa6, 0x83, 0xc3, 0x01, 0x41, 
+    0xbe, 0x01, 0x00, 0x00, 0x00, 0xe9, 0xda, 0xfc, 0xff, 0xff, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 
+    0x00, 0x4c, 0x89, 0xef, 0xe8, 0x03, 0xe7, 0xff, 0xff, 0xe9, 0x8e, 0xfa, 
+    0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0xe8, 0xc3, 0xd6, 0xff, 
+    0xff, 0x83, 0xf8, 0xff, 0x0f, 0x84, 0x2b, 0xfc, 0xff, 0xff, 0x49, 0x8b, 
+    0x45, 0x10, 0x48, 0x8b, 0x3d, 0xb7, 0x36, 0x00, 0x00, 0x8b, 0x70, 0x10, 
+    0x83, 0xce, 0x20, 0xe8, 0xc4, 0xd6, 0xff, 0xff, 0xe9, 0x10, 0xfc, 0xff, 
+    0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x41, 0x8b, 0x45, 0x24, 
+    0x45, 0x31, 0xc9, 0x41, 0xb8, 0x00, 0x02, 0x00, 0x00, 0x4c, 0x89, 0xef, 
+    0xb9, 0x03, 0x00, 0x00, 0x00, 0x8d, 0x50, 0xfe, 0x41, 0x8b, 0x45, 0x28, 
+    0x83, 0xe8, 0x06, 0x48, 0x63, 0xf0, 0xc1, 0xf8, 0x1f, 0x48, 0x69, 0xf6, 
+    0x56, 0x55, 0x55, 0x55, 0x48, 0xc1, 0xee, 0x20, 0x29, 0xc6, 0x83, 0xc6, 
+    0x01, 0xe8, 0xbe, 0xdd, 0xff, 0xff, 0x4c, 0x89, 0xf2, 0xbe, 0x01, 0x00, 
+    0x00, 0x00, 0x49, 0x89, 0x45, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x1a, 0xe0, 
+    0xff, 0xff, 0x8b, 0x85, 0x7c, 0xfb, 0xff, 0xff, 0xc7, 0x85, 0xc4, 0xfb, 
+    0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x89, 0x85, 0xcc, 0xfb, 0xff, 0xff, 
+    0x4d, 0x85, 0xf6, 0x0f, 0x85, 0xe1, 0xfa, 0xff, 0xff, 0xe9, 0x19, 0xfb, 
+    0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x44, 0x89, 0xe6, 0xe8, 
+    0x18, 0xd6, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x0f, 0x84, 0xfa, 0xfd, 0xff, 
+    0xff, 0x49, 0x8b, 0x45, 0x10, 0x48, 0x8b, 0x3d, 0x0c, 0x36, 0x00, 0x00, 
+    0x8b, 0x70, 0x10, 0x83, 0xce, 0x20, 0xe8, 0x19, 0xd6, 0xff, 0xff, 0xe9, 
+    0xdf, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 0x8b, 0x8d, 0xc8, 0xfb, 
+    0xff, 0xff, 0x39, 0xd9, 0x0f, 0x8e, 0xc2, 0xfe, 0xff, 0xff, 0x89, 0xc8, 
+    0x48, 0x63, 0xf9, 0x48, 0x8b, 0x8d, 0xa8, 0xfb, 0xff, 0xff, 0x29, 0xd8, 
+    0x48, 0x8d, 0x77, 0xff, 0x83, 0xe8, 0x01, 0x48, 0x29, 0xc6, 0x48, 0x29, 
+    0xc7, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x01, 0xce, 0x48, 0x01, 0xcf, 0xe8, 
+    0xa8, 0xd5, 0xff, 0xff, 0xe9, 0x93, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+    0x7e, 0x3d, 0x44, 0x8b, 0xb5, 0xc8, 0xfb, 0xff, 0xff, 0x48, 0x8b, 0x85, 
+    0xa8, 0xfb, 0xff, 0xff, 0x48, 0x63, 0xfb, 0x41, 0x83, 0xee, 0x01, 0x48, 
+    0x8d, 0x74, 0x38, 0x01, 0x48, 0x01, 0xc7, 0x44, 0x89, 0xf2, 0x29, 0xda, 
+    0x48, 0x83, 0xc2, 0x01, 0xe8, 0x73, 0xd5, 0xff, 0xff, 0x44, 0x89, 0xb5, 
+    0xc8, 0xfb, 0xff, 0xff, 0x41, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe9, 0x61, 
+    0xfb, 0xff, 0xff, 0x8b, 0x85, 0xc8, 0xfb, 0xff, 0xff, 0x44, 0x8d, 0x70, 
+    0xff, 0xeb, 0xe2, 0x31, 0xc0, 0xe9, 0xf2, 0xfb, 0xff, 0xff, 0x66, 0x66, 
+    0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x00, 
+    0x55, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x49, 0x89, 0xf7, 0x31, 0xf6, 0x41, 
+    0x56, 0x41, 0x55, 0x41, 0x54, 0x53, 0x48, 0x83, 0xec, 0x48, 0x48, 0x8b, 
+    0x9f, 0xb8, 0x04, 0x00, 0x00, 0xf3, 0x0f, 0x11, 0x45, 0xac, 0x48, 0x89, 
+    0xdf, 0xe8, 0x56, 0xe5, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0x1e, 0x02, 
+    0x00, 0x00, 0x48, 0x83, 0x7b, 0x10, 0x00, 0x0f, 0x84, 0x44, 0x02, 0x00, 
+    0x00, 0x48, 0x8b, 0x3d, 0x14, 0x35, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 
+    0x00, 0xe8, 0x92, 0xd3, 0xff, 0xff, 0xeb, 0x09, 0x83, 0xf8, 0x0c, 0x0f, 
+    0x84, 0x37, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0xf8, 0x34, 0x00, 0x00, 
+    0xe8, 0xcb, 0xd3, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x75, 0xe6, 0x48, 0x8b, 
+    0x3d, 0xe7, 0x34, 0x00, 0x00, 0x31, 0xf6, 0x41, 0xbc, 0x02, 0x00, 0x00, 
+    0x00, 0xe8, 0x62, 0xd3, 0xff, 0xff, 0x48, 0x8b, 0x73, 0x10, 0x66, 0x0f, 
+    0xef, 0xc0, 0xf3, 0x0f, 0x10, 0x4d, 0xac, 0xba, 0xcd, 0xcc, 0xcc, 0xcc, 
+    0x41, 0xba, 0xf6, 0xff, 0xff, 0xff, 0xc6, 0x45, 0xbf, 0x25, 0x8b, 0x46, 
+    0x08, 0x8d, 0x48, 0xfe, 0xf3, 0x0f, 0x2a, 0xc1, 0xf3, 0x0f, 0x59, 0xc1, 
+    0xf3, 0x44, 0x0f, 0x2c, 0xc8, 0x45, 0x39, 0xe1, 0x45, 0x0f, 0x4d, 0xe1, 
+    0x83, 0xe8, 0x04, 0x41, 0x89, 0xc0, 0x41, 0xc1, 0xe8, 0x1f, 0x41, 0x01, 
+    0xc0, 0x41, 0xd1, 0xf8, 0x66, 0x41, 0x0f, 0x6e, 0xd0, 0x41, 0x8d, 0x40, 
+    0x01, 0x45, 0x89, 0xc6, 0x66, 0x0f, 0x70, 0xc2, 0x00, 0x66, 0x0f, 0xfe, 
+    0x05, 0xa3, 0x14, 0x00, 0x00, 0x89, 0x45, 0xac, 0x41, 0x8d, 0x40, 0x02, 
+    0x89, 0x45, 0xa8, 0x41, 0x8d, 0x40, 0x03, 0x0f, 0x29, 0x45, 0xc0, 0x66, 
+    0x0f, 0xef, 0xc0, 0xf3, 0x0f, 0x5a, 0xc1, 0xf2, 0x0f, 0x59, 0x05, 0x69, 
+    0x14, 0x00, 0x00, 0x89, 0x45, 0xa4, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xf2, 
+    0x44, 0x0f, 0x2c, 0xd8, 0x45, 0x85, 0xdb, 0x44, 0x0f, 0x4e, 0xd8, 0x44, 
+    0x89, 0xd8, 0x4c, 0x69, 0xe8, 0x1f, 0x85, 0xeb, 0x51, 0x48, 0x0f, 0xaf, 
+    0xc2, 0x49, 0xc1, 0xed, 0x25, 0x48, 0xc1, 0xe8, 0x23, 0x48, 0x89, 0xc2, 
+    0x44, 0x89, 0xd0, 0x41, 0x0f, 0xaf, 0xc5, 0x8d, 0x3c, 0x10, 0x41, 0x8d, 
+    0x45, 0x30, 0x88, 0x45, 0xbc, 0x8d, 0x47, 0x30, 0x88, 0x45, 0xbd, 0xb8, 
+    0x9c, 0xff, 0xff, 0xff, 0x41, 0x0f, 0xaf, 0xc5, 0x42, 0x8d, 0x54, 0x18, 
+    0x30, 0x89, 0xf8, 0x41, 0x0f, 0xaf, 0xc2, 0x01, 0xd0, 0x48, 0x8d, 0x55, 
+    0xbf, 0x88, 0x45, 0xbe, 0x48, 0x8d, 0x45, 0xbc, 0x48, 0x89, 0x45, 0x98, 
+    0x80, 0x38, 0x30, 0x75, 0x0c, 0xc6, 0x00, 0x00, 0x48, 0x83, 0xc0, 0x01, 
+    0x48, 0x39, 0xc2, 0x75, 0xef, 0x44, 0x8b, 0x6e, 0x0c, 0x48, 0x89, 0xdf, 
+    0x4c, 0x89, 0xfe, 0x44, 0x89, 0x4d, 0xa0, 0x41, 0x8d, 0x55, 0xfd, 0xe8, 
+    0x80, 0xd7, 0xff, 0xff, 0x80, 0x7b, 0x20, 0x00, 0x0f, 0x85, 0x8e, 0x01, 
+    0x00, 0x00, 0x44, 0x8b, 0x4d, 0xa0, 0x41, 0xbf, 0x02, 0x00, 0x00, 0x00, 
+    0x41, 0x83, 0xf9, 0x02, 0x7e, 0x6a, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+    0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0x9d, 0x33, 0x00, 0x00, 0x8b, 
+    0x70, 0x04, 0x8b, 0x10, 0x44, 0x01, 0xee, 0x44, 0x01, 0xfa, 0x83, 0xee, 
+    0x02, 0xe8, 0x82, 0xd3, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x38, 0x45, 
+    0x39, 0xfe, 0x0f, 0x84, 0x44, 0x02, 0x00, 0x00, 0x44, 0x39, 0x7d, 0xac, 
+    0x0f, 0x84, 0x7a, 0x02, 0x00, 0x00, 0x44, 0x39, 0x7d, 0xa8, 0x0f, 0x84, 
+    0x90, 0x02, 0x00, 0x00, 0xbe, 0x20, 0x00, 0x04, 0x00, 0x44, 0x39, 0x7d, 
+    0xa4, 0x0f, 0x84, 0xa1, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0x52, 0x33, 
+    0x00, 0x00, 0xe8, 0x65, 0xd3, 0xff, 0xff, 0x41, 0x83, 0xc7, 0x01, 0x45, 
+    0x39, 0xfc, 0x7f, 0x9c, 0x48, 0x8b, 0x3d, 0x3d, 0x33, 0x00, 0x00, 0x45, 
+    0x31, 0xf6, 0x4c, 0x8d, 0x7d, 0xc0, 0x43, 0x8b, 0x14, 0xb7, 0x44, 0x39, 
+    0xe2, 0x0f, 0x8d, 0xb1, 0x00, 0x00, 0x00, 0x49, 0x83, 0xc6, 0x01, 0x49, 
+    0x83, 0xfe, 0x04, 0x75, 0xe9, 0x48, 0x83, 0xc4, 0x48, 0x5b, 0x41, 0x5c, 
+    0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0x5d, 0xe9, 0x44, 0xd2, 0xff, 0xff, 
+    0x0f, 0x1f, 0x40, 0x00, 0x4c, 0x8b, 0x63, 0x10, 0x4d, 0x85, 0xe4, 0x74, 
+    0x28, 0x48, 0x8b, 0x3d, 0xf8, 0x32, 0x00, 0x00, 0x31, 0xf6, 0xe8, 0x89, 
+    0xd1, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x51, 0xd4, 0xff, 0xff, 0x49, 
+    0x8b, 0x7c, 0x24, 0x18, 0xe8, 0x87, 0xd1, 0xff, 0xff, 0x4c, 0x89, 0xe7, 
+    0xe8, 0x7f, 0xd1, 0xff, 0xff, 0x48, 0x89, 0xdf, 0xe8, 0x47, 0xdf, 0xff, 
+    0xff, 0xe9, 0xaf, 0xfd, 0xff, 0xff, 0x66, 0x90, 0xbe, 0x01, 0x00, 0x00, 
+    0x00, 0x48, 0x89, 0xdf, 0xe8, 0xe3, 0xe2, 0xff, 0xff, 0x4c, 0x8b, 0x63, 
+    0x10, 0x4d, 0x85, 0xe4, 0x74, 0x28, 0x48, 0x8b, 0x3d, 0xab, 0x32, 0x00, 
+    0x00, 0x31, 0xf6, 0xe8, 0x3c, 0xd1, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 
+    0x04, 0xd4, 0xff, 0xff, 0x49, 0x8b, 0x7c, 0x24, 0x18, 0xe8, 0x3a, 0xd1, 
+    0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x32, 0xd1, 0xff, 0xff, 0x48, 0x89, 
+    0xdf, 0xe8, 0xfa, 0xde, 0xff, 0xff, 0xe9, 0x7e, 0xfd, 0xff, 0xff, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x43, 0x10, 0x8b, 0x70, 0x04, 0x03, 
+    0x10, 0x44, 0x01, 0xee, 0x83, 0xee, 0x02, 0xe8, 0x5c, 0xd2, 0xff, 0xff, 
+    0x83, 0xf8, 0xff, 0x74, 0x20, 0x48, 0x8b, 0x45, 0x98, 0x48, 0x8b, 0x3d, 
+    0x54, 0x32, 0x00, 0x00, 0x42, 0x0f, 0xbe, 0x34, 0x30, 0xb8, 0x2d, 0x00, 
+    0x00, 0x00, 0x40, 0x84, 0xf6, 0x0f, 0x44, 0xf0, 0xe8, 0x57, 0xd2, 0xff, 
+    0xff, 0x48, 0x8b, 0x3d, 0x38, 0x32, 0x00, 0x00, 0xe9, 0x0a, 0xff, 0xff, 
+    0xff, 0x0f, 0x1f, 0x00, 0x41, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x66, 0x90, 
+    0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x3d, 0x1d, 0x32, 0x00, 0x00, 0x8b, 
+    0x70, 0x04, 0x8b, 0x10, 0x44, 0x01, 0xee, 0x44, 0x01, 0xfa, 0x83, 0xee, 
+    0x02, 0xe8, 0x02, 0xd2, 0xff, 0xff, 0x83, 0xf8, 0xff, 0x74, 0x38, 0x45, 
+    0x39, 0xfe, 0x0f, 0x84, 0xe4, 0x00, 0x00, 0x00, 0x44, 0x39, 0x7d, 0xac, 
+    0x0f, 0x84, 0x0a, 0x01, 0x00, 0x00, 0x44, 0x39, 0x7d, 0xa8, 0x0f, 0x84, 
+    0x20, 0x01, 0x00, 0x00, 0xbe, 0x20, 0x04, 0x04, 0x00, 0x44, 0x39, 0x7d, 
+    0xa4, 0x0f, 0x84, 0x39, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0xd2, 0x31, 
+    0x00, 0x00, 0xe8, 0xe5, 0xd1, 0xff, 0xff, 0x41, 0x83, 0xc7, 0x01, 0x45, 
+    0x39, 0xfc, 0x7d, 0x9c, 0x4c, 0x8d, 0x7d, 0xc0, 0x45, 0x31, 0xf6, 0x48, 
+    0x8b, 0x3d, 0xb6, 0x31, 0x00, 0x00, 0x4c, 0x89, 0xf8, 0x45, 0x89, 0xe7, 
+    0x49, 0x89, 0xc4, 0x43, 0x8b, 0x14, 0xb4, 0x44, 0x39, 0xfa, 0x7f, 0x1b, 
+    0x0f, 0x1f, 0x40, 0x00, 0x49, 0x83, 0xc6, 0x01, 0x49, 0x83, 0xfe, 0x04, 
+    0x0f, 0x84, 0x73, 0xfe, 0xff, 0xff, 0x43, 0x8b, 0x14, 0xb4, 0x44, 0x39, 
+    0xfa, 0x7e, 0xe9, 0x48, 0x8b, 0x43, 0x10, 0x8b, 0x70, 0x04, 0x03, 0x10, 
+    0x44, 0x01, 0xee, 0x83, 0xee, 0x02, 0xe8, 0x6d, 0xd1, 0xff, 0xff, 0x83, 
+    0xf8, 0xff, 0x74, 0x27, 0x48, 0x8b, 0x45, 0x98, 0x48, 0x8b, 0x3d, 0x65, 
+    0x31, 0x00, 0x00, 0x42, 0x0f, 0xbe, 0x34, 0x30, 0x89, 0xf0, 0x81, 0xce, 
+    0x00, 0x04, 0x00, 0x00, 0x84, 0xc0, 0xb8, 0x20, 0x04, 0x00, 0x00, 0x0f, 
+    0x44, 0xf0, 0xe8, 0x61, 0xd1, 0xff, 0xff, 0x48, 0x8b, 0x3d, 0x42, 0x31, 
+    0x00, 0x00, 0xeb, 0xa0, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0xbe, 0x75, 0xbc, 0x89, 0xf0, 0x81, 0xce, 0x00, 0x00, 0x04, 0x00, 
+    0x84, 0xc0, 0xb8, 0x20, 0x00, 0x04, 0x00, 0x0f, 0x44, 0xf0, 0xe9, 0xc4, 
+    0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x0f, 0xbe, 0x75, 0xbc, 
+    0x89, 0xf0, 0x81, 0xce, 0x00, 0x04, 0x04, 0x00, 0x84, 0xc0, 0xb8, 0x20, 
+    0x04, 0x04, 0x00, 0x0f, 0x44, 0xf0, 0xe9, 0x24, 0xff, 0xff, 0xff, 0x0f, 
+    0x1f, 0x44, 0x00, 0x00, 0x0f, 0xbe, 0x75, 0xbd, 0xeb, 0xbe, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbe, 0x75, 0xbd, 
+    0xeb, 0xce, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0xbe, 0x75, 0xbe, 0xeb, 0x9e, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xbe, 0x75, 0xbe, 0xeb, 0xae, 0x66, 0x2e, 
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbe, 0x45, 0xbf, 
+    0x89, 0xc2, 0x0d, 0x00, 0x00, 0x04, 0x00, 0x84, 0xd2, 0x0f, 0x45, 0xf0, 
+    0xe9, 0x4a, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x00, 0x0f, 0xbe, 0x45, 0xbf, 
+    0x89, 0xc2, 0x0d, 0x00, 0x04, 0x04, 0x00, 0x84, 0xd2, 0x0f, 0x45, 0xf0, 
+    0xe9, 0xb2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x48, 0x83, 0xec, 0x08, 
+    0x48, 0x83, 0xc4, 0x08, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x33, 0x64, 0x25, 
+    0x25, 0x00, 0x77, 0x77, 0x77, 0x2e, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 
+    0x2e, 0x63, 0x6f, 0x6d, 0x00, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 
+    0x3a, 0x20, 0x00, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x3a, 0x20, 0x00, 0x4f, 
+    0x4b, 0x00, 0x59, 0x65, 0x73, 0x00, 0x4e, 0x6f, 0x00, 0x45, 0x78, 0x65, 
+    0x63, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 
+    0x6d, 0x61, 0x6e, 0x64, 0x20, 0x60, 0x25, 0x73, 0x60, 0x00, 0x42, 0x61, 
+    0x63, 0x6b, 0x20, 0x75, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 
+    0x6c, 0x65, 0x20, 0x27, 0x25, 0x73, 0x27, 0x00, 0x44, 0x65, 0x6c, 0x65, 
+    0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 
+    0x27, 0x25, 0x73, 0x27, 0x00, 0x50, 0x72, 0x6f, 0x70, 0x6f, 0x73, 0x65, 
+    0x64, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x4c, 0x69, 0x73, 
+    0x74, 0x00, 0x25, 0x73, 0x3a, 0x20, 0x00, 0x63, 0x3a, 0x20, 0x25, 0x33, 
+    0x64, 0x20, 0x20, 0x63, 0x68, 0x3a, 0x20, 0x25, 0x30, 0x34, 0x6f, 0x20, 
+    0x28, 0x25, 0x64, 0x29, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x56, 0x49, 0x44, 
+    0x49, 0x41, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x66, 0x6f, 
+    0x72, 0x20, 0x55, 0x6e, 0x69, 0x78, 0x2f, 0x4c, 0x69, 0x6e, 0x75, 0x78, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x68, 0x65, 0x20, 
+    0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x70, 
+    0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x77, 0x69, 0x6c, 
+    0x6c, 0x20, 0x62, 0x65, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 
+    0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 
+    0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x25, 0x73, 0x2e, 0x20, 0x20, 0x49, 
+    0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 
+    0x74, 0x61, 0x62, 0x6c, 0x65, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x66, 0x69, 0x6c, 0x65, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x61, 0x73, 
+    0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 
+    0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x27, 
+    0x25, 0x73, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x74, 0x68, 0x65, 
+    0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x60, 0x25, 
+    0x73, 0x60, 0x00, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 
+    0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x69, 0x63, 0x20, 0x6c, 0x69, 
+    0x6e, 0x6b, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x74, 0x6f, 0x20, 0x27, 
+    0x25, 0x73, 0x27, 0x00, 0x4d, 0xe0, 0xff, 0xff, 0x94, 0xe1, 0xff, 0xff, 
+    0xb4, 0xe0, 0xff, 0xff, 0x54, 0xe1, 0xff, 0xff, 0xf4, 0xe0, 0xff, 0xff, 
+    0x94, 0xdf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x59, 0x40, 0x30, 0x30, 0x31, 0x25, 0x0a, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x01, 0x1b, 0x03, 0x3b, 0xec, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
+    0x30, 0xbe, 0xff, 0xff, 0x08, 0x01, 0x00, 0x00, 0x50, 0xc0, 0xff, 0xff, 
+    0x30, 0x01, 0x00, 0x00, 0x20, 0xc1, 0xff, 0xff, 0x48, 0x01, 0x00, 0x00, 
+    0x30, 0xc1, 0xff, 0xff, 0x5c, 0x01, 0x00, 0x00, 0x90, 0xc1, 0xff, 0xff, 
+    0x80, 0x01, 0x00, 0x00, 0x40, 0xc2, 0xff, 0xff, 0xa8, 0x01, 0x00, 0x00, 
+    0x60, 0xc2, 0xff, 0xff, 0xc8, 0x01, 0x00, 0x00, 0x80, 0xc3, 0xff, 0xff, 
+    0xf4, 0x01, 0x00, 0x00, 0x70, 0xc4, 0xff, 0xff, 0x28, 0x02, 0x00, 0x00, 
+    0xb0, 0xc4, 0xff, 0xff, 0x4c, 0x02, 0x00, 0x00, 0x80, 0xc6, 0xff, 0xff, 
+    0x7c, 0x02, 0x00, 0x00, 0x20, 0xc7, 0xff, 0xff, 0xac, 0x02, 0x00, 0x00, 
+    0xd0, 0xc7, 0xff, 0xff, 0xdc, 0x02, 0x00, 0x00, 0x90, 0xc9, 0xff, 0xff, 
+    0x08, 0x03, 0x00, 0x00, 0x20, 0xca, 0xff, 0xff, 0x34, 0x03, 0x00, 0x00, 
+    0x60, 0xcb, 0xff, 0xff, 0x64, 0x03, 0x00, 0x00, 0x40, 0xcc, 0xff, 0xff, 
+    0x90, 0x03, 0x00, 0x00, 0x50, 0xcf, 0xff, 0xff, 0xc8, 0x03, 0x00, 0x00, 
+    0xf0, 0xcf, 0xff, 0xff, 0xec, 0x03, 0x00, 0x00, 0x40, 0xd1, 0xff, 0xff, 
+    0x18, 0x04, 0x00, 0x00, 0xb0, 0xd1, 0xff, 0xff, 0x40, 0x04, 0x00, 0x00, 
+    0xd0, 0xd3, 0xff, 0xff, 0x70, 0x04, 0x00, 0x00, 0x20, 0xd6, 0xff, 0xff, 
+    0xbc, 0x04, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xec, 0x04, 0x00, 0x00, 
+    0x20, 0xde, 0xff, 0xff, 0x0c, 0x05, 0x00, 0x00, 0x80, 0xde, 0xff, 0xff, 
+    0x2c, 0x05, 0x00, 0x00, 0xb0, 0xe2, 0xff, 0xff, 0x5c, 0x05, 0x00, 0x00, 
+    0x70, 0xea, 0xff, 0xff, 0x8c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7a, 0x52, 0x00, 
+    0x01, 0x78, 0x10, 0x01, 0x1b, 0x0c, 0x07, 0x08, 0x90, 0x01, 0x00, 0x00, 
+    0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0xbd, 0xff, 0xff, 
+    0x20, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x46, 0x0e, 0x18, 0x4a, 0x0f, 
+    0x0b, 0x77, 0x08, 0x80, 0x00, 0x3f, 0x1a, 0x3b, 0x2a, 0x33, 0x24, 0x22, 
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 
+    0x18, 0xbf, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 
+    0xd0, 0xbf, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xcc, 0xbf, 0xff, 0xff, 
+    0x5b, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x43, 0x8c, 0x03, 0x83, 0x04, 0x02, 0x53, 0x0c, 0x07, 0x08, 0x00, 
+    0x24, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x08, 0xc0, 0xff, 0xff, 
+    0xa3, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x45, 0x8d, 0x03, 0x8c, 0x04, 0x83, 0x05, 0x02, 0x95, 0x0c, 0x07, 
+    0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 
+    0x90, 0xc0, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 
+    0x86, 0x02, 0x4a, 0x0d, 0x06, 0x4d, 0x0c, 0x07, 0x08, 0x00, 0x00, 0x00, 
+    0x28, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x90, 0xc0, 0xff, 0xff, 
+    0x1a, 0x01, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x44, 0x8d, 0x03, 0x8c, 0x04, 0x44, 0x83, 0x05, 0x02, 0xcd, 0x0a, 
+    0x0c, 0x07, 0x08, 0x47, 0x0b, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 
+    0x08, 0x01, 0x00, 0x00, 0x84, 0xc1, 0xff, 0xff, 0xef, 0x00, 0x00, 0x00, 
+    0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 0x06, 0x44, 0x8f, 0x03, 
+    0x8e, 0x04, 0x45, 0x8d, 0x05, 0x45, 0x8c, 0x06, 0x44, 0x83, 0x07, 0x02, 
+    0xa9, 0x0a, 0x0c, 0x07, 0x08, 0x49, 0x0b, 0x66, 0x0c, 0x07, 0x08, 0x00, 
+    0x20, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x40, 0xc2, 0xff, 0xff, 
+    0x3b, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x67, 0x0a, 0x0c, 0x07, 0x08, 0x45, 0x0b, 0x48, 0x0c, 0x07, 0x08, 
+    0x2c, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x5c, 0xc2, 0xff, 0xff, 
+    0xc1, 0x01, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x42, 0x8f, 0x03, 0x4a, 0x8e, 0x04, 0x8d, 0x05, 0x8c, 0x06, 0x83, 
+    0x07, 0x03, 0x68, 0x01, 0x0a, 0x0c, 0x07, 0x08, 0x48, 0x0b, 0x00, 0x00, 
+    0x2c, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0xfc, 0xc3, 0xff, 0xff, 
+    0x9e, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x42, 0x8f, 0x03, 0x45, 0x8e, 0x04, 0x45, 0x8d, 0x05, 0x46, 0x8c, 
+    0x06, 0x48, 0x83, 0x07, 0x02, 0x70, 0x0a, 0x0c, 0x07, 0x08, 0x41, 0x0b, 
+    0x2c, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x6c, 0xc4, 0xff, 0xff, 
+    0xb0, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x42, 0x8f, 0x03, 0x4a, 0x8e, 0x04, 0x45, 0x8d, 0x05, 0x45, 0x8c, 
+    0x06, 0x48, 0x83, 0x07, 0x02, 0x8d, 0x0c, 0x07, 0x08, 0x00, 0x00, 0x00, 
+    0x28, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0xec, 0xc4, 0xff, 0xff, 
+    0xbf, 0x01, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x42, 0x8d, 0x03, 0x4a, 0x8c, 0x04, 0x4d, 0x83, 0x05, 0x03, 0x00, 
+    0x01, 0x0a, 0x0c, 0x07, 0x08, 0x43, 0x0b, 0x00, 0x28, 0x00, 0x00, 0x00, 
+    0x1c, 0x02, 0x00, 0x00, 0x80, 0xc6, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 
+    0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 0x06, 0x42, 0x8e, 0x03, 
+    0x47, 0x8d, 0x04, 0x8c, 0x05, 0x44, 0x83, 0x06, 0x02, 0x7a, 0x0c, 0x07, 
+    0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 
+    0xe4, 0xc6, 0xff, 0xff, 0x35, 0x01, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 
+    0x86, 0x02, 0x43, 0x0d, 0x06, 0x42, 0x8f, 0x03, 0x47, 0x8e, 0x04, 0x8d, 
+    0x05, 0x45, 0x8c, 0x06, 0x44, 0x83, 0x07, 0x03, 0x1a, 0x01, 0x0c, 0x07, 
+    0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 
+    0xf4, 0xc7, 0xff, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 
+    0x86, 0x02, 0x43, 0x0d, 0x06, 0x42, 0x8f, 0x03, 0x4c, 0x8e, 0x04, 0x8d, 
+    0x05, 0x4c, 0x8c, 0x06, 0x83, 0x07, 0x02, 0xb9, 0x0c, 0x07, 0x08, 0x00, 
+    0x34, 0x00, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00, 0xa8, 0xc8, 0xff, 0xff, 
+    0x0e, 0x03, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x4d, 0x0d, 
+    0x06, 0x42, 0x8f, 0x03, 0x4d, 0x8e, 0x04, 0x8d, 0x05, 0x8c, 0x06, 0x83, 
+    0x07, 0x03, 0x5e, 0x01, 0x0a, 0x0c, 0x07, 0x08, 0x45, 0x0b, 0x03, 0x0f, 
+    0x01, 0x0a, 0x0c, 0x07, 0x08, 0x49, 0x0b, 0x00, 0x20, 0x00, 0x00, 0x00, 
+    0xdc, 0x02, 0x00, 0x00, 0x80, 0xcb, 0xff, 0xff, 0x9d, 0x00, 0x00, 0x00, 
+    0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 0x06, 0x43, 0x8c, 0x03, 
+    0x83, 0x04, 0x02, 0x91, 0x0c, 0x07, 0x08, 0x00, 0x28, 0x00, 0x00, 0x00, 
+    0x00, 0x03, 0x00, 0x00, 0xfc, 0xcb, 0xff, 0xff, 0x4e, 0x01, 0x00, 0x00, 
+    0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 0x06, 0x47, 0x8e, 0x03, 
+    0x8d, 0x04, 0x8c, 0x05, 0x83, 0x06, 0x03, 0x15, 0x01, 0x0a, 0x0c, 0x07, 
+    0x08, 0x48, 0x0b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00, 
+    0x20, 0xcd, 0xff, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 
+    0x86, 0x02, 0x43, 0x0d, 0x06, 0x42, 0x8d, 0x03, 0x47, 0x8c, 0x04, 0x48, 
+    0x83, 0x05, 0x02, 0x4c, 0x0c, 0x07, 0x08, 0x00, 0x2c, 0x00, 0x00, 0x00, 
+    0x54, 0x03, 0x00, 0x00, 0x68, 0xcd, 0xff, 0xff, 0x17, 0x02, 0x00, 0x00, 
+    0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 0x06, 0x4d, 0x8f, 0x03, 
+    0x8e, 0x04, 0x8d, 0x05, 0x8c, 0x06, 0x83, 0x07, 0x03, 0x21, 0x01, 0x0a, 
+    0x0c, 0x07, 0x08, 0x46, 0x0b, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
+    0x84, 0x03, 0x00, 0x00, 0x58, 0xcf, 0xff, 0xff, 0x49, 0x02, 0x00, 0x00, 
+    0x00, 0x49, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 0x06, 0x44, 0x8f, 0x03, 
+    0x8e, 0x04, 0x4c, 0x8d, 0x05, 0x8c, 0x06, 0x83, 0x07, 0x69, 0x0a, 0x0c, 
+    0x07, 0x08, 0x4b, 0x0b, 0x03, 0xd5, 0x01, 0x0a, 0xc3, 0x42, 0xcc, 0x42, 
+    0xcd, 0x42, 0xce, 0x42, 0xcf, 0x41, 0xc6, 0x0c, 0x07, 0x08, 0x4a, 0x0b, 
+    0x50, 0x0c, 0x07, 0x08, 0xc3, 0xc6, 0xcc, 0xcd, 0xce, 0xcf, 0x00, 0x00, 
+    0x2c, 0x00, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0x5c, 0xd1, 0xff, 0xff, 
+    0xd7, 0x07, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x43, 0x0d, 
+    0x06, 0x44, 0x8f, 0x03, 0x8e, 0x04, 0x4f, 0x8d, 0x05, 0x8c, 0x06, 0x48, 
+    0x83, 0x07, 0x03, 0x05, 0x07, 0x0a, 0x0c, 0x07, 0x08, 0x44, 0x0b, 0x00, 
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0xd9, 0xff, 0xff, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x48, 0x0d, 
+    0x06, 0x51, 0x0c, 0x07, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
+    0x20, 0x04, 0x00, 0x00, 0x0c, 0xd9, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 
+    0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x66, 0x0d, 0x06, 0x65, 0x0c, 0x07, 
+    0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 
+    0x4c, 0xd9, 0xff, 0xff, 0x24, 0x04, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 
+    0x86, 0x02, 0x4f, 0x0d, 0x06, 0x42, 0x8f, 0x03, 0x47, 0x8e, 0x04, 0x8d, 
+    0x05, 0x46, 0x8c, 0x06, 0x83, 0x07, 0x03, 0xce, 0x01, 0x0a, 0x0c, 0x07, 
+    0x08, 0x43, 0x0b, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 
+    0x4c, 0xdd, 0xff, 0xff, 0xb2, 0x07, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 
+    0x86, 0x02, 0x43, 0x0d, 0x06, 0x50, 0x8f, 0x03, 0x8e, 0x04, 0x8d, 0x05, 
+    0x8c, 0x06, 0x83, 0x07, 0x03, 0xa1, 0x03, 0x0a, 0x0c, 0x07, 0x08, 0x4b, 
+    0x0b, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00, 
+    0xdc, 0xe4, 0xff, 0xff, 0xcd, 0x04, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 
+    0x86, 0x02, 0x43, 0x0d, 0x06, 0x42, 0x8f, 0x03, 0x50, 0x8e, 0x04, 0x8d, 
+    0x05, 0x8c, 0x06, 0x83, 0x07, 0x03, 0x31, 0x02, 0x0a, 0x0c, 0x07, 0x08, 
+    0x49, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x12, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x6d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf5, 0xfe, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 
+    0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x6f, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0a, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6f, 
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf0, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x36, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x56, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x66, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x10, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x96, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x10, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xb6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xc6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x10, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x46, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x56, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x76, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x86, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xb6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xd6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x16, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x12, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x16, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x30, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x34, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x60, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x23, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x47, 0x43, 0x43, 0x3a, 0x20, 0x28, 0x44, 0x65, 0x62, 0x69, 0x61, 0x6e, 
+    0x20, 0x31, 0x32, 0x2e, 0x32, 0x2e, 0x30, 0x2d, 0x31, 0x34, 0x2b, 0x64, 
+    0x65, 0x62, 0x31, 0x32, 0x75, 0x31, 0x29, 0x20, 0x31, 0x32, 0x2e, 0x32, 
+    0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x50, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x80, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xc0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 
+    0xb0, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 
+    0xe0, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 
+    0xd8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x20, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 
+    0xb8, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x80, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x30, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x70, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x60, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xa0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x10, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xc0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x10, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x50, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x30, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x40, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xe0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x89, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x30, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa1, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xa0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xc0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xca, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x07, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xf0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x2f, 0x03, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0xa0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x07, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 
+    0x60, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x04, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 
+    0xac, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x6b, 0x03, 0x00, 0x00, 0x02, 0x00, 0x0d, 0x00, 
+    0x30, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x03, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 
+    0x20, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 
+    0xe8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 
+    0xf0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 
+    0xb0, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 
+    0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc6, 0x01, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xdd, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x45, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x61, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa3, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xd3, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x8b, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xae, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xcd, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xef, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x51, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0x11, 0x00, 0x16, 0x00, 
+    0x40, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x8a, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa6, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc6, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe3, 0x06, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x07, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x2d, 0x07, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x4c, 0x07, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x67, 0x07, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x07, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x9f, 0x07, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x72, 0x74, 0x73, 0x74, 0x75, 0x66, 
+    0x66, 0x2e, 0x63, 0x00, 0x64, 0x65, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 
+    0x65, 0x72, 0x5f, 0x74, 0x6d, 0x5f, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x73, 
+    0x00, 0x5f, 0x5f, 0x64, 0x6f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 
+    0x5f, 0x64, 0x74, 0x6f, 0x72, 0x73, 0x5f, 0x61, 0x75, 0x78, 0x00, 0x63, 
+    0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x64, 0x2e, 0x30, 0x00, 0x5f, 
+    0x5f, 0x64, 0x6f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x64, 
+    0x74, 0x6f, 0x72, 0x73, 0x5f, 0x61, 0x75, 0x78, 0x5f, 0x66, 0x69, 0x6e, 
+    0x69, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x65, 0x6e, 0x74, 0x72, 
+    0x79, 0x00, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x5f, 0x64, 0x75, 0x6d, 0x6d, 
+    0x79, 0x00, 0x5f, 0x5f, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x5f, 0x64, 0x75, 
+    0x6d, 0x6d, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x5f, 0x61, 0x72, 0x72, 
+    0x61, 0x79, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x6e, 0x63, 0x75, 
+    0x72, 0x73, 0x65, 0x73, 0x2d, 0x75, 0x69, 0x2e, 0x63, 0x00, 0x6e, 0x76, 
+    0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x63, 0x6f, 0x6d, 
+    0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 
+    0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x63, 
+    0x6c, 0x65, 0x61, 0x72, 0x5f, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x00, 
+    0x6e, 0x76, 0x5f, 0x73, 0x74, 0x64, 0x73, 0x63, 0x72, 0x00, 0x6e, 0x76, 
+    0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x73, 0x65, 0x74, 
+    0x5f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 
+    0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x74, 
+    0x69, 0x74, 0x6c, 0x65, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 
+    0x73, 0x65, 0x73, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x66, 0x6f, 0x6f, 0x74, 
+    0x65, 0x72, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 
+    0x73, 0x5f, 0x64, 0x6f, 0x5f, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 
+    0x73, 0x5f, 0x62, 0x61, 0x72, 0x5f, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 
+    0x65, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 
+    0x5f, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 
+    0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x72, 
+    0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x2e, 0x70, 0x61, 0x72, 0x74, 
+    0x2e, 0x30, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 
+    0x73, 0x5f, 0x65, 0x72, 0x61, 0x73, 0x65, 0x5f, 0x62, 0x75, 0x74, 0x74, 
+    0x6f, 0x6e, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x70, 0x72, 0x6f, 0x70, 
+    0x2e, 0x30, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 
+    0x73, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x72, 0x65, 0x67, 
+    0x69, 0x6f, 0x6e, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x70, 0x72, 0x6f, 
+    0x70, 0x2e, 0x30, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 
+    0x65, 0x73, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 
+    0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x66, 0x6f, 0x72, 0x6d, 0x61, 
+    0x74, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 
+    0x74, 0x70, 0x72, 0x6f, 0x70, 0x2e, 0x30, 0x2e, 0x69, 0x73, 0x72, 0x61, 
+    0x2e, 0x30, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 
+    0x73, 0x5f, 0x64, 0x72, 0x61, 0x77, 0x5f, 0x62, 0x75, 0x74, 0x74, 0x6f, 
+    0x6e, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x70, 0x72, 0x6f, 0x70, 0x2e, 
+    0x30, 0x2e, 0x69, 0x73, 0x72, 0x61, 0x2e, 0x30, 0x00, 0x6e, 0x76, 0x5f, 
+    0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x64, 0x6f, 0x5f, 0x6d, 
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5f, 0x72, 0x65, 0x67, 0x69, 0x6f, 
+    0x6e, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 
+    0x5f, 0x64, 0x6f, 0x5f, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 
+    0x5f, 0x62, 0x61, 0x72, 0x5f, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x00, 
+    0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x63, 
+    0x6c, 0x6f, 0x73, 0x65, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 
+    0x73, 0x65, 0x73, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x72, 0x65, 
+    0x73, 0x69, 0x7a, 0x65, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 
+    0x73, 0x65, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x5f, 0x62, 
+    0x65, 0x67, 0x69, 0x6e, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 
+    0x73, 0x65, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x5f, 0x65, 
+    0x6e, 0x64, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 
+    0x73, 0x5f, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00, 0x6e, 0x76, 
+    0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x70, 0x61, 0x67, 
+    0x65, 0x64, 0x5f, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x00, 0x6e, 0x76, 
+    0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x6d, 0x75, 0x6c, 
+    0x74, 0x69, 0x70, 0x6c, 0x65, 0x5f, 0x63, 0x68, 0x6f, 0x69, 0x63, 0x65, 
+    0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 
+    0x79, 0x65, 0x73, 0x5f, 0x6e, 0x6f, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 
+    0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x76, 
+    0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x6c, 0x69, 
+    0x73, 0x74, 0x00, 0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 
+    0x73, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 
+    0x6e, 0x76, 0x5f, 0x6e, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5f, 0x73, 
+    0x74, 0x61, 0x74, 0x75, 0x73, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 
+    0x00, 0x5f, 0x5f, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x5f, 0x45, 0x4e, 0x44, 
+    0x5f, 0x5f, 0x00, 0x5f, 0x66, 0x69, 0x6e, 0x69, 0x00, 0x5f, 0x5f, 0x64, 
+    0x73, 0x6f, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x00, 0x5f, 0x44, 
+    0x59, 0x4e, 0x41, 0x4d, 0x49, 0x43, 0x00, 0x5f, 0x5f, 0x47, 0x4e, 0x55, 
+    0x5f, 0x45, 0x48, 0x5f, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x5f, 0x48, 0x44, 
+    0x52, 0x00, 0x5f, 0x5f, 0x54, 0x4d, 0x43, 0x5f, 0x45, 0x4e, 0x44, 0x5f, 
+    0x5f, 0x00, 0x5f, 0x47, 0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x5f, 0x4f, 0x46, 
+    0x46, 0x53, 0x45, 0x54, 0x5f, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x00, 
+    0x68, 0x61, 0x73, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x40, 0x4e, 
+    0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 
+    0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x6e, 0x6f, 0x64, 
+    0x65, 0x6c, 0x61, 0x79, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 
+    0x36, 0x5f, 0x54, 0x49, 0x4e, 0x46, 0x4f, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 
+    0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x77, 0x61, 0x74, 
+    0x74, 0x72, 0x73, 0x65, 0x74, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 
+    0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 
+    0x30, 0x32, 0x33, 0x00, 0x66, 0x72, 0x65, 0x65, 0x40, 0x47, 0x4c, 0x49, 
+    0x42, 0x43, 0x5f, 0x32, 0x2e, 0x32, 0x2e, 0x35, 0x00, 0x73, 0x74, 0x72, 
+    0x6e, 0x63, 0x70, 0x79, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 
+    0x2e, 0x32, 0x2e, 0x35, 0x00, 0x5f, 0x49, 0x54, 0x4d, 0x5f, 0x64, 0x65, 
+    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x54, 0x4d, 0x43, 0x6c, 
+    0x6f, 0x6e, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x63, 0x75, 0x72, 
+    0x73, 0x5f, 0x73, 0x65, 0x74, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 
+    0x53, 0x36, 0x5f, 0x54, 0x49, 0x4e, 0x46, 0x4f, 0x5f, 0x35, 0x2e, 0x30, 
+    0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x77, 0x67, 
+    0x65, 0x74, 0x63, 0x68, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 
+    0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 
+    0x32, 0x33, 0x00, 0x77, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x40, 0x4e, 0x43, 
+    0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 
+    0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x73, 0x74, 0x72, 0x6c, 
+    0x65, 0x6e, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 0x2e, 0x32, 
+    0x2e, 0x35, 0x00, 0x6e, 0x6f, 0x65, 0x63, 0x68, 0x6f, 0x40, 0x4e, 0x43, 
+    0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 
+    0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x73, 0x6e, 0x70, 0x72, 
+    0x69, 0x6e, 0x74, 0x66, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 
+    0x2e, 0x32, 0x2e, 0x35, 0x00, 0x69, 0x6e, 0x69, 0x74, 0x73, 0x63, 0x72, 
+    0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 
+    0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x77, 
+    0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x40, 0x4e, 0x43, 0x55, 0x52, 
+    0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 
+    0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x6d, 0x65, 0x6d, 0x73, 0x65, 0x74, 
+    0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 0x2e, 0x32, 0x2e, 0x35, 
+    0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 
+    0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 
+    0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x73, 
+    0x74, 0x72, 0x6e, 0x63, 0x61, 0x74, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 
+    0x5f, 0x32, 0x2e, 0x32, 0x2e, 0x35, 0x00, 0x6b, 0x65, 0x79, 0x70, 0x61, 
+    0x64, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x54, 
+    0x49, 0x4e, 0x46, 0x4f, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 
+    0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x77, 0x61, 0x74, 0x74, 0x72, 0x5f, 
+    0x6f, 0x6e, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 
+    0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 
+    0x00, 0x63, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x40, 0x47, 0x4c, 0x49, 0x42, 
+    0x43, 0x5f, 0x32, 0x2e, 0x32, 0x2e, 0x35, 0x00, 0x5f, 0x5f, 0x67, 0x6d, 
+    0x6f, 0x6e, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5f, 0x5f, 0x00, 0x6d, 
+    0x76, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x77, 0x40, 0x4e, 0x43, 0x55, 0x52, 
+    0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 
+    0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x63, 0x62, 0x72, 0x65, 0x61, 0x6b, 
+    0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x54, 0x49, 
+    0x4e, 0x46, 0x4f, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 
+    0x31, 0x30, 0x32, 0x33, 0x00, 0x69, 0x6e, 0x69, 0x74, 0x5f, 0x70, 0x61, 
+    0x69, 0x72, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 
+    0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 
+    0x00, 0x6d, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x40, 0x47, 0x4c, 0x49, 0x42, 
+    0x43, 0x5f, 0x32, 0x2e, 0x32, 0x2e, 0x35, 0x00, 0x6d, 0x65, 0x6d, 0x6d, 
+    0x6f, 0x76, 0x65, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 0x2e, 
+    0x32, 0x2e, 0x35, 0x00, 0x75, 0x69, 0x5f, 0x64, 0x69, 0x73, 0x70, 0x61, 
+    0x74, 0x63, 0x68, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x77, 0x6d, 
+    0x6f, 0x76, 0x65, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 
+    0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 
+    0x33, 0x00, 0x77, 0x63, 0x6c, 0x72, 0x74, 0x6f, 0x65, 0x6f, 0x6c, 0x40, 
+    0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 
+    0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x77, 0x61, 
+    0x64, 0x64, 0x63, 0x68, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 
+    0x36, 0x5f, 0x35, 0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 
+    0x32, 0x33, 0x00, 0x5f, 0x49, 0x54, 0x4d, 0x5f, 0x72, 0x65, 0x67, 0x69, 
+    0x73, 0x74, 0x65, 0x72, 0x54, 0x4d, 0x43, 0x6c, 0x6f, 0x6e, 0x65, 0x54, 
+    0x61, 0x62, 0x6c, 0x65, 0x00, 0x65, 0x6e, 0x64, 0x77, 0x69, 0x6e, 0x40, 
+    0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 0x30, 
+    0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x73, 0x74, 
+    0x72, 0x64, 0x75, 0x70, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 
+    0x2e, 0x32, 0x2e, 0x35, 0x00, 0x77, 0x61, 0x64, 0x64, 0x6e, 0x73, 0x74, 
+    0x72, 0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 
+    0x2e, 0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 
+    0x5f, 0x5f, 0x63, 0x78, 0x61, 0x5f, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x69, 
+    0x7a, 0x65, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 0x2e, 0x32, 
+    0x2e, 0x35, 0x00, 0x77, 0x61, 0x74, 0x74, 0x72, 0x5f, 0x6f, 0x66, 0x66, 
+    0x40, 0x4e, 0x43, 0x55, 0x52, 0x53, 0x45, 0x53, 0x36, 0x5f, 0x35, 0x2e, 
+    0x30, 0x2e, 0x31, 0x39, 0x39, 0x39, 0x31, 0x30, 0x32, 0x33, 0x00, 0x5f, 
+    0x5f, 0x63, 0x74, 0x79, 0x70, 0x65, 0x5f, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 
+    0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 0x32, 0x2e, 0x33, 0x00, 0x75, 
+    0x73, 0x6c, 0x65, 0x65, 0x70, 0x40, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 
+    0x32, 0x2e, 0x32, 0x2e, 0x35, 0x00, 0x00, 0x2e, 0x73, 0x79, 0x6d, 0x74, 
+    0x61, 0x62, 0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 
+    0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x6e, 0x6f, 
+    0x74, 0x65, 0x2e, 0x67, 0x6e, 0x75, 0x2e, 0x62, 0x75, 0x69, 0x6c, 0x64, 
+    0x2d, 0x69, 0x64, 0x00, 0x2e, 0x67, 0x6e, 0x75, 0x2e, 0x68, 0x61, 0x73, 
+    0x68, 0x00, 0x2e, 0x64, 0x79, 0x6e, 0x73, 0x79, 0x6d, 0x00, 0x2e, 0x64, 
+    0x79, 0x6e, 0x73, 0x74, 0x72, 0x00, 0x2e, 0x67, 0x6e, 0x75, 0x2e, 0x76, 
+    0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x2e, 0x67, 0x6e, 0x75, 0x2e, 
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x72, 0x00, 0x2e, 0x72, 
+    0x65, 0x6c, 0x61, 0x2e, 0x64, 0x79, 0x6e, 0x00, 0x2e, 0x72, 0x65, 0x6c, 
+    0x61, 0x2e, 0x70, 0x6c, 0x74, 0x00, 0x2e, 0x69, 0x6e, 0x69, 0x74, 0x00, 
+    0x2e, 0x70, 0x6c, 0x74, 0x2e, 0x67, 0x6f, 0x74, 0x00, 0x2e, 0x74, 0x65, 
+    0x78, 0x74, 0x00, 0x2e, 0x66, 0x69, 0x6e, 0x69, 0x00, 0x2e, 0x72, 0x6f, 
+    0x64, 0x61, 0x74, 0x61, 0x00, 0x2e, 0x65, 0x68, 0x5f, 0x66, 0x72, 0x61, 
+    0x6d, 0x65, 0x5f, 0x68, 0x64, 0x72, 0x00, 0x2e, 0x65, 0x68, 0x5f, 0x66, 
+    0x72, 0x61, 0x6d, 0x65, 0x00, 0x2e, 0x69, 0x6e, 0x69, 0x74, 0x5f, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x00, 0x2e, 0x66, 0x69, 0x6e, 0x69, 0x5f, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x00, 0x2e, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 
+    0x63, 0x00, 0x2e, 0x67, 0x6f, 0x74, 0x2e, 0x70, 0x6c, 0x74, 0x00, 0x2e, 
+    0x64, 0x61, 0x74, 0x61, 0x00, 0x2e, 0x62, 0x73, 0x73, 0x00, 0x2e, 0x63, 
+    0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+    0xf6, 0xff, 0xff, 0x6f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x38, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0x6f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x55, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x6f, 0x02, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x68, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x68, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x08, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xd8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0a, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x40, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x50, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x2e, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x9b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x52, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 
+    0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd8, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x5d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xbf, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe0, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x6d, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe8, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xc8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x5f, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xd4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe8, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x71, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xb0, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x61, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xe8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xb0, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xd8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 
+    0x2f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x69, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xb2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x82, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+
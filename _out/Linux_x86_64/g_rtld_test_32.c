@@ -0,0 +1,235 @@
+/*
+ * THIS FILE IS AUTOMATICALLY GENERATED - DO NOT EDIT
+ *
+ * This file contains the contents of the file "rtld_test_Linux-x86"
+ * as the byte array rtld_test_array_32[].
+ */
+
+const int rtld_test_array_32_size = 2668;
+
+const unsigned char rtld_test_array_32[2668] = {
+    0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x10, 0x83, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x07, 0x00, 0x28, 0x00, 
+    0x19, 0x00, 0x18, 0x00, 0x06, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+    0x34, 0x80, 0x04, 0x08, 0x34, 0x80, 0x04, 0x08, 0xe0, 0x00, 0x00, 0x00, 
+    0xe0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x14, 0x81, 0x04, 0x08, 
+    0x14, 0x81, 0x04, 0x08, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08, 0x00, 0x80, 0x04, 0x08, 
+    0xb4, 0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+    0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 
+    0xb4, 0x94, 0x04, 0x08, 0xb4, 0x94, 0x04, 0x08, 0x10, 0x01, 0x00, 0x00, 
+    0x2c, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0xc8, 0x94, 0x04, 0x08, 
+    0xc8, 0x94, 0x04, 0x08, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x28, 0x01, 0x00, 0x00, 0x28, 0x81, 0x04, 0x08, 0x28, 0x81, 0x04, 0x08, 
+    0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x51, 0xe5, 0x74, 0x64, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x6c, 0x64, 0x2d, 0x6c, 0x69, 0x6e, 0x75, 
+    0x78, 0x2e, 0x73, 0x6f, 0x2e, 0x32, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4e, 0x55, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+    0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x12, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x70, 0x84, 0x04, 0x08, 
+    0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x4a, 0x00, 0x00, 0x00, 
+    0xc4, 0x95, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xf1, 0xff, 
+    0x43, 0x00, 0x00, 0x00, 0xc4, 0x95, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x00, 0xf1, 0xff, 0x56, 0x00, 0x00, 0x00, 0xe0, 0x95, 0x04, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xf1, 0xff, 0x00, 0x6c, 0x69, 0x62, 
+    0x47, 0x4c, 0x2e, 0x73, 0x6f, 0x2e, 0x31, 0x00, 0x6c, 0x69, 0x62, 0x45, 
+    0x47, 0x4c, 0x2e, 0x73, 0x6f, 0x2e, 0x31, 0x00, 0x6c, 0x69, 0x62, 0x63, 
+    0x2e, 0x73, 0x6f, 0x2e, 0x36, 0x00, 0x5f, 0x49, 0x4f, 0x5f, 0x73, 0x74, 
+    0x64, 0x69, 0x6e, 0x5f, 0x75, 0x73, 0x65, 0x64, 0x00, 0x5f, 0x5f, 0x6c, 
+    0x69, 0x62, 0x63, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5f, 0x6d, 0x61, 
+    0x69, 0x6e, 0x00, 0x5f, 0x65, 0x64, 0x61, 0x74, 0x61, 0x00, 0x5f, 0x5f, 
+    0x62, 0x73, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x5f, 0x65, 
+    0x6e, 0x64, 0x00, 0x5f, 0x5f, 0x67, 0x6d, 0x6f, 0x6e, 0x5f, 0x73, 0x74, 
+    0x61, 0x72, 0x74, 0x5f, 0x5f, 0x00, 0x47, 0x4c, 0x49, 0x42, 0x43, 0x5f, 
+    0x32, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
+    0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x10, 0x69, 0x69, 0x0d, 0x00, 0x00, 0x02, 0x00, 0x6a, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0x95, 0x04, 0x08, 0x06, 0x01, 0x00, 0x00, 
+    0xb0, 0x95, 0x04, 0x08, 0x07, 0x01, 0x00, 0x00, 0xb4, 0x95, 0x04, 0x08, 
+    0x07, 0x02, 0x00, 0x00, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x14, 0x53, 0xe8, 
+    0x00, 0x00, 0x00, 0x00, 0x5b, 0x81, 0xc3, 0xf4, 0x12, 0x00, 0x00, 0x83, 
+    0xbb, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x74, 0x05, 0xe8, 0x2b, 0x00, 0x00, 
+    0x00, 0x8d, 0x76, 0x00, 0xe8, 0xc3, 0x00, 0x00, 0x00, 0xe8, 0x3e, 0x01, 
+    0x00, 0x00, 0x5b, 0xc9, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x35, 0xa8, 0x95, 0x04, 0x08, 0xff, 0x25, 
+    0xac, 0x95, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0x25, 0xb0, 0x95, 
+    0x04, 0x08, 0x68, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe0, 0xff, 0xff, 0xff, 
+    0xff, 0x25, 0xb4, 0x95, 0x04, 0x08, 0x68, 0x08, 0x00, 0x00, 0x00, 0xe9, 
+    0xd0, 0xff, 0xff, 0xff, 0x31, 0xed, 0x5e, 0x89, 0xe1, 0x83, 0xe4, 0xf8, 
+    0x50, 0x54, 0x52, 0x68, 0x50, 0x84, 0x04, 0x08, 0x68, 0xa4, 0x82, 0x04, 
+    0x08, 0x51, 0x56, 0x68, 0xf0, 0x83, 0x04, 0x08, 0xe8, 0xcf, 0xff, 0xff, 
+    0xff, 0xf4, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 
+    0x90, 0x90, 0x90, 0x90, 0x55, 0x89, 0xe5, 0x83, 0xec, 0x08, 0x80, 0x3d, 
+    0xc4, 0x95, 0x04, 0x08, 0x00, 0x74, 0x0c, 0xeb, 0x31, 0x83, 0xc0, 0x04, 
+    0xa3, 0xc0, 0x95, 0x04, 0x08, 0xff, 0xd2, 0xa1, 0xc0, 0x95, 0x04, 0x08, 
+    0x8b, 0x10, 0x85, 0xd2, 0x75, 0xeb, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x85, 
+    0xc0, 0x74, 0x0c, 0xc7, 0x04, 0x24, 0xb0, 0x84, 0x04, 0x08, 0xe8, 0x85, 
+    0x7c, 0xfb, 0xf7, 0xc6, 0x05, 0xc4, 0x95, 0x04, 0x08, 0x01, 0xc9, 0xc3, 
+    0x8d, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xbf, 0x00, 0x00, 0x00, 0x00, 
+    0x55, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xe5, 0x83, 0xec, 0x18, 0xe8, 
+    0x00, 0x00, 0x00, 0x00, 0x5a, 0x81, 0xc2, 0x04, 0x12, 0x00, 0x00, 0x85, 
+    0xc0, 0x74, 0x1f, 0x89, 0x54, 0x24, 0x0c, 0x31, 0xc9, 0xba, 0xc8, 0x95, 
+    0x04, 0x08, 0x89, 0x4c, 0x24, 0x08, 0x89, 0x54, 0x24, 0x04, 0xc7, 0x04, 
+    0x24, 0xb0, 0x84, 0x04, 0x08, 0xe8, 0x36, 0x7c, 0xfb, 0xf7, 0xa1, 0xc4, 
+    0x94, 0x04, 0x08, 0x85, 0xc0, 0x74, 0x12, 0xb8, 0x00, 0x00, 0x00, 0x00, 
+    0x85, 0xc0, 0x74, 0x09, 0xc7, 0x04, 0x24, 0xc4, 0x94, 0x04, 0x08, 0xff, 
+    0xd0, 0xc9, 0xc3, 0x89, 0xf6, 0x8d, 0xbc, 0x27, 0x00, 0x00, 0x00, 0x00, 
+    0x8d, 0x4c, 0x24, 0x04, 0x83, 0xe4, 0xf0, 0xff, 0x71, 0xfc, 0x31, 0xc0, 
+    0x55, 0x89, 0xe5, 0x51, 0x59, 0x5d, 0x8d, 0x61, 0xfc, 0xc3, 0x90, 0x90, 
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x55, 0x89, 0xe5, 0x53, 
+    0x83, 0xec, 0x04, 0xa1, 0xb4, 0x94, 0x04, 0x08, 0x83, 0xf8, 0xff, 0x74, 
+    0x1f, 0x31, 0xdb, 0x8d, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xbc, 0x27, 
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x8b, 0x83, 0xb0, 0x94, 0x04, 0x08, 
+    0x83, 0xeb, 0x04, 0x83, 0xf8, 0xff, 0x75, 0xf0, 0x58, 0x5b, 0x5d, 0xc3, 
+    0x8d, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xbf, 0x00, 0x00, 0x00, 0x00, 
+    0x55, 0x89, 0xe5, 0x83, 0xec, 0x14, 0x53, 0xe8, 0x00, 0x00, 0x00, 0x00, 
+    0x5b, 0x81, 0xc3, 0x48, 0x11, 0x00, 0x00, 0x90, 0xe8, 0xd7, 0xfe, 0xff, 
+    0xff, 0x5b, 0xc9, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 
+    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7a, 0x52, 0x00, 
+    0x01, 0x7c, 0x08, 0x01, 0x1b, 0x0c, 0x04, 0x04, 0x88, 0x01, 0x00, 0x00, 
+    0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0xfe, 0xff, 0xff, 
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x46, 0x0e, 0x0c, 0x4a, 0x0f, 
+    0x0b, 0x74, 0x04, 0x78, 0x00, 0x3f, 0x1a, 0x3b, 0x2a, 0x32, 0x24, 0x22, 
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0xa4, 0x82, 0x04, 0x08, 0x0d, 0x00, 0x00, 0x00, 
+    0x50, 0x84, 0x04, 0x08, 0x04, 0x00, 0x00, 0x00, 0x48, 0x81, 0x04, 0x08, 
+    0x05, 0x00, 0x00, 0x00, 0xe8, 0x81, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, 
+    0x78, 0x81, 0x04, 0x08, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa4, 0x95, 0x04, 0x08, 
+    0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+    0x11, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x94, 0x82, 0x04, 0x08, 
+    0x11, 0x00, 0x00, 0x00, 0x8c, 0x82, 0x04, 0x08, 0x12, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0xfe, 0xff, 0xff, 0x6f, 0x6c, 0x82, 0x04, 0x08, 0xff, 0xff, 0xff, 0x6f, 
+    0x01, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x6f, 0x5c, 0x82, 0x04, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc8, 0x94, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x82, 0x04, 0x08, 0x06, 0x83, 0x04, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x94, 0x04, 0x08, 
+    0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x00, 0x2e, 0x6e, 0x6f, 0x74, 0x65, 
+    0x2e, 0x41, 0x42, 0x49, 0x2d, 0x74, 0x61, 0x67, 0x00, 0x2e, 0x68, 0x61, 
+    0x73, 0x68, 0x00, 0x2e, 0x64, 0x79, 0x6e, 0x73, 0x79, 0x6d, 0x00, 0x2e, 
+    0x64, 0x79, 0x6e, 0x73, 0x74, 0x72, 0x00, 0x2e, 0x67, 0x6e, 0x75, 0x2e, 
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x2e, 0x67, 0x6e, 0x75, 
+    0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x72, 0x00, 0x2e, 
+    0x72, 0x65, 0x6c, 0x2e, 0x64, 0x79, 0x6e, 0x00, 0x2e, 0x72, 0x65, 0x6c, 
+    0x2e, 0x70, 0x6c, 0x74, 0x00, 0x2e, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x2e, 
+    0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x66, 0x69, 0x6e, 0x69, 0x00, 0x2e, 
+    0x72, 0x6f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x2e, 0x65, 0x68, 0x5f, 0x66, 
+    0x72, 0x61, 0x6d, 0x65, 0x00, 0x2e, 0x63, 0x74, 0x6f, 0x72, 0x73, 0x00, 
+    0x2e, 0x64, 0x74, 0x6f, 0x72, 0x73, 0x00, 0x2e, 0x6a, 0x63, 0x72, 0x00, 
+    0x2e, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x00, 0x2e, 0x67, 0x6f, 
+    0x74, 0x00, 0x2e, 0x67, 0x6f, 0x74, 0x2e, 0x70, 0x6c, 0x74, 0x00, 0x2e, 
+    0x64, 0x61, 0x74, 0x61, 0x00, 0x2e, 0x62, 0x73, 0x73, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x14, 0x81, 0x04, 0x08, 0x14, 0x01, 0x00, 0x00, 
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 
+    0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x81, 0x04, 0x08, 
+    0x28, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x48, 0x81, 0x04, 0x08, 0x48, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x78, 0x81, 0x04, 0x08, 0x78, 0x01, 0x00, 0x00, 
+    0x70, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x81, 0x04, 0x08, 
+    0xe8, 0x01, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x37, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6f, 0x02, 0x00, 0x00, 0x00, 
+    0x5c, 0x82, 0x04, 0x08, 0x5c, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x02, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x6f, 
+    0x02, 0x00, 0x00, 0x00, 0x6c, 0x82, 0x04, 0x08, 0x6c, 0x02, 0x00, 0x00, 
+    0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 
+    0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x8c, 0x82, 0x04, 0x08, 
+    0x8c, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+    0x5c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x94, 0x82, 0x04, 0x08, 0x94, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0xa4, 0x82, 0x04, 0x08, 0xa4, 0x02, 0x00, 0x00, 
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x82, 0x04, 0x08, 
+    0xe0, 0x02, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x6b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x10, 0x83, 0x04, 0x08, 0x10, 0x03, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x06, 0x00, 0x00, 0x00, 0x50, 0x84, 0x04, 0x08, 0x50, 0x04, 0x00, 0x00, 
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x84, 0x04, 0x08, 
+    0x6c, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x7f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+    0x74, 0x84, 0x04, 0x08, 0x74, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0xb4, 0x94, 0x04, 0x08, 0xb4, 0x04, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xbc, 0x94, 0x04, 0x08, 
+    0xbc, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x97, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0xc4, 0x94, 0x04, 0x08, 0xc4, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0xc8, 0x94, 0x04, 0x08, 0xc8, 0x04, 0x00, 0x00, 
+    0xd8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa0, 0x95, 0x04, 0x08, 
+    0xa0, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0xaa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0xa4, 0x95, 0x04, 0x08, 0xa4, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x00, 0xb8, 0x95, 0x04, 0x08, 0xb8, 0x05, 0x00, 0x00, 
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 
+    0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc4, 0x95, 0x04, 0x08, 
+    0xc4, 0x05, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+
@@ -0,0 +1 @@
+#define NVIDIA_VERSION "460.32.03"
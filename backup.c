@@ -33,6 +33,8 @@
 #include <sys/mman.h>
 #include <ctype.h>
 #include <stdlib.h>
+#include <inttypes.h>
+#include <pthread.h>
 
 #include "nvidia-installer.h"
 #include "user-interface.h"
@@ -46,6 +48,7 @@
 #define BACKUP_DIRECTORY "/var/lib/nvidia"
 #define BACKUP_LOG       (BACKUP_DIRECTORY "/log")
 #define BACKUP_MKDIR_LOG (BACKUP_DIRECTORY "/dirs")
+#define BACKUP_LOG_INDEX (BACKUP_DIRECTORY "/log.idx")
 
 
 
@@ -64,6 +67,7 @@
  * 3. The rest of the file is file entries; a file entry can be any one of:
  *
  * INSTALLED_FILE: <filename>
+ *  <crc> [<metadata>]
  *
  * INSTALLED_SYMLINK: <filename>
  *  <target>
@@ -73,10 +77,64 @@
  *  <permissions> <uid> <gid>
  *
  * BACKED_UP_FILE_NUM: <filename>
- *  <filesize> <permissions> <uid> <gid>
+ *  <crc> <permissions> <uid> <gid> [<metadata>]
  *
+ * where the optional <metadata> is "<size> <mtime_ns> <inode> <device>"
+ * of the installed file, or of the backup copy in BACKUP_DIRECTORY.  It
+ * is appended after the fields that older nvidia-installers parse, which
+ * ignore it; entries without it are always validated by checksum.
+ *
+ *
+ * The text log is the source of truth, and is all that older
+ * nvidia-installers understand.  When an installation completes, a
+ * binary index of the log (BACKUP_LOG_INDEX) is also written, so that
+ * the log can be loaded without parsing it, and files can be looked up
+ * by path.  Its layout is:
+ *
+ * BackupLogIndexHeader
+ * BackupLogIndexRecord[num_records], in log order
+ * uint32 hash[hash_size]: open addressing hash table of the records,
+ *   keyed by filename; each slot holds a record index + 1, or 0
+ * char strings[strings_size]: NUL-terminated strings, referenced by
+ *   offset from the header and the records
+ *
+ * All values are in host byte order.  The header records the size and
+ * modification time of the text log that was indexed; if the text log
+ * has changed since (e.g., it was appended to by an installer that does
+ * not know about the index), the index is ignored.
  */
 
+#define BACKUP_LOG_INDEX_MAGIC   "NVBKIDX"
+#define BACKUP_LOG_INDEX_VERSION 2
+#define BACKUP_LOG_INDEX_NONE    0xffffffff
+
+typedef struct {
+    char   magic[8];
+    uint32 version;
+    uint32 num_records;
+    uint32 hash_size;
+    uint32 strings_size;
+    uint32 version_offset;
+    uint32 description_offset;
+    uint64_t log_size;
+    uint64_t log_mtime_ns;
+} BackupLogIndexHeader;
+
+typedef struct {
+    int32_t num;
+    uint32 filename_offset;
+    uint32 target_offset;
+    uint32 crc;
+    uint32 mode;
+    uint32 uid;
+    uint32 gid;
+    uint32 has_metadata;
+    uint64_t size;
+    uint64_t mtime_ns;
+    uint64_t ino;
+    uint64_t dev;
+} BackupLogIndexRecord;
+
 #define BACKUP_LOG_PERMS (S_IRUSR|S_IWUSR)
 
 #define BACKUP_DIRECTORY_PERMS (S_IRUSR|S_IWUSR|S_IXUSR)
@@ -96,6 +154,7 @@ typedef struct {
     mode_t mode;
     uid_t  uid;
     gid_t  gid;
+    FileMetadata metadata;
     int    ok;
     
 } BackupLogEntry;
@@ -106,6 +165,11 @@ typedef struct {
     char *description;
     BackupLogEntry *e;
     int n;
+    int capacity;
+
+    /* if loaded from the index, the strings point into this mapping */
+    void *map;
+    size_t map_length;
 } BackupInfo;
 
 
@@ -124,6 +188,162 @@ static char *create_backwards_compatible_version_string(const char *str);
 
 static int reverse_strlen_compare(const void *a, const void *b);
 
+static BackupLogEntry *add_backup_log_entry(BackupInfo *b);
+
+static void index_backup_log_entry(int num, const char *filename,
+                                   const char *target, uint32 crc,
+                                   mode_t mode, uid_t uid, gid_t gid,
+                                   const FileMetadata *metadata);
+
+static int write_backup_log_index(Options *op, BackupInfo *b);
+
+
+
+/*
+ * Backup log writer: between init_backup() and close_backup_log(), the
+ * backup log and the mkdir log are kept open, with full buffering, for
+ * the whole installation transaction; entries only reach the disk at
+ * the commit points (commit_backup_log()).  Outside of a transaction,
+ * each entry is appended by opening and closing the file, as before.
+ */
+
+#define BACKUP_LOG_BUFFER_SIZE (64 * 1024)
+
+typedef struct {
+    const char *filename;
+    const char *name;   /* for error messages */
+    FILE *stream;       /* open stream, while a transaction is open */
+} BackupLogFile;
+
+static BackupLogFile backup_log = { BACKUP_LOG,       "backup log", NULL };
+static BackupLogFile mkdir_log  = { BACKUP_MKDIR_LOG, "mkdir log",  NULL };
+
+static int backup_transaction_open = FALSE;
+
+/* entries logged during the transaction, for the backup log index */
+
+static BackupInfo *backup_transaction_info = NULL;
+
+
+/*
+ * backup_log_begin() - return a stream for appending entries to the
+ * given log file; pair with backup_log_end().
+ */
+
+static FILE *backup_log_begin(Options *op, BackupLogFile *f)
+{
+    FILE *stream;
+
+    if (f->stream) return f->stream;
+
+    stream = fopen(f->filename, "a");
+    if (!stream) {
+        ui_error(op, "Unable to open %s file '%s' (%s).",
+                 f->name, f->filename, strerror(errno));
+        return NULL;
+    }
+
+    if (backup_transaction_open) {
+        setvbuf(stream, NULL, _IOFBF, BACKUP_LOG_BUFFER_SIZE);
+        f->stream = stream;
+    }
+
+    return stream;
+}
+
+
+/*
+ * backup_log_end() - finish appending entries to the given log file;
+ * the stream is only closed if no transaction is open.
+ */
+
+static int backup_log_end(Options *op, BackupLogFile *f, FILE *stream)
+{
+    if (stream == f->stream) {
+        if (ferror(stream)) {
+            ui_error(op, "Error while writing %s file '%s'.",
+                     f->name, f->filename);
+            return FALSE;
+        }
+        return TRUE;
+    }
+
+    if (fclose(stream) != 0) {
+        ui_error(op, "Error while closing %s file '%s' (%s).",
+                 f->name, f->filename, strerror(errno));
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+
+static int commit_backup_log_file(Options *op, BackupLogFile *f)
+{
+    if (!f->stream) return TRUE;
+
+    if (fflush(f->stream) != 0 || fsync(fileno(f->stream)) != 0) {
+        ui_error(op, "Error while writing %s file '%s' (%s).",
+                 f->name, f->filename, strerror(errno));
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+
+/*
+ * commit_backup_log() - write all buffered backup log entries to disk;
+ * this is done after the backups and after the installs, so that the
+ * log on disk always describes a consistent state of the system.
+ */
+
+int commit_backup_log(Options *op)
+{
+    int ret = TRUE;
+
+    if (!commit_backup_log_file(op, &backup_log)) ret = FALSE;
+    if (!commit_backup_log_file(op, &mkdir_log)) ret = FALSE;
+
+    return ret;
+
+} /* commit_backup_log() */
+
+
+/*
+ * close_backup_log() - commit and close the logs opened by
+ * init_backup(), ending the installation transaction.
+ */
+
+int close_backup_log(Options *op)
+{
+    int ret = commit_backup_log(op);
+    BackupLogFile *logs[] = { &backup_log, &mkdir_log };
+    int i;
+
+    for (i = 0; i < ARRAY_LEN(logs); i++) {
+        if (logs[i]->stream && fclose(logs[i]->stream) != 0) {
+            ui_error(op, "Error while closing %s file '%s' (%s).",
+                     logs[i]->name, logs[i]->filename, strerror(errno));
+            ret = FALSE;
+        }
+        logs[i]->stream = NULL;
+    }
+
+    backup_transaction_open = FALSE;
+
+    if (backup_transaction_info) {
+        if (ret) {
+            write_backup_log_index(op, backup_transaction_info);
+        }
+        free_backup_info(backup_transaction_info);
+        backup_transaction_info = NULL;
+    }
+
+    return ret;
+
+} /* close_backup_log() */
+
 
 
 
@@ -131,7 +351,8 @@ static int reverse_strlen_compare(const void *a, const void *b);
 /*
  * init_backup() - initialize the backup engine; this consists of
  * creating a new backup directory, and writing to the log file that
- * we're about to install a new driver version.
+ * we're about to install a new driver version.  The log is kept open
+ * until close_backup_log() is called.
  */
 
 int init_backup(Options *op, Package *p)
@@ -183,22 +404,41 @@ int init_backup(Options *op, Package *p)
     fprintf(log, "%s\n", version);
     fprintf(log, "%s\n", p->description);
 
-    nvfree(version);
-        
-    /* close the log file */
+    free_backup_info(backup_transaction_info);
+    backup_transaction_info = nvalloc(sizeof(BackupInfo));
+    backup_transaction_info->version = version;
+    backup_transaction_info->description = nvstrdup(p->description);
 
-    if (fclose(log) != 0) {
-        ui_error(op, "Error while closing backup log file '%s' (%s).",
-                 BACKUP_LOG, strerror(errno));
-        return FALSE;
-    }
+    /* keep the log file open for the installation transaction */
 
-    return TRUE;
+    setvbuf(log, NULL, _IOFBF, BACKUP_LOG_BUFFER_SIZE);
+    backup_log.stream = log;
+    backup_transaction_open = TRUE;
+
+    return commit_backup_log(op);
     
 } /* init_backup() */
 
 
 
+/*
+ * write_file_metadata() - terminate a CRC line of the backup log,
+ * appending the file metadata, if known.
+ */
+
+static void write_file_metadata(FILE *log, const FileMetadata *metadata)
+{
+    if (metadata->valid) {
+        fprintf(log, " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64,
+                metadata->size, metadata->mtime_ns, metadata->ino,
+                metadata->dev);
+    }
+
+    fprintf(log, "\n");
+}
+
+
+
 /*
  * do_backup() - backup the specified file.  If it is a regular file,
  * just move it into the backup directory, and add an entry to the log
@@ -208,19 +448,18 @@ int init_backup(Options *op, Package *p)
 int do_backup(Options *op, const char *filename)
 {
     int len, ret, ret_val;
-    struct stat stat_buf;
+    struct stat stat_buf, backup_stat;
     char *tmp = NULL;
     FILE *log;
     uint32 crc;
+    FileMetadata metadata;
 
     static int backup_file_number = BACKED_UP_FILE_NUM;
 
     ret_val = FALSE;
 
-    log = fopen(BACKUP_LOG, "a");
+    log = backup_log_begin(op, &backup_log);
     if (!log) {
-        ui_error(op, "Unable to open backup log file '%s' (%s).",
-                 BACKUP_LOG, strerror(errno));
         return FALSE;
     }
     
@@ -248,9 +487,23 @@ int do_backup(Options *op, const char *filename)
         
         fprintf(log, "%d: %s\n", backup_file_number, filename);
         
-        /* write the filesize, permissions, uid, gid */
-        fprintf(log, "%u %04o %d %d\n", crc, stat_buf.st_mode,
+        /*
+         * write the crc, permissions, uid, gid, and the metadata of
+         * the backup copy
+         */
+
+        memset(&metadata, 0, sizeof(metadata));
+        if (lstat(tmp, &backup_stat) == 0) {
+            get_file_metadata(&backup_stat, &metadata);
+        }
+
+        fprintf(log, "%u %04o %d %d", crc, stat_buf.st_mode,
                 stat_buf.st_uid, stat_buf.st_gid);
+        write_file_metadata(log, &metadata);
+
+        index_backup_log_entry(backup_file_number, filename, NULL, crc,
+                               stat_buf.st_mode, stat_buf.st_uid,
+                               stat_buf.st_gid, &metadata);
         
         backup_file_number++;
     } else if (S_ISLNK(stat_buf.st_mode)) {
@@ -267,6 +520,10 @@ int do_backup(Options *op, const char *filename)
         fprintf(log, "%s\n", tmp);
         fprintf(log, "%04o %d %d\n", stat_buf.st_mode,
                 stat_buf.st_uid, stat_buf.st_gid);
+
+        index_backup_log_entry(BACKED_UP_SYMLINK, filename, tmp, 0,
+                               stat_buf.st_mode, stat_buf.st_uid,
+                               stat_buf.st_gid, NULL);
     } else if (S_ISDIR(stat_buf.st_mode)) {
 
         /* XXX IMPLEMENT ME: recursive moving of a directory */
@@ -285,11 +542,7 @@ int do_backup(Options *op, const char *filename)
 
     nvfree(tmp);
 
-    /* close the log file */
-
-    if (fclose(log) != 0) {
-        ui_error(op, "Error while closing backup log file '%s' (%s).",
-                 BACKUP_LOG, strerror(errno));
+    if (!backup_log_end(op, &backup_log, log)) {
         ret_val = FALSE;
     }
     
@@ -299,35 +552,39 @@ int do_backup(Options *op, const char *filename)
 
 
 
-int log_install_file(Options *op, const char *filename)
+int log_install_file(Options *op, const char *filename, const uint32 *crc,
+                     const FileMetadata *metadata)
 {
     FILE *log;
-    uint32 crc;
+    uint32 file_crc;
+    struct stat stat_buf;
+    FileMetadata file_metadata;
     
-    /* open the log file */
-
-    log = fopen(BACKUP_LOG, "a");
+    log = backup_log_begin(op, &backup_log);
     if (!log) {
-        ui_error(op, "Unable to open backup log file '%s' (%s).",
-                 BACKUP_LOG, strerror(errno));
         return FALSE;
     }
+
+    file_crc = crc ? *crc : compute_crc(op, filename);
+
+    if (metadata) {
+        file_metadata = *metadata;
+    } else {
+        memset(&file_metadata, 0, sizeof(file_metadata));
+        if (lstat(filename, &stat_buf) == 0) {
+            get_file_metadata(&stat_buf, &file_metadata);
+        }
+    }
     
     fprintf(log, "%d: %s\n", INSTALLED_FILE, filename);
     
-    crc = compute_crc(op, filename);
-
-    fprintf(log, "%u\n", crc);
-    
-    /* close the log file */
+    fprintf(log, "%u", file_crc);
+    write_file_metadata(log, &file_metadata);
 
-    if (fclose(log) != 0) {
-        ui_error(op, "Error while closing backup log file '%s' (%s).",
-                 BACKUP_LOG, strerror(errno));
-        return FALSE;
-    }
+    index_backup_log_entry(INSTALLED_FILE, filename, NULL, file_crc, 0, 0, 0,
+                           &file_metadata);
     
-    return TRUE;
+    return backup_log_end(op, &backup_log, log);
 
 } /* log_install_file() */
 
@@ -337,27 +594,18 @@ int log_create_symlink(Options *op, const char *filename, const char *target)
 {
     FILE *log;
     
-    /* open the log file */
-
-    log = fopen(BACKUP_LOG, "a");
+    log = backup_log_begin(op, &backup_log);
     if (!log) {
-        ui_error(op, "Unable to open backup log file '%s' (%s).",
-                 BACKUP_LOG, strerror(errno));
         return FALSE;
     }
     
     fprintf(log, "%d: %s\n", INSTALLED_SYMLINK, filename);
     fprintf(log, "%s\n", target);
-    
-    /* close the log file */
 
-    if (fclose(log) != 0) {
-        ui_error(op, "Error while closing backup log file '%s' (%s).",
-                 BACKUP_LOG, strerror(errno));
-        return FALSE;
-    }
+    index_backup_log_entry(INSTALLED_SYMLINK, filename, target, 0, 0, 0, 0,
+                           NULL);
     
-    return TRUE;
+    return backup_log_end(op, &backup_log, log);
 
 } /* log_create_symlink() */
 
@@ -463,6 +711,34 @@ static int parse_crc_mode_uid_gid(const char *buf, uint32 *crc, mode_t *mode,
 }
 
 
+/*
+ * parse_file_metadata() - parse the optional file metadata following
+ * the first num_fields fields of a CRC line of the backup log.  Lines
+ * written by older nvidia-installers leave the metadata invalid.
+ */
+
+static void parse_file_metadata(const char *buf, int num_fields,
+                                FileMetadata *metadata)
+{
+    const char *c = buf;
+    int i;
+
+    memset(metadata, 0, sizeof(FileMetadata));
+
+    for (i = 0; i < num_fields; i++) {
+        while (isspace(*c)) c++;
+        while (*c != '\0' && !isspace(*c)) c++;
+    }
+
+    if (sscanf(c, "%" SCNu64 " %" SCNu64 " %" SCNu64 " %" SCNu64,
+               &metadata->size, &metadata->mtime_ns, &metadata->ino,
+               &metadata->dev) == 4) {
+        metadata->valid = TRUE;
+    }
+
+} /* parse_file_metadata() */
+
+
 static int parse_crc(const char *buf, uint32 *crc)
 {
     char *c, *local_buf, *str;
@@ -512,29 +788,407 @@ int log_mkdir(Options *op, const char *dirs)
         return FALSE;
     }
 
-    /* open the log file */
-
-    log = fopen(BACKUP_MKDIR_LOG, "a");
+    log = backup_log_begin(op, &mkdir_log);
     if (!log) {
-        ui_error(op, "Unable to open mkdir log file '%s' (%s).",
-                 BACKUP_MKDIR_LOG, strerror(errno));
         return FALSE;
     }
 
     fprintf(log, "%s", dirs);
- 
-    /* close the log file */
 
-    if (fclose(log) != 0) {
-        ui_error(op, "Error while closing mkdir log file '%s' (%s).",
-                 BACKUP_MKDIR_LOG, strerror(errno));
+    return backup_log_end(op, &mkdir_log, log);
+}
+
+
+
+/*
+ * add_backup_log_entry() - append a zeroed entry to the BackupInfo,
+ * growing the entry array geometrically.
+ */
+
+static BackupLogEntry *add_backup_log_entry(BackupInfo *b)
+{
+    BackupLogEntry *e;
+
+    if (b->n >= b->capacity) {
+        b->capacity = b->capacity ? b->capacity * 2 : 64;
+        b->e = nvrealloc(b->e, sizeof(BackupLogEntry) * b->capacity);
+    }
+
+    e = &b->e[b->n++];
+    memset(e, 0, sizeof(BackupLogEntry));
+
+    return e;
+
+} /* add_backup_log_entry() */
+
+
+
+/*
+ * index_backup_log_entry() - remember an entry written to the backup
+ * log during the installation transaction, for write_backup_log_index().
+ */
+
+static void index_backup_log_entry(int num, const char *filename,
+                                   const char *target, uint32 crc,
+                                   mode_t mode, uid_t uid, gid_t gid,
+                                   const FileMetadata *metadata)
+{
+    BackupLogEntry *e;
+
+    if (!backup_transaction_info) return;
+
+    e = add_backup_log_entry(backup_transaction_info);
+    e->num = num;
+    e->filename = nvstrdup(filename);
+    e->target = target ? nvstrdup(target) : NULL;
+    e->crc = crc;
+    e->mode = mode;
+    e->uid = uid;
+    e->gid = gid;
+    if (metadata) e->metadata = *metadata;
+    e->ok = TRUE;
+
+} /* index_backup_log_entry() */
+
+
+
+static uint32 backup_log_index_hash(const char *str)
+{
+    uint32 h = 2166136261u;
+
+    while (*str) {
+        h = (h ^ (unsigned char) *str++) * 16777619u;
+    }
+
+    return h;
+}
+
+
+static uint64_t stat_mtime_ns(const struct stat *stat_buf)
+{
+    return (uint64_t) stat_buf->st_mtim.tv_sec * 1000000000ULL +
+           stat_buf->st_mtim.tv_nsec;
+}
+
+
+static uint32 add_index_string(char *strings, uint32 *offset, const char *str)
+{
+    uint32 ret = *offset;
+    size_t len = strlen(str) + 1;
+
+    memcpy(strings + ret, str, len);
+    *offset += len;
+
+    return ret;
+}
+
+
+/*
+ * write_backup_log_index() - write the binary index for the entries in
+ * b, which must match the contents of BACKUP_LOG.  Failure to write the
+ * index is not fatal: readers fall back to parsing the text log.
+ */
+
+static int write_backup_log_index(Options *op, BackupInfo *b)
+{
+    BackupLogIndexHeader header;
+    BackupLogIndexRecord *records;
+    uint32 *hash, offset;
+    char *strings, *tmpname;
+    size_t strings_size, total;
+    struct stat stat_buf;
+    mode_t orig_mode;
+    FILE *index;
+    int i, ret = FALSE;
+
+    if (stat(BACKUP_LOG, &stat_buf) == -1) {
         return FALSE;
     }
-    
-    return TRUE;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BACKUP_LOG_INDEX_MAGIC, sizeof(header.magic));
+    header.version = BACKUP_LOG_INDEX_VERSION;
+    header.num_records = b->n;
+    header.log_size = stat_buf.st_size;
+    header.log_mtime_ns = stat_mtime_ns(&stat_buf);
+
+    /* size the hash table to keep the load factor at or below 1/2 */
+
+    header.hash_size = 16;
+    while (header.hash_size < (uint32) b->n * 2) header.hash_size <<= 1;
+
+    strings_size = strlen(b->version) + strlen(b->description) + 2;
+    for (i = 0; i < b->n; i++) {
+        strings_size += strlen(b->e[i].filename) + 1;
+        if (b->e[i].target) strings_size += strlen(b->e[i].target) + 1;
+    }
+    header.strings_size = strings_size;
+
+    records = nvalloc(sizeof(BackupLogIndexRecord) * (b->n + 1));
+    hash = nvalloc(sizeof(uint32) * header.hash_size);
+    strings = nvalloc(strings_size);
+
+    offset = 0;
+    header.version_offset = add_index_string(strings, &offset, b->version);
+    header.description_offset = add_index_string(strings, &offset,
+                                                 b->description);
+
+    for (i = 0; i < b->n; i++) {
+        BackupLogEntry *e = &b->e[i];
+        BackupLogIndexRecord *r = &records[i];
+        uint32 h = backup_log_index_hash(e->filename) &
+                   (header.hash_size - 1);
+
+        r->num = e->num;
+        r->filename_offset = add_index_string(strings, &offset, e->filename);
+        r->target_offset = e->target ?
+            add_index_string(strings, &offset, e->target) :
+            BACKUP_LOG_INDEX_NONE;
+        r->crc = e->crc;
+        r->mode = e->mode;
+        r->uid = e->uid;
+        r->gid = e->gid;
+        r->has_metadata = e->metadata.valid;
+        r->size = e->metadata.size;
+        r->mtime_ns = e->metadata.mtime_ns;
+        r->ino = e->metadata.ino;
+        r->dev = e->metadata.dev;
+
+        while (hash[h]) h = (h + 1) & (header.hash_size - 1);
+        hash[h] = i + 1;
+    }
+
+    /* write to a temporary file, and atomically move it into place */
+
+    tmpname = nvstrcat(BACKUP_LOG_INDEX, ".tmp", NULL);
+
+    orig_mode = umask(~BACKUP_LOG_PERMS);
+    index = fopen(tmpname, "w");
+    umask(orig_mode);
+
+    if (!index) {
+        ui_log(op, "Unable to create backup log index '%s' (%s).",
+               tmpname, strerror(errno));
+        goto done;
+    }
+
+    total = fwrite(&header, sizeof(header), 1, index) +
+            fwrite(records, sizeof(BackupLogIndexRecord), b->n, index) +
+            fwrite(hash, sizeof(uint32), header.hash_size, index) +
+            fwrite(strings, strings_size, 1, index);
+
+    if (fflush(index) != 0 || fsync(fileno(index)) != 0) total = 0;
+
+    if (fclose(index) != 0 ||
+        total != (size_t) (2 + b->n + header.hash_size) ||
+        rename(tmpname, BACKUP_LOG_INDEX) != 0) {
+        ui_log(op, "Unable to write backup log index '%s'.", BACKUP_LOG_INDEX);
+        unlink(tmpname);
+        goto done;
+    }
+
+    ret = TRUE;
+
+ done:
+
+    nvfree(tmpname);
+    nvfree(records);
+    nvfree(hash);
+    nvfree(strings);
+
+    return ret;
+
+} /* write_backup_log_index() */
+
+
+
+/*
+ * map_backup_log_index() - map and validate BACKUP_LOG_INDEX; it is
+ * only used if it indexes the text log as described by log_stat.
+ * Returns the mapping, or NULL if the index is missing, stale, or
+ * invalid.
+ */
+
+static const BackupLogIndexHeader *map_backup_log_index(const struct stat
+                                                        *log_stat,
+                                                        size_t *length)
+{
+    const BackupLogIndexHeader *header;
+    struct stat stat_buf;
+    uint64_t expected;
+    void *map;
+    int fd;
+
+    if ((fd = open(BACKUP_LOG_INDEX, O_RDONLY)) == -1) return NULL;
+
+    if (fstat(fd, &stat_buf) == -1 ||
+        (stat_buf.st_mode & PERM_MASK) != BACKUP_LOG_PERMS ||
+        stat_buf.st_size < (off_t) sizeof(BackupLogIndexHeader)) {
+        close(fd);
+        return NULL;
+    }
+
+    map = mmap(0, stat_buf.st_size, PROT_READ, MAP_FILE | MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED) return NULL;
+
+    header = map;
+
+    expected = (uint64_t) sizeof(BackupLogIndexHeader) +
+               (uint64_t) header->num_records * sizeof(BackupLogIndexRecord) +
+               (uint64_t) header->hash_size * sizeof(uint32) +
+               header->strings_size;
+
+    if (memcmp(header->magic, BACKUP_LOG_INDEX_MAGIC,
+               sizeof(header->magic)) != 0 ||
+        header->version != BACKUP_LOG_INDEX_VERSION ||
+        header->log_size != (uint64_t) log_stat->st_size ||
+        header->log_mtime_ns != stat_mtime_ns(log_stat) ||
+        expected != (uint64_t) stat_buf.st_size ||
+        header->hash_size == 0 ||
+        (header->hash_size & (header->hash_size - 1)) != 0 ||
+        header->hash_size < header->num_records ||
+        header->strings_size == 0 ||
+        ((const char *) map)[stat_buf.st_size - 1] != '\0') {
+        munmap(map, stat_buf.st_size);
+        return NULL;
+    }
+
+    *length = stat_buf.st_size;
+
+    return header;
+
+} /* map_backup_log_index() */
+
+
+#define INDEX_RECORDS(h) ((const BackupLogIndexRecord *) ((h) + 1))
+#define INDEX_HASH(h) ((const uint32 *) (INDEX_RECORDS(h) + (h)->num_records))
+#define INDEX_STRINGS(h) ((const char *) (INDEX_HASH(h) + (h)->hash_size))
+
+
+static const char *index_string(const BackupLogIndexHeader *header,
+                                uint32 offset)
+{
+    if (offset >= header->strings_size) return NULL;
+
+    return INDEX_STRINGS(header) + offset;
 }
 
 
+/*
+ * read_backup_log_index() - load the backup log from its index, if a
+ * valid index of the text log described by log_stat exists; the
+ * strings of the returned BackupInfo point into the index mapping.
+ */
+
+static BackupInfo *read_backup_log_index(const struct stat *log_stat)
+{
+    const BackupLogIndexHeader *header;
+    const BackupLogIndexRecord *r;
+    BackupInfo *b;
+    size_t length;
+    uint32 i;
+
+    header = map_backup_log_index(log_stat, &length);
+    if (!header) return NULL;
+
+    b = nvalloc(sizeof(BackupInfo));
+    b->map = (void *) header;
+    b->map_length = length;
+    b->version = (char *) index_string(header, header->version_offset);
+    b->description = (char *) index_string(header, header->description_offset);
+    b->n = b->capacity = header->num_records;
+    b->e = nvalloc(sizeof(BackupLogEntry) * (b->n + 1));
+
+    if (!b->version || !b->description) goto fail;
+
+    for (i = 0, r = INDEX_RECORDS(header); i < header->num_records; i++, r++) {
+        BackupLogEntry *e = &b->e[i];
+
+        e->num = r->num;
+        e->filename = (char *) index_string(header, r->filename_offset);
+        e->target = (r->target_offset == BACKUP_LOG_INDEX_NONE) ? NULL :
+            (char *) index_string(header, r->target_offset);
+        e->crc = r->crc;
+        e->mode = r->mode;
+        e->uid = r->uid;
+        e->gid = r->gid;
+        e->metadata.valid = (r->has_metadata != 0);
+        e->metadata.size = r->size;
+        e->metadata.mtime_ns = r->mtime_ns;
+        e->metadata.ino = r->ino;
+        e->metadata.dev = r->dev;
+        e->ok = TRUE;
+
+        if (!e->filename ||
+            (!e->target && r->target_offset != BACKUP_LOG_INDEX_NONE) ||
+            ((e->num == INSTALLED_SYMLINK || e->num == BACKED_UP_SYMLINK) &&
+             !e->target)) {
+            goto fail;
+        }
+    }
+
+    return b;
+
+ fail:
+
+    free_backup_info(b);
+    return NULL;
+
+} /* read_backup_log_index() */
+
+
+
+/*
+ * find_in_backup_log_index() - look up filename in the backup log
+ * index.  Returns 1 if an entry with the given number is found, 0 if
+ * not, or -1 if there is no valid index.
+ */
+
+static int find_in_backup_log_index(const char *filename, int num)
+{
+    const BackupLogIndexHeader *header;
+    const uint32 *hash;
+    struct stat log_stat;
+    size_t length;
+    uint32 h, mask;
+    int ret = 0;
+
+    if (stat(BACKUP_LOG, &log_stat) == -1) return -1;
+
+    header = map_backup_log_index(&log_stat, &length);
+    if (!header) return -1;
+
+    hash = INDEX_HASH(header);
+    mask = header->hash_size - 1;
+
+    for (h = backup_log_index_hash(filename) & mask; hash[h];
+         h = (h + 1) & mask) {
+        const BackupLogIndexRecord *r;
+        const char *name;
+
+        if (hash[h] > header->num_records) {
+            ret = -1;
+            break;
+        }
+
+        r = &INDEX_RECORDS(header)[hash[h] - 1];
+        name = index_string(header, r->filename_offset);
+
+        if (r->num == num && name && strcmp(name, filename) == 0) {
+            ret = 1;
+            break;
+        }
+    }
+
+    munmap((void *) header, length);
+
+    return ret;
+
+} /* find_in_backup_log_index() */
+
+
 
 /*
  * reverse_strlen_compare() - Compare two strings by length, for sorting
@@ -917,6 +1571,14 @@ static BackupInfo *read_backup_log_file(Options *op)
         goto pre_map_fail;
     }
 
+    /* use the binary index of the log, if it is up to date */
+
+    b = read_backup_log_index(&stat_buf);
+    if (b) {
+        close(fd);
+        return b;
+    }
+
     /* map the file */
 
     length = stat_buf.st_size;
@@ -941,8 +1603,6 @@ static BackupInfo *read_backup_log_file(Options *op)
     b->description = get_next_line(c, &c, buf, length);
     if (!b->description || !c) goto parse_error;
 
-    b->n = 0;
-    b->e = NULL;
     line_num = 3;
 
     while(1) {
@@ -959,15 +1619,7 @@ static BackupInfo *read_backup_log_file(Options *op)
         line_num++;
         free(line);
 
-        /* grow the BackupLogEntry array */
-
-        b->n++;
-        b->e = (BackupLogEntry *)
-            nvrealloc(b->e, sizeof(BackupLogEntry) * b->n);
-
-        memset(&b->e[b->n - 1], 0, sizeof(BackupLogEntry));
-
-        e = &b->e[b->n - 1];
+        e = add_backup_log_entry(b);
         e->num = num;
         e->filename = filename;
         e->ok = TRUE;
@@ -980,6 +1632,7 @@ static BackupInfo *read_backup_log_file(Options *op)
             line_num++;
 
             if (!parse_crc(line, &e->crc)) goto parse_error;
+            parse_file_metadata(line, 1, &e->metadata);
             free(line);
         
             break;
@@ -1019,6 +1672,7 @@ static BackupInfo *read_backup_log_file(Options *op)
 
             if (!parse_crc_mode_uid_gid(line, &e->crc, &e->mode,
                                         &e->uid, &e->gid)) goto parse_error;
+            parse_file_metadata(line, 4, &e->metadata);
             free(line);
 
             break;
@@ -1062,13 +1716,17 @@ static void free_backup_info(BackupInfo *b)
     int i;
 
     if (!b) return;
-    
-    nvfree(b->version);
-    nvfree(b->description);
-    
-    for (i = 0; i < b->n; i++) {
-        nvfree(b->e[i].filename);
-        nvfree(b->e[i].target);
+
+    if (b->map) {
+        munmap(b->map, b->map_length);
+    } else {
+        nvfree(b->version);
+        nvfree(b->description);
+
+        for (i = 0; i < b->n; i++) {
+            nvfree(b->e[i].filename);
+            nvfree(b->e[i].target);
+        }
     }
 
     nvfree((char *) b->e);
@@ -1079,6 +1737,230 @@ static void free_backup_info(BackupInfo *b)
 
 
 
+/*
+ * Validating a previous installation is dominated by reading the
+ * installed and backed up files to compute their CRCs.  That work is
+ * sharded across worker threads by probe_backup_log_entries(), which
+ * gathers the file system state of every log entry without reporting
+ * anything; check_backup_log_entries() and
+ * sanity_check_backup_log_entries() then walk the entries in log order,
+ * using the probed state, so that their messages and the cross-checks
+ * between entries stay deterministic.  Whenever a probe failed, the
+ * check redoes the operation itself to report the error.
+ */
+
+typedef struct {
+    int access_errno;   /* errno from access(), or 0 if accessible */
+    int unchanged;      /* metadata matches the log (--fast-validate) */
+    int have_crc;       /* crc is valid */
+    uint32 crc;         /* current CRC of the file (or the backup copy) */
+    char *target;       /* current target, for installed symlinks */
+} BackupLogProbe;
+
+typedef struct {
+    Options *op;
+    BackupInfo *b;
+    BackupLogProbe *probes;
+    int next;
+    int done;
+    pthread_mutex_t lock;
+} BackupLogProber;
+
+
+static char *backup_file_path(int num)
+{
+    return nvasprintf("%s/%d", BACKUP_DIRECTORY, num);
+}
+
+
+/*
+ * read_symlink_target() - readlink(2) into a malloced string, without
+ * reporting errors.
+ */
+
+static char *read_symlink_target(const char *filename)
+{
+    char *buf = NULL;
+    int len = 0, ret;
+
+    do {
+        len += NV_LINE_LEN;
+        nvfree(buf);
+        buf = nvalloc(len);
+        ret = readlink(filename, buf, len - 1);
+        if (ret == -1) {
+            nvfree(buf);
+            return NULL;
+        }
+    } while (ret >= (len - 1));
+
+    buf[ret] = '\0';
+
+    return buf;
+}
+
+
+/*
+ * probe_file_crc() - compute the CRC of a logged file, unless its
+ * metadata shows that it is unchanged and --fast-validate is in effect.
+ */
+
+static void probe_file_crc(Options *op, const char *filename,
+                           const FileMetadata *metadata, BackupLogProbe *p)
+{
+    struct stat stat_buf;
+
+    if (lstat(filename, &stat_buf) == 0 &&
+        file_metadata_unchanged(op, metadata, &stat_buf)) {
+        p->unchanged = TRUE;
+        return;
+    }
+
+    p->have_crc = try_compute_crc(filename, &p->crc);
+}
+
+
+static void probe_backup_log_entry(Options *op, const BackupLogEntry *e,
+                                   BackupLogProbe *p)
+{
+    char *path;
+
+    switch (e->num) {
+
+    case INSTALLED_FILE:
+        if (access(e->filename, F_OK) == -1) {
+            p->access_errno = errno;
+        } else if (e->crc != 0) {
+            probe_file_crc(op, e->filename, &e->metadata, p);
+        }
+        break;
+
+    case INSTALLED_SYMLINK:
+        if (access(e->filename, F_OK) == -1) {
+            p->access_errno = errno;
+        } else {
+            p->target = read_symlink_target(e->filename);
+        }
+        break;
+
+    case BACKED_UP_SYMLINK:
+        break;
+
+    default:
+        path = backup_file_path(e->num);
+        if (access(path, F_OK) == -1) {
+            p->access_errno = errno;
+        } else {
+            probe_file_crc(op, path, &e->metadata, p);
+        }
+        nvfree(path);
+        break;
+    }
+}
+
+
+static void *backup_log_probe_worker(void *arg)
+{
+    BackupLogProber *prober = arg;
+    int i;
+
+    while (1) {
+        pthread_mutex_lock(&prober->lock);
+        if (i = prober->next, i < prober->b->n) prober->next++;
+        pthread_mutex_unlock(&prober->lock);
+
+        if (i >= prober->b->n) break;
+
+        probe_backup_log_entry(prober->op, &prober->b->e[i],
+                               &prober->probes[i]);
+
+        pthread_mutex_lock(&prober->lock);
+        prober->done++;
+        pthread_mutex_unlock(&prober->lock);
+    }
+
+    return NULL;
+}
+
+
+/*
+ * probe_backup_log_entries() - probe all entries of b, using up to
+ * op->concurrency_level threads (including the calling thread, which
+ * also reports progress).  Returns an array of b->n probes, to be
+ * freed with free_backup_log_probes().
+ */
+
+static BackupLogProbe *probe_backup_log_entries(Options *op, BackupInfo *b)
+{
+    BackupLogProber prober;
+    pthread_t *threads;
+    int i, num_threads = 0, max_threads;
+
+    memset(&prober, 0, sizeof(prober));
+    prober.op = op;
+    prober.b = b;
+    prober.probes = nvalloc(sizeof(BackupLogProbe) * (b->n + 1));
+    pthread_mutex_init(&prober.lock, NULL);
+
+    max_threads = op->concurrency_level - 1;
+    if (max_threads > b->n - 1) max_threads = b->n - 1;
+    if (max_threads < 0) max_threads = 0;
+
+    threads = nvalloc(sizeof(pthread_t) * (max_threads + 1));
+    for (i = 0; i < max_threads; i++) {
+        if (pthread_create(&threads[i], NULL, backup_log_probe_worker,
+                           &prober) != 0) {
+            break;
+        }
+        num_threads++;
+    }
+
+    /* the calling thread probes entries as well, and updates the status */
+
+    while (1) {
+        float percent;
+
+        pthread_mutex_lock(&prober.lock);
+        if (i = prober.next, i < b->n) prober.next++;
+        percent = (float) prober.done / (float) (b->n ? b->n : 1);
+        pthread_mutex_unlock(&prober.lock);
+
+        if (i >= b->n) break;
+
+        ui_status_update(op, percent, "%s", b->e[i].filename);
+
+        probe_backup_log_entry(op, &b->e[i], &prober.probes[i]);
+
+        pthread_mutex_lock(&prober.lock);
+        prober.done++;
+        pthread_mutex_unlock(&prober.lock);
+    }
+
+    for (i = 0; i < num_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    nvfree(threads);
+    pthread_mutex_destroy(&prober.lock);
+
+    return prober.probes;
+
+} /* probe_backup_log_entries() */
+
+
+static void free_backup_log_probes(BackupLogProbe *probes, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        nvfree(probes[i].target);
+    }
+
+    nvfree(probes);
+}
+
+
+
 /*
  * check_backup_log_entries() - for each backup log entry, perform
  * some basic sanity checks.  Set the 'ok' field to FALSE if a
@@ -1088,18 +1970,19 @@ static void free_backup_info(BackupInfo *b)
 static int check_backup_log_entries(Options *op, BackupInfo *b)
 {
     BackupLogEntry *e;
+    BackupLogProbe *probes, *p;
     uint32 crc;
     char *tmpstr;
-    int i, j, len, ret = TRUE;
-    float percent;
+    int i, j, ret = TRUE;
 
     ui_status_begin(op, "Validating previous installation:", "Validating");
+
+    probes = probe_backup_log_entries(op, b);
     
     for (i = 0; i < b->n; i++) {
 
-        percent = (float) i / (float) (b->n);
-
         e = &b->e[i];
+        p = &probes[i];
 
         switch (e->num) {
 
@@ -1107,11 +1990,11 @@ static int check_backup_log_entries(Options *op, BackupInfo *b)
 
             /* check if the file still matches its backup log entry */
 
-            e->ok = check_installed_file(op, e->filename, e->mode, e->crc,
-                                         ui_log);
+            e->ok = check_installed_file_with_crc(op, e->filename, e->mode,
+                                                  e->crc, &e->metadata,
+                                                  p->have_crc ?
+                                                  &p->crc : NULL, ui_log);
             ret = ret && e->ok;
- 
-            ui_status_update(op, percent, "%s", e->filename);
 
             break;
 
@@ -1122,12 +2005,14 @@ static int check_backup_log_entries(Options *op, BackupInfo *b)
              * target
              */
             
-            if (access(e->filename, F_OK) == -1) {
+            if (p->access_errno) {
                 ui_log(op, "Unable to access previously installed "
-                       "symlink '%s' (%s).", e->filename, strerror(errno));
+                       "symlink '%s' (%s).", e->filename,
+                       strerror(p->access_errno));
                 ret = e->ok = FALSE;
             } else {
-                tmpstr = get_symlink_target(op, e->filename);
+                tmpstr = p->target ? nvstrdup(p->target) :
+                                     get_symlink_target(op, e->filename);
                 if (!tmpstr) {
                     ret = e->ok = FALSE;
                 } else {
@@ -1158,7 +2043,6 @@ static int check_backup_log_entries(Options *op, BackupInfo *b)
                     free(tmpstr);
                 }
             }
-            ui_status_update(op, percent, "%s", e->filename);
 
             break;
 
@@ -1175,16 +2059,15 @@ static int check_backup_log_entries(Options *op, BackupInfo *b)
              * present and has the same crc
              */
 
-            len = strlen(BACKUP_DIRECTORY) + 64;
-            tmpstr = nvalloc(len + 1);
-            snprintf(tmpstr, len, "%s/%d", BACKUP_DIRECTORY, e->num);
-            if (access(tmpstr, F_OK) == -1) {
+            tmpstr = backup_file_path(e->num);
+            if (p->access_errno) {
                 ui_log(op, "Unable to access backed up file '%s' "
                        "(saved as '%s') (%s).",
-                       e->filename, tmpstr, strerror(errno));
+                       e->filename, tmpstr, strerror(p->access_errno));
                 ret = e->ok = FALSE;
             } else {
-                crc = compute_crc(op, tmpstr);
+                crc = p->unchanged ? e->crc :
+                      p->have_crc ? p->crc : compute_crc(op, tmpstr);
                 
                 if (crc != e->crc) {
                     ui_log(op, "Backed up file '%s' (saved as '%s) has "
@@ -1194,12 +2077,13 @@ static int check_backup_log_entries(Options *op, BackupInfo *b)
                     ret = e->ok = FALSE;
                 }
             }
-            ui_status_update(op, percent, "%s", tmpstr);
             free(tmpstr);
             break;
         }
     }
 
+    free_backup_log_probes(probes, b->n);
+
     ui_status_end(op, "done.");
 
     return (ret);
@@ -1550,8 +2434,8 @@ int test_installed_files(Options *op)
 
 
 /*
- * find_installed_file() - scan the backup log file for the specified
- * filename; return TRUE if the filename is listed as an installed file.
+ * find_installed_file() - look up the specified filename in the backup
+ * log; return TRUE if the filename is listed as an installed file.
  */
 
 int find_installed_file(Options *op, char *filename)
@@ -1559,6 +2443,13 @@ int find_installed_file(Options *op, char *filename)
     BackupInfo *b;
     BackupLogEntry *e;
     int i, ret = FALSE;
+
+    /* use the index of the backup log, if there is a valid one */
+
+    ret = find_in_backup_log_index(filename, INSTALLED_FILE);
+    if (ret >= 0) return ret;
+
+    ret = FALSE;
     
     if ((b = read_backup_log_file(op)) == NULL) return FALSE;
 
@@ -1591,16 +2482,19 @@ int find_installed_file(Options *op, char *filename)
 static int sanity_check_backup_log_entries(Options *op, BackupInfo *b)
 {
     BackupLogEntry *e;
+    BackupLogProbe *probes, *p;
     uint32 crc;
     char *tmpstr;
-    int i, len, ret = TRUE;
-    float percent;
+    int i, ret = TRUE;
     
     ui_status_begin(op, "Validating installation:", "Validating");
 
+    probes = probe_backup_log_entries(op, b);
+
     for (i = 0; i < b->n; i++) {
         
         e = &b->e[i];
+        p = &probes[i];
         
         switch (e->num) {
 
@@ -1608,12 +2502,13 @@ static int sanity_check_backup_log_entries(Options *op, BackupInfo *b)
             
             /* check if the file is still there, and has the same crc */
             
-            if (access(e->filename, F_OK) == -1) {
+            if (p->access_errno) {
                 ui_error(op, "The installed file '%s' no longer exists.",
                          e->filename);
                 ret = FALSE;
             } else {
-                crc = compute_crc(op, e->filename);
+                crc = p->unchanged ? e->crc :
+                      p->have_crc ? p->crc : compute_crc(op, e->filename);
                 
                 if (crc != e->crc) {
                     ui_error(op, "The installed file '%s' has a different "
@@ -1632,12 +2527,13 @@ static int sanity_check_backup_log_entries(Options *op, BackupInfo *b)
              * target
              */
             
-            if (access(e->filename, F_OK) == -1) {
+            if (p->access_errno) {
                 ui_error(op, "The installed symbolic link '%s' no "
                          "longer exists.", e->filename);
                 ret = FALSE;
             } else {
-                tmpstr = get_symlink_target(op, e->filename);
+                tmpstr = p->target ? nvstrdup(p->target) :
+                                     get_symlink_target(op, e->filename);
                 if (!tmpstr) {
                     ret = FALSE;
                 } else {
@@ -1666,15 +2562,14 @@ static int sanity_check_backup_log_entries(Options *op, BackupInfo *b)
              * present and has the same crc
              */
             
-            len = strlen(BACKUP_DIRECTORY) + 64;
-            tmpstr = nvalloc(len + 1);
-            snprintf(tmpstr, len, "%s/%d", BACKUP_DIRECTORY, e->num);
-            if (access(tmpstr, F_OK) == -1) {
+            tmpstr = backup_file_path(e->num);
+            if (p->access_errno) {
                 ui_error(op, "The backed up file '%s' (saved as '%s') "
                          "no longer exists.", e->filename, tmpstr);
                 ret = FALSE;
             } else {
-                crc = compute_crc(op, tmpstr);
+                crc = p->unchanged ? e->crc :
+                      p->have_crc ? p->crc : compute_crc(op, tmpstr);
                 
                 if (crc != e->crc) {
                     ui_error(op, "Backed up file '%s' (saved as '%s) has a "
@@ -1687,11 +2582,10 @@ static int sanity_check_backup_log_entries(Options *op, BackupInfo *b)
             free(tmpstr);
             break;
         }
-        
-        percent = (float) i / (float) (b->n);
-        ui_status_update(op, percent, "%s", e->filename);
     }
 
+    free_backup_log_probes(probes, b->n);
+
     ui_status_end(op, "done.");
     
     return ret;
@@ -21,6 +21,7 @@
 #define __NVIDIA_INSTALLER_BACKUP_H__
 
 #include "nvidia-installer.h"
+#include "misc.h"
 
 #define INSTALLED_SYMLINK  0
 #define INSTALLED_FILE     1
@@ -29,8 +30,11 @@
 
 int init_backup                 (Options*, Package*);
 int do_backup                   (Options*, const char*);
-int log_install_file            (Options*, const char*);
+int log_install_file            (Options*, const char*, const uint32*,
+                                 const FileMetadata*);
 int log_create_symlink          (Options*, const char*, const char*);
+int commit_backup_log           (Options*);
+int close_backup_log            (Options*);
 int check_for_existing_driver   (Options*, Package*);
 int uninstall_existing_driver   (Options*, const int, const int);
 int run_existing_uninstaller    (Options*);
@@ -22,11 +22,12 @@
  * actually do an install).
  */
 
+#define _GNU_SOURCE /* needed for memmem */
+
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <sys/mman.h>
-#include <fts.h>
 #include <unistd.h>
 #include <dirent.h>
 #include <string.h>
@@ -34,6 +35,8 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <errno.h>
+#include <libgen.h>
+#include <pthread.h>
 
 #include "nvidia-installer.h"
 #include "command-list.h"
@@ -44,6 +47,7 @@
 #include "kernel.h"
 #include "manifest.h"
 #include "conflicting-kernel-modules.h"
+#include "crc.h"
 
 
 static void free_file_list(FileList* l);
@@ -75,10 +79,12 @@ typedef struct {
 } NoRecursionDirectory;
 
 static void find_conflicting_files(Options *op,
-                                   char *path,
+                                   char **roots,
+                                   int num_roots,
                                    ConflictingFileInfo *files,
                                    FileList *l,
-                                   const NoRecursionDirectory *skipdirs);
+                                   const NoRecursionDirectory *skipdirs,
+                                   int report_progress);
 
 
 /*
@@ -245,7 +251,7 @@ CommandList *build_command_list(Options *op, Package *p)
     
     if (!op->kernel_module_only) {
         char **paths;
-        int numpaths, i;
+        int numpaths;
         ConflictingFileInfo *conflicting_files;
 
         /*
@@ -271,11 +277,8 @@ CommandList *build_command_list(Options *op, Package *p)
         ui_status_begin(op, "Searching for conflicting files:", "Searching");
 
         conflicting_files = build_conflicting_file_list(op, p);
-        for (i = 0; i < numpaths; i++) {
-            ui_status_update(op, (i + 1.0f) / numpaths, "Searching: %s", paths[i]);
-            find_conflicting_files(op, paths[i], conflicting_files, l,
-                                   skipdirs);
-        }
+        find_conflicting_files(op, paths, numpaths, conflicting_files, l,
+                               skipdirs, TRUE);
         nvfree(conflicting_files);
 
         ui_status_end(op, "done.");
@@ -338,6 +341,9 @@ CommandList *build_command_list(Options *op, Package *p)
                         p->entries[i].dst,
                         tmp,
                         p->entries[i].mode);
+            if (tmp) {
+                c->cmds[c->num - 1].flags = CMD_FLAG_CLEAR_EXECSTACK;
+            }
         }
 
         nvfree(tmp);
@@ -355,7 +361,8 @@ CommandList *build_command_list(Options *op, Package *p)
             (p->entries[i].caps.is_shared_lib)) {
             tmp = nvstrcat(op->utils[CHCON], " -t ", op->selinux_chcon_type,
                            " ", p->entries[i].dst, NULL);
-            add_command(c, RUN_CMD, tmp);
+            add_command(c, RUN_CMD, tmp, p->entries[i].dst);
+            c->cmds[c->num - 1].flags = CMD_FLAG_SET_SECURITY_CONTEXT;
             nvfree(tmp);
         }
     }
@@ -386,7 +393,7 @@ CommandList *build_command_list(Options *op, Package *p)
                             " --remove-section=.note.ABI-tag ",
                             p->entries[i].dst,
                             " 2> /dev/null ; true", NULL);
-                    add_command(c, RUN_CMD, tmp);
+                    add_command(c, RUN_CMD, tmp, p->entries[i].dst);
                     nvfree(tmp);
                 }
             }
@@ -399,7 +406,7 @@ CommandList *build_command_list(Options *op, Package *p)
     
     /* finally, run ldconfig and depmod */
 
-    add_command(c, RUN_CMD, op->utils[LDCONFIG]);
+    add_command(c, RUN_CMD, op->utils[LDCONFIG], NULL);
 
     /*
      * If we are building for a non-running kernel, specify that
@@ -410,7 +417,7 @@ CommandList *build_command_list(Options *op, Package *p)
     
     if (!op->no_kernel_module && !op->skip_depmod) {
         tmp = nvstrcat(op->utils[DEPMOD], " -a ", op->kernel_name, NULL);
-        add_command(c, RUN_CMD, tmp);
+        add_command(c, RUN_CMD, tmp, NULL);
         nvfree(tmp);
     }
     
@@ -469,393 +476,2284 @@ void free_command_list(Options *op, CommandList *cl)
 } /* free_command_list() */
 
 /*
- * execute_run_command() - execute a RUN_CMD from the command list.
+ * report_run_command() - report the failure of a RUN_CMD (or of the
+ * post-install step of an INSTALL_CMD), if it failed, and ask the user
+ * whether to continue.  Returns FALSE if the installation should be
+ * aborted.
  */
 
-static inline int execute_run_command(Options *op, float percent, const char *cmd)
+static int report_run_command(Options *op, const char *cmd, int ret,
+                              const char *data)
 {
-    int ret;
-    char *data;
-
-    ui_expert(op, "Executing: %s", cmd);
-    ui_status_update(op, percent, "Executing: `%s` "
-                     "(this may take a moment...)", cmd);
-    ret = run_command(op, cmd, &data, TRUE, 0, TRUE);
-    if (ret != 0) {
-        ui_error(op, "Failed to execute `%s`: %s", cmd, data);
-        ret = continue_after_error(op, "Failed to execute `%s`", cmd);
-        if (!ret) {
-            nvfree(data);
-            return FALSE;
-        }
+    if (!ret) {
+        ui_error(op, "Failed to execute `%s`: %s", cmd, data ? data : "");
+        return continue_after_error(op, "Failed to execute `%s`", cmd);
     }
-    if (data) free(data);
+
     return TRUE;
-} /* execute_run_command() */
+}
+
 
 /*
- * execute_command_list() - execute the commands in the command list.
- *
- * If any failure occurs, ask the user if they would like to continue.
+ * run_command_in_worker() - run a shell command and collect its output,
+ * like run_command(), but without using the ui, so that it may be called
+ * from an install worker thread.  Returns TRUE if the command succeeded.
+ * If the command could not be started, the reason is returned in data.
  */
 
-int execute_command_list(Options *op, CommandList *c,
-                         const char *title, const char *msg)
+static int run_command_in_worker(const char *cmd, char **data)
 {
-    int i, ret;
-    float percent;
+    char *cmd2 = nvstrcat(cmd, " 2>&1", NULL);
+    char *const argv[] = { "/bin/sh", "-c", cmd2, NULL };
+    int fd, ret = FALSE;
+    pid_t pid;
 
-    ui_status_begin(op, title, "%s", msg);
-
-    for (i = 0; i < c->num; i++) {
+    pid = spawn_command(argv, NULL, FALSE, FALSE, &fd);
 
-        percent = (float) i / (float) c->num;
+    if (pid == -1) {
+        *data = nvstrdup(strerror(errno));
+    } else {
+        ret = (read_command_output(pid, fd, data) == 0);
+    }
 
-        switch (c->cmds[i].cmd) {
-                
-        case INSTALL_CMD:
-            ui_expert(op, "Installing: %s --> %s",
-                      c->cmds[i].s0, c->cmds[i].s1);
-            ui_status_update(op, percent, "Installing: %s", c->cmds[i].s1);
-            
-            ret = install_file(op, c->cmds[i].s0, c->cmds[i].s1,
-                               c->cmds[i].mode);
-            if (!ret) {
-                ret = continue_after_error(op, "Cannot install %s",
-                                           c->cmds[i].s1);
-                if (!ret) return FALSE;
-            } else {
-                /*
-                 * perform post-install step before logging the backup
-                 */
-                if (c->cmds[i].s2 &&
-                    !execute_run_command(op, percent, c->cmds[i].s2)) {
-                    return FALSE;
-                }
+    nvfree(cmd2);
 
-                log_install_file(op, c->cmds[i].s1);
-                append_to_rpm_file_list(op, &c->cmds[i]);
-            }
-            break;
-            
-        case RUN_CMD:
-            if (!execute_run_command(op, percent, c->cmds[i].s0)) {
-                return FALSE;
-            }
-            break;
+    return ret;
+}
 
-        case SYMLINK_CMD:
-            ui_expert(op, "Creating symlink: %s -> %s",
-                      c->cmds[i].s0, c->cmds[i].s1);
-            ui_status_update(op, percent, "Creating symlink: %s",
-                             c->cmds[i].s1);
-
-            ret = install_symlink(op, c->cmds[i].s1, c->cmds[i].s0);
-
-            if (!ret) {
-                ret = continue_after_error(op, "Cannot create symlink %s (%s)",
-                                           c->cmds[i].s0, strerror(errno));
-                if (!ret) return FALSE;
-            } else {
-                log_create_symlink(op, c->cmds[i].s0, c->cmds[i].s1);
-            }
-            break;
 
-        case BACKUP_CMD:
-            ui_expert(op, "Backing up: %s", c->cmds[i].s0);
-            ui_status_update(op, percent, "Backing up: %s", c->cmds[i].s0);
+/*
+ * log_worker_command_output() - pass the output of a command run by
+ * run_command_in_worker() to the ui, as run_command() does for the
+ * commands it runs.
+ */
 
-            ret = do_backup(op, c->cmds[i].s0);
-            if (!ret) {
-                ret = continue_after_error(op, "Cannot backup %s",
-                                           c->cmds[i].s0);
-                if (!ret) return FALSE;
-            }
-            break;
+static void log_worker_command_output(Options *op, const char *cmd,
+                                      const char *data)
+{
+    const char *line, *end;
 
-        case DELETE_CMD:
-            ui_expert(op, "Deleting: %s", c->cmds[i].s0);
-            ret = unlink(c->cmds[i].s0);
-            if (ret == -1) {
-                ret = continue_after_error(op, "Cannot delete %s",
-                                           c->cmds[i].s0);
-                if (!ret) return FALSE;
-            }
-            break;
+    ui_command_output(op, "executing: '%s'...", cmd);
 
-        default:
-            /* XXX should never get here */
-            return FALSE;
-            break;
-        }
+    for (line = data; line && *line; line = end) {
+        end = strchr(line, '\n');
+        end = end ? end + 1 : line + strlen(line);
+        ui_command_output(op, "%.*s", (int) (end - line), line);
     }
-
-    ui_status_end(op, "done.");
-
-    return TRUE;
-    
-} /* execute_command_list() */
+}
 
 
 /*
- ***************************************************************************
- * local static routines
- ***************************************************************************
+ * execute_run_command() - execute a RUN_CMD from the command list.
  */
 
+static inline int execute_run_command(Options *op, float percent, const char *cmd)
+{
+    int ret;
+    char *data;
 
+    ui_expert(op, "Executing: %s", cmd);
+    ui_status_update(op, percent, "Executing: `%s` "
+                     "(this may take a moment...)", cmd);
+    ret = run_command(op, cmd, &data, TRUE, 0, TRUE);
+    ret = report_run_command(op, cmd, ret == 0, data);
+    nvfree(data);
+    return ret;
+} /* execute_run_command() */
 
 /*
- * find_conflicting_kernel_modules() - search for conflicting kernel
- * modules under the kernel module installation prefix.
+ * The commands in a CommandList are executed by a small install engine:
+ * maximal runs of INSTALL, SYMLINK and DELETE commands, and of RUN
+ * commands which only modify the file named in their s1 (e.g. chcon or
+ * objcopy on an installed library), are handed to a pool of worker
+ * threads, while BACKUP and other RUN commands are barriers executed on
+ * the main thread.  Within a run, a command that touches a path touched
+ * by an earlier command (e.g. deleting the temporary source of an
+ * install, a symlink pointing at a freshly installed file, or chcon on
+ * it) waits for that command to complete.
+ *
+ * RUN commands and the post-install steps of INSTALL commands are run
+ * by the workers as child processes, so at most one child per worker,
+ * and op->concurrency_level children in all, run at a time.
+ *
+ * The workers only perform the file operations; the main thread creates
+ * any needed directories before dispatching, and "retires" the commands
+ * strictly in command list order: all status updates, error prompts,
+ * and writes to the backup log and rpm file list therefore happen in the
+ * same order as if the commands had been executed serially.  If the
+ * installation is aborted after a failure, commands later in the run may
+ * already have been performed; they are still recorded in the backup log
+ * and rpm file list.
  */
 
-static void find_conflicting_kernel_modules(Options *op, FileList *l)
-{
-    int i = 0;
-    ConflictingFileInfo *files;
-    char *paths[3];
-    char *tmp = get_kernel_name(op);
-    char **filenames;
+enum {
+    CMD_STATE_PENDING = 0,
+    CMD_STATE_QUEUED,
+    CMD_STATE_DONE,
+};
 
-    /* Don't descend into the "build" or "source" directories; these won't
-     * contain modules, and may be symlinks back to an actual source tree. */
-    static const NoRecursionDirectory skipdirs[] = {
-        { 1, "build" },
-        { 1, "source" },
-        { 0, NULL }
-    };
+typedef struct {
+    int state;
+    int ret;
+    int err;
+    uint32 crc;        /* CRC of the installed data, for INSTALL_CMD */
+    CopyStrategy copy_strategy;
+    int run_ret;       /* result of RUN_CMD or of the post-install step */
+    char *output;      /* output of RUN_CMD or of the post-install step */
+    char *error;       /* why INSTALL_CMD failed, reported when retired */
+    int in_process;    /* RUN_CMD or the post-install step was performed
+                          in-process (see CMD_FLAG_*) */
+    FileMetadata metadata; /* of the installed file, with crc, once the
+                              last command of the run modifying it has
+                              been performed */
+    int snapshot_by;   /* INSTALL_CMD: index + 1 of that command, or 0 */
+    int snapshot_of;   /* index + 1 of the INSTALL_CMD whose file this
+                          command is the last to modify, or 0 */
+    int num_deps;      /* number of unfinished prerequisites */
+    int num_dependents;
+    int *dependents;   /* commands waiting for this one */
+} CommandState;
 
-    if (op->kernel_module_installation_path) {
-        paths[i++] = op->kernel_module_installation_path;
-    }
+typedef struct {
+    Options *op;
+    CommandList *c;
+    CommandState *state;
 
-    if (tmp) {
-        paths[i++] = nvstrcat("/lib/modules/", tmp, NULL);
-    }
+    int *queue;
+    int queue_head, queue_tail;
 
-    paths[i] = NULL;
+    int abort;
+    int shutdown;
 
-    /* Build the list of conflicting kernel modules */
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+} InstallEngine;
 
-    files = nvalloc((num_conflicting_kernel_modules + 1) * sizeof(files[0]));
-    filenames = nvalloc(num_conflicting_kernel_modules * sizeof(filenames[0]));
+typedef struct {
+    const char *path;
+    int last;
+} PathSlot;
 
-    for (i = 0; i < num_conflicting_kernel_modules; i++) {
-        filenames[i] = nvstrcat(conflicting_kernel_modules[i], ".ko", NULL);
-        files[i].name = filenames[i];
-        files[i].len = strlen(filenames[i]);
-    }
 
-    for (i = 0; paths[i]; i++) {
-        /*
-         * Recursively search for the conflicting kernel modules
-         * relative to the current prefix.
-         */
+/*
+ * is_serial_command() - return TRUE if the command must be executed on
+ * the main thread, after all earlier commands have been retired.
+ */
 
-        find_conflicting_files(op, paths[i], files, l, skipdirs);
+static int is_serial_command(const Command *cmd)
+{
+    switch (cmd->cmd) {
+    case INSTALL_CMD:
+    case SYMLINK_CMD:
+    case DELETE_CMD:
+        return FALSE;
+    case RUN_CMD:
+        return cmd->s1 == NULL;
+    default:
+        return TRUE;
     }
+}
 
-    /* free any paths we nvstrcat()'d above  */
 
-    for (i = 1; paths[i]; i++) {
-        nvfree(paths[i]);
+static unsigned int hash_path(const char *path)
+{
+    unsigned int h = 2166136261u;
+
+    while (*path) {
+        h = (h ^ (unsigned char) *path++) * 16777619u;
     }
 
-    /* free the kernel module names */
+    return h;
+}
 
-    for (i = 0; i < num_conflicting_kernel_modules; i++) {
-        nvfree(filenames[i]);
+
+static PathSlot *find_path_slot(PathSlot *slots, unsigned int mask,
+                                const char *path)
+{
+    unsigned int h = hash_path(path) & mask;
+
+    while (slots[h].path && strcmp(slots[h].path, path) != 0) {
+        h = (h + 1) & mask;
     }
-    nvfree(filenames);
-    nvfree(files);
-}
 
+    return &slots[h];
+}
 
 
 /*
- * find_existing_files() - given a Package description, search for any
- * of the package files which already exist, and add them to the
- * FileList.
+ * add_dependency() - record that command 'idx' touches 'path': make it
+ * depend on the previous command within the run that touched the same
+ * path, if any.
  */
 
-static void find_existing_files(Package *p, FileList *l,
-                                PackageEntryFileTypeList *file_type_list)
+static void add_dependency(CommandState *state, PathSlot *slots,
+                           unsigned int mask, const char *path, int idx)
 {
-    int i;
-    struct stat stat_buf;
+    PathSlot *slot = find_path_slot(slots, mask, path);
+    int prev, i;
 
-    for (i = 0; i < p->num_entries; i++) {
-        if (file_type_list->types[p->entries[i].type]) {
-            if (lstat(p->entries[i].dst, &stat_buf) == 0) {
-                add_file_to_list(NULL, p->entries[i].dst, l);
-            }
-        }
+    prev = slot->path ? slot->last : -1;
+    slot->path = path;
+    slot->last = idx;
+
+    if (prev < 0 || prev == idx) return;
+
+    /* avoid counting the same prerequisite twice */
+
+    for (i = 0; i < state[prev].num_dependents; i++) {
+        if (state[prev].dependents[i] == idx) return;
     }
-} /* find_existing_files() */
 
+    state[prev].dependents = nvrealloc(state[prev].dependents,
+                                       sizeof(int) *
+                                       (state[prev].num_dependents + 1));
+    state[prev].dependents[state[prev].num_dependents++] = idx;
+    state[idx].num_deps++;
+}
 
 
 /*
- * ignore_conflicting_file() - ignore (i.e., do not put it on the list
- * of files to backup) the conflicting file 'filename' if requiredString
- * is non-NULL and we cannot find the string in 'filename', or if the
- * file only conflicts on specific architectures, and the file's
- * architecture does not match.
+ * symlink_target_path() - return the path a symlink command points at,
+ * relative targets being interpreted relative to the link's directory.
  */
 
-static int ignore_conflicting_file(Options *op,
-                                   const char *filename,
-                                   const ConflictingFileInfo info)
+static char *symlink_target_path(const Command *cmd)
 {
-    int fd = -1;
-    struct stat stat_buf;
-    char *file = MAP_FAILED;
-    int ret = FALSE;
-    int i, len, size = 0;
+    char *dirc, *path;
 
-    /* if no requiredString, do not check for the required string */
+    if (cmd->s1[0] == '/') return nvstrdup(cmd->s1);
 
-    if (!info.requiredString) return ret;
+    dirc = nvstrdup(cmd->s0);
+    path = nvstrcat(dirname(dirc), "/", cmd->s1, NULL);
+    nvfree(dirc);
 
-    ret = FALSE;
+    return path;
+}
 
-    if ((fd = open(filename, O_RDONLY)) == -1) {
-        ui_error(op, "Unable to open '%s' for reading (%s)",
-                 filename, strerror(errno));
-        goto cleanup;
-    }
 
-    if (fstat(fd, &stat_buf) == -1) {
-        ui_error(op, "Unable to determine size of '%s' (%s)",
-                 filename, strerror(errno));
-        goto cleanup;
-    }
+/*
+ * build_dependencies() - build the dependency graph for the run of
+ * commands [first, last), and note in snapshot_by and snapshot_of the
+ * last command of the run that modifies the file installed by each
+ * INSTALL_CMD (the INSTALL_CMD itself, or e.g. an objcopy RUN_CMD): the
+ * file is recorded in the backup log as left by that command.  Returns
+ * the array of strings allocated for resolved symlink targets, which
+ * must stay alive while the hash table is in use; the caller frees it.
+ */
 
-    size = stat_buf.st_size;
+static char **build_dependencies(CommandList *c, CommandState *state,
+                                 int first, int last)
+{
+    unsigned int size = 16, mask;
+    PathSlot *slots;
+    char **targets;
+    int i;
 
-    if (!size) {
-        goto cleanup;
-    }
+    while (size < (unsigned int) (last - first) * 4) size <<= 1;
+    mask = size - 1;
 
-    if ((file = mmap(0, size, PROT_READ,
-                     MAP_FILE | MAP_SHARED, fd, 0)) == MAP_FAILED) {
-        ui_error(op, "Unable to map file '%s' for reading (%s)",
-                 filename, strerror(errno));
-        goto cleanup;
+    slots = nvalloc(sizeof(PathSlot) * size);
+    targets = nvalloc(sizeof(char *) * (last - first));
+
+    for (i = first; i < last; i++) {
+        Command *cmd = &c->cmds[i];
+
+        switch (cmd->cmd) {
+        case INSTALL_CMD:
+            add_dependency(state, slots, mask, cmd->s0, i);
+            add_dependency(state, slots, mask, cmd->s1, i);
+            break;
+        case SYMLINK_CMD:
+            targets[i - first] = symlink_target_path(cmd);
+            add_dependency(state, slots, mask, cmd->s0, i);
+            add_dependency(state, slots, mask, targets[i - first], i);
+            break;
+        case DELETE_CMD:
+            add_dependency(state, slots, mask, cmd->s0, i);
+            break;
+        case RUN_CMD:
+            add_dependency(state, slots, mask, cmd->s1, i);
+            break;
+        }
     }
 
     /*
-     * if the requiredString is not found within the mapping of file,
-     * ignore the conflicting file; when scanning for the string,
-     * ensure that the string is either at the end of the file, or
-     * followed by '\0'.
+     * find the last command modifying each installed file; if a file is
+     * installed twice, the first install is recorded as it was before
+     * being overwritten
      */
 
-    ret = TRUE;
+    memset(slots, 0, sizeof(PathSlot) * size);
 
-    len = strlen(info.requiredString);
+    for (i = first; i < last; i++) {
+        Command *cmd = &c->cmds[i];
+        PathSlot *slot;
+        int install = i;
 
-    for (i = 0; (i + len) <= size; i++) {
-        if ((strncmp(&file[i], info.requiredString, len) == 0) &&
-            (((i + len) == size) || (file[i+len] == '\0'))) {
-            ret = FALSE;
-            break;
+        if (cmd->cmd != INSTALL_CMD && cmd->cmd != RUN_CMD) continue;
+
+        slot = find_path_slot(slots, mask, cmd->s1);
+
+        if (cmd->cmd == RUN_CMD) {
+            if (!slot->path) continue;
+            install = state[slot->last].snapshot_of - 1;
+            state[slot->last].snapshot_of = 0;
         }
+
+        state[install].snapshot_by = i + 1;
+        state[i].snapshot_of = install + 1;
+        slot->path = cmd->s1;
+        slot->last = i;
     }
 
-    /* fall through to cleanup */
+    nvfree(slots);
 
- cleanup:
+    return targets;
+}
 
-    if (file != MAP_FAILED) {
-        munmap(file, size);
-    }
 
-    if (fd != -1) {
-        close(fd);
+/*
+ * snapshot_installed_file() - record the CRC and metadata of the file
+ * installed by the INSTALL_CMD idx, once the last command of the run that
+ * modifies it has been performed, for the backup log.  The CRC computed
+ * while copying is kept if nothing modified the file since.
+ */
+
+static void snapshot_installed_file(InstallEngine *e, int idx, int modified)
+{
+    Command *cmd = &e->c->cmds[idx];
+    CommandState *st = &e->state[idx];
+    struct stat stat_buf;
+    uint32 crc = st->crc;
+
+    if (!st->ret) return;
+
+    if ((!modified || try_compute_crc(cmd->s1, &crc)) &&
+        lstat(cmd->s1, &stat_buf) == 0) {
+        st->crc = crc;
+        get_file_metadata(&stat_buf, &st->metadata);
     }
+}
 
-    return ret;
 
-} /* ignore_conflicting_file() */
+/*
+ * run_parallel_command() - perform the file operation for a command;
+ * called without the engine lock held, possibly from a worker thread.
+ * The destination directory has already been created.
+ */
+
+static void run_parallel_command(InstallEngine *e, int idx)
+{
+    Command *cmd = &e->c->cmds[idx];
+    CommandState *st = &e->state[idx];
+
+    errno = 0;
+
+    switch (cmd->cmd) {
+    case INSTALL_CMD:
+        st->ret = copy_file_with_crc(e->op, cmd->s0, cmd->s1, cmd->mode,
+                                     &st->crc, &st->copy_strategy,
+                                     &st->error);
+        if (st->ret && cmd->s2) {
+            st->in_process = (cmd->flags & CMD_FLAG_CLEAR_EXECSTACK) &&
+                             clear_executable_stack(cmd->s1);
+            st->run_ret = st->in_process ||
+                          run_command_in_worker(cmd->s2, &st->output);
+        }
+        break;
+    case RUN_CMD:
+        st->in_process = (cmd->flags & CMD_FLAG_SET_SECURITY_CONTEXT) &&
+                         set_file_selinux_type(cmd->s1,
+                                               e->op->selinux_chcon_type);
+        st->ret = st->in_process ||
+                  run_command_in_worker(cmd->s0, &st->output);
+        break;
+    case SYMLINK_CMD:
+        st->ret = (symlink(cmd->s1, cmd->s0) == 0);
+        break;
+    case DELETE_CMD:
+        st->ret = (unlink(cmd->s0) == 0);
+        break;
+    default:
+        st->ret = FALSE;
+        break;
+    }
+
+    st->err = errno;
 
+    if (st->snapshot_of) {
+        int install = st->snapshot_of - 1;
 
+        snapshot_installed_file(e, install, install != idx || cmd->s2);
+    }
+}
 
 
 /*
- * find_conflicting_files() - search for any conflicting
- * files in all the specified paths within the hierarchy under
- * the given prefix.
+ * complete_command() - mark a command as done, and queue any commands
+ * that were only waiting for it; called with the engine lock held.
  */
 
-static void find_conflicting_files(Options *op,
-                                   char *path,
-                                   ConflictingFileInfo *files,
-                                   FileList *l,
-                                   const NoRecursionDirectory *skipdirs)
+static void complete_command(InstallEngine *e, int idx)
 {
+    CommandState *st = &e->state[idx];
     int i;
-    char *paths[2];
-    FTS *fts;
-    FTSENT *ent;
-
-    paths[0] = path; /* search root */
-    paths[1] = NULL;
-
-    fts = fts_open(paths, FTS_LOGICAL | FTS_NOSTAT, NULL);
-    if (!fts) return;
-
-    while ((ent = fts_read(fts)) != NULL) {
-        switch (ent->fts_info) {
-        case FTS_F:
-        case FTS_SLNONE:
-            for (i = 0; files[i].name; i++) {
-                /* end compare at len e.g. so "libGL." matches "libGL.so.1" */
-                if (!strncmp(ent->fts_name, files[i].name, files[i].len) &&
-                    !ignore_conflicting_file(op, ent->fts_path,
-                                             files[i])) {
-                    add_file_to_list(NULL, ent->fts_path, l);
-                }
-            }
-            break;
 
-        case FTS_DP:
-        case FTS_D:
-            if (op->no_recursion) {
-                fts_set(fts, ent, FTS_SKIP);
-            } else if (skipdirs) {
-                const NoRecursionDirectory *dir;
-                for (dir = skipdirs; dir->name; dir++) {
-                    if ((dir->level < 0 || dir->level >= ent->fts_level) &&
-                        strcmp(ent->fts_name, dir->name) == 0) {
-                        fts_set(fts, ent, FTS_SKIP);
-                    }
-                }
-            }
-            break;
+    st->state = CMD_STATE_DONE;
 
-        default:
-            /*
-             * we only care about regular files, symbolic links
-             * and directories; traversing the hierarchy logically
-             * to simplify handling of paths with symbolic links
-             * to directories, we only need to handle broken links
-             * and, if recursion was not disabled, directories.
-             */
-            break;
+    for (i = 0; i < st->num_dependents; i++) {
+        CommandState *dep = &e->state[st->dependents[i]];
+
+        if (--dep->num_deps == 0 && dep->state == CMD_STATE_PENDING) {
+            dep->state = CMD_STATE_QUEUED;
+            e->queue[e->queue_tail++] = st->dependents[i];
+            pthread_cond_signal(&e->work_cond);
         }
     }
 
-    fts_close(fts);
+    pthread_cond_broadcast(&e->done_cond);
+}
 
-} /* find_conflicting_files() */
 
-void get_conflicting_file_info(const char *file, ConflictingFileInfo *cfi)
+/*
+ * process_queued_command() - pop a command from the queue and execute
+ * it; called with the engine lock held, which is dropped while the
+ * command executes.  Commands are not executed once the install has
+ * been aborted.
+ */
+
+static void process_queued_command(InstallEngine *e)
 {
-    char *c;
+    int idx = e->queue[e->queue_head++];
 
-    cfi->name = file;
+    if (e->abort) {
+        e->state[idx].ret = FALSE;
+    } else {
+        pthread_mutex_unlock(&e->lock);
+        run_parallel_command(e, idx);
+        pthread_mutex_lock(&e->lock);
+    }
+
+    complete_command(e, idx);
+}
+
+
+static void *install_worker(void *arg)
+{
+    InstallEngine *e = arg;
+
+    pthread_mutex_lock(&e->lock);
+
+    while (1) {
+        if (e->queue_head != e->queue_tail) {
+            process_queued_command(e);
+        } else if (e->shutdown) {
+            break;
+        } else {
+            pthread_cond_wait(&e->work_cond, &e->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&e->lock);
+
+    return NULL;
+}
+
+
+/*
+ * wait_for_command() - wait until the given command is done; the main
+ * thread executes queued commands itself while waiting, so that
+ * progress is made even if no worker threads could be created.
+ */
+
+static void wait_for_command(InstallEngine *e, int idx)
+{
+    pthread_mutex_lock(&e->lock);
+
+    while (e->state[idx].state != CMD_STATE_DONE) {
+        if (e->queue_head != e->queue_tail) {
+            process_queued_command(e);
+        } else {
+            pthread_cond_wait(&e->done_cond, &e->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&e->lock);
+}
+
+
+/*
+ * dispatch_parallel_commands() - prepare and queue the run of commands
+ * [first, last): create the destination directories (in command order,
+ * so that the directory log is deterministic), build the dependency
+ * graph, and queue every command without prerequisites.
+ */
+
+static void dispatch_parallel_commands(InstallEngine *e, int first, int last)
+{
+    char **targets;
+    int i;
+
+    for (i = first; i < last; i++) {
+        Command *cmd = &e->c->cmds[i];
+        const char *dst = NULL;
+
+        if (cmd->cmd == INSTALL_CMD) dst = cmd->s1;
+        if (cmd->cmd == SYMLINK_CMD) dst = cmd->s0;
+
+        if (dst) {
+            char *dirc = nvstrdup(dst);
+
+            if (!mkdir_with_log(e->op, dirname(dirc), 0755)) {
+                e->state[i].state = CMD_STATE_DONE;
+                e->state[i].ret = FALSE;
+                e->state[i].err = errno;
+            }
+            nvfree(dirc);
+        }
+    }
+
+    targets = build_dependencies(e->c, e->state, first, last);
+
+    pthread_mutex_lock(&e->lock);
+
+    for (i = first; i < last; i++) {
+        if (e->state[i].state == CMD_STATE_DONE) {
+            complete_command(e, i);
+        }
+    }
+
+    for (i = first; i < last; i++) {
+        if (e->state[i].state == CMD_STATE_PENDING &&
+            e->state[i].num_deps == 0) {
+            e->state[i].state = CMD_STATE_QUEUED;
+            e->queue[e->queue_tail++] = i;
+        }
+    }
+
+    pthread_cond_broadcast(&e->work_cond);
+    pthread_mutex_unlock(&e->lock);
+
+    for (i = 0; i < last - first; i++) {
+        nvfree(targets[i]);
+    }
+    nvfree(targets);
+}
+
+
+/*
+ * record_parallel_command() - record a command performed by the engine in
+ * the backup log and the rpm file list, so that it is undone when the
+ * driver is uninstalled.
+ */
+
+static void record_parallel_command(Options *op, Command *cmd,
+                                    CommandState *st)
+{
+    switch (cmd->cmd) {
+    case INSTALL_CMD:
+        if (st->metadata.valid) {
+            log_install_file(op, cmd->s1, &st->crc, &st->metadata);
+        } else {
+            log_install_file(op, cmd->s1, cmd->s2 ? NULL : &st->crc, NULL);
+        }
+        append_to_rpm_file_list(op, cmd);
+        break;
+    case SYMLINK_CMD:
+        log_create_symlink(op, cmd->s0, cmd->s1);
+        break;
+    }
+}
+
+
+/*
+ * retire_parallel_command() - report the result of a command executed
+ * by the engine; returns FALSE if the installation should be aborted.
+ */
+
+static int retire_parallel_command(Options *op, Command *cmd,
+                                   CommandState *st, float percent)
+{
+    switch (cmd->cmd) {
+
+    case INSTALL_CMD:
+        ui_expert(op, "Installing: %s --> %s (%s)", cmd->s0, cmd->s1,
+                  copy_strategy_name(st->copy_strategy));
+        ui_status_update(op, percent, "Installing: %s", cmd->s1);
+
+        if (!st->ret) {
+            if (st->error) {
+                ui_error(op, "%s", st->error);
+            }
+            return continue_after_error(op, "Cannot install %s", cmd->s1);
+        }
+
+        if (cmd->s2) {
+            ui_expert(op, "Executing: %s%s", cmd->s2,
+                      st->in_process ? " (in-process)" : "");
+            if (!st->in_process) {
+                log_worker_command_output(op, cmd->s2, st->output);
+            }
+            if (!report_run_command(op, cmd->s2, st->run_ret, st->output)) {
+                return FALSE;
+            }
+        }
+
+        record_parallel_command(op, cmd, st);
+        break;
+
+    case SYMLINK_CMD:
+        ui_expert(op, "Creating symlink: %s -> %s", cmd->s0, cmd->s1);
+        ui_status_update(op, percent, "Creating symlink: %s", cmd->s1);
+
+        if (!st->ret) {
+            return continue_after_error(op, "Cannot create symlink %s (%s)",
+                                        cmd->s0, strerror(st->err));
+        }
+
+        record_parallel_command(op, cmd, st);
+        break;
+
+    case DELETE_CMD:
+        ui_expert(op, "Deleting: %s", cmd->s0);
+
+        if (!st->ret) {
+            return continue_after_error(op, "Cannot delete %s", cmd->s0);
+        }
+        break;
+
+    case RUN_CMD:
+        ui_expert(op, "Executing: %s%s", cmd->s0,
+                  st->in_process ? " (in-process)" : "");
+        ui_status_update(op, percent, "Executing: `%s`", cmd->s0);
+
+        if (!st->in_process) {
+            log_worker_command_output(op, cmd->s0, st->output);
+        }
+
+        return report_run_command(op, cmd->s0, st->ret, st->output);
+    }
+
+    return TRUE;
+}
+
+
+/*
+ * execute_serial_command() - execute a command on the main thread.
+ */
+
+static int execute_serial_command(Options *op, Command *cmd, float percent)
+{
+    int ret;
+
+    switch (cmd->cmd) {
+
+    case RUN_CMD:
+        return execute_run_command(op, percent, cmd->s0);
+
+    case BACKUP_CMD:
+        ui_expert(op, "Backing up: %s", cmd->s0);
+        ui_status_update(op, percent, "Backing up: %s", cmd->s0);
+
+        ret = do_backup(op, cmd->s0);
+        if (!ret) {
+            return continue_after_error(op, "Cannot backup %s", cmd->s0);
+        }
+        break;
+
+    default:
+        /* XXX should never get here */
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+
+/*
+ * execute_command_list() - execute the commands in the command list.
+ *
+ * If any failure occurs, ask the user if they would like to continue.
+ */
+
+int execute_command_list(Options *op, CommandList *c,
+                         const char *title, const char *msg)
+{
+    InstallEngine e;
+    pthread_t *threads;
+    int i, j, k, num_threads = 0, max_threads, ret = TRUE;
+
+    ui_status_begin(op, title, "%s", msg);
+
+    memset(&e, 0, sizeof(e));
+    e.op = op;
+    e.c = c;
+    e.state = nvalloc(sizeof(CommandState) * (c->num + 1));
+    e.queue = nvalloc(sizeof(int) * (c->num + 1));
+    pthread_mutex_init(&e.lock, NULL);
+    pthread_cond_init(&e.work_cond, NULL);
+    pthread_cond_init(&e.done_cond, NULL);
+
+    max_threads = 0;
+    for (i = 0; i < c->num; i++) {
+        if (!is_serial_command(&c->cmds[i])) max_threads++;
+    }
+    if (max_threads > op->concurrency_level) {
+        max_threads = op->concurrency_level;
+    }
+
+    threads = nvalloc(sizeof(pthread_t) * (max_threads + 1));
+    for (i = 0; i < max_threads; i++) {
+        int err = pthread_create(&threads[i], NULL, install_worker, &e);
+        if (err != 0) {
+            ui_expert(op, "Unable to create install worker thread (%s); "
+                      "continuing with %d worker threads.", strerror(err),
+                      num_threads);
+            break;
+        }
+        num_threads++;
+    }
+
+    i = 0;
+    while (i < c->num) {
+
+        if (is_serial_command(&c->cmds[i])) {
+            if (!execute_serial_command(op, &c->cmds[i],
+                                        (float) i / (float) c->num)) {
+                ret = FALSE;
+                break;
+            }
+
+            /*
+             * commit the backup log once all backups have been made, so
+             * that the backed up files can be restored even if the
+             * installation is interrupted
+             */
+            if (c->cmds[i].cmd == BACKUP_CMD &&
+                (i + 1 == c->num || c->cmds[i + 1].cmd != BACKUP_CMD) &&
+                !commit_backup_log(op)) {
+                ret = FALSE;
+                break;
+            }
+
+            i++;
+            continue;
+        }
+
+        for (j = i; j < c->num && !is_serial_command(&c->cmds[j]); j++);
+
+        dispatch_parallel_commands(&e, i, j);
+
+        for (; i < j; i++) {
+            wait_for_command(&e, i);
+
+            /* the installed file is recorded as left by the whole run */
+
+            if (e.state[i].snapshot_by) {
+                wait_for_command(&e, e.state[i].snapshot_by - 1);
+            }
+
+            if (!retire_parallel_command(op, &c->cmds[i], &e.state[i],
+                                         (float) i / (float) c->num)) {
+                ret = FALSE;
+                break;
+            }
+        }
+
+        if (!ret) {
+            /*
+             * let the workers drain the run without executing anything
+             * more; the commands after the failed one may already have
+             * been performed, so record those that succeeded (and the
+             * failed one, if it installed its file before its
+             * post-install step failed), as the uninstaller relies on
+             * the backup log to undo them
+             */
+            pthread_mutex_lock(&e.lock);
+            e.abort = TRUE;
+            pthread_mutex_unlock(&e.lock);
+
+            for (k = i; k < j; k++) {
+                wait_for_command(&e, k);
+            }
+
+            for (; i < j; i++) {
+                if (e.state[i].ret) {
+                    record_parallel_command(op, &c->cmds[i], &e.state[i]);
+                }
+            }
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&e.lock);
+    e.shutdown = TRUE;
+    pthread_cond_broadcast(&e.work_cond);
+    pthread_mutex_unlock(&e.lock);
+
+    for (i = 0; i < num_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (i = 0; i < c->num; i++) {
+        nvfree(e.state[i].dependents);
+        nvfree(e.state[i].output);
+        nvfree(e.state[i].error);
+    }
+
+    nvfree(threads);
+    nvfree(e.state);
+    nvfree(e.queue);
+    pthread_mutex_destroy(&e.lock);
+    pthread_cond_destroy(&e.work_cond);
+    pthread_cond_destroy(&e.done_cond);
+
+    if (ret) ui_status_end(op, "done.");
+
+    return ret;
+
+} /* execute_command_list() */
+
+
+/*
+ ***************************************************************************
+ * local static routines
+ ***************************************************************************
+ */
+
+
+
+/*
+ * find_conflicting_kernel_modules() - search for conflicting kernel
+ * modules under the kernel module installation prefix.
+ */
+
+static void find_conflicting_kernel_modules(Options *op, FileList *l)
+{
+    int i = 0;
+    ConflictingFileInfo *files;
+    char *paths[3];
+    char *tmp = get_kernel_name(op);
+    char **filenames;
+
+    /* Don't descend into the "build" or "source" directories; these won't
+     * contain modules, and may be symlinks back to an actual source tree. */
+    static const NoRecursionDirectory skipdirs[] = {
+        { 1, "build" },
+        { 1, "source" },
+        { 0, NULL }
+    };
+
+    if (op->kernel_module_installation_path) {
+        paths[i++] = op->kernel_module_installation_path;
+    }
+
+    if (tmp) {
+        paths[i++] = nvstrcat("/lib/modules/", tmp, NULL);
+    }
+
+    paths[i] = NULL;
+
+    /* Build the list of conflicting kernel modules */
+
+    files = nvalloc((num_conflicting_kernel_modules + 1) * sizeof(files[0]));
+    filenames = nvalloc(num_conflicting_kernel_modules * sizeof(filenames[0]));
+
+    for (i = 0; i < num_conflicting_kernel_modules; i++) {
+        filenames[i] = nvstrcat(conflicting_kernel_modules[i], ".ko", NULL);
+        files[i].name = filenames[i];
+        files[i].len = strlen(filenames[i]);
+    }
+
+    /*
+     * Recursively search for the conflicting kernel modules
+     * relative to the prefixes.
+     */
+
+    for (i = 0; paths[i]; i++);
+
+    find_conflicting_files(op, paths, i, files, l, skipdirs, FALSE);
+
+    /* free any paths we nvstrcat()'d above  */
+
+    for (i = 1; paths[i]; i++) {
+        nvfree(paths[i]);
+    }
+
+    /* free the kernel module names */
+
+    for (i = 0; i < num_conflicting_kernel_modules; i++) {
+        nvfree(filenames[i]);
+    }
+    nvfree(filenames);
+    nvfree(files);
+}
+
+
+
+/*
+ * find_existing_files() - given a Package description, search for any
+ * of the package files which already exist, and add them to the
+ * FileList.
+ */
+
+static void find_existing_files(Package *p, FileList *l,
+                                PackageEntryFileTypeList *file_type_list)
+{
+    int i;
+    struct stat stat_buf;
+
+    for (i = 0; i < p->num_entries; i++) {
+        if (file_type_list->types[p->entries[i].type]) {
+            if (lstat(p->entries[i].dst, &stat_buf) == 0) {
+                add_file_to_list(NULL, p->entries[i].dst, l);
+            }
+        }
+    }
+} /* find_existing_files() */
+
+
+
+/*
+ * Cache of the required string searches done by
+ * ignore_conflicting_file(), keyed by the identity and modification
+ * time of the file, so that a file reached through several paths (or
+ * searched for again later in the same run) is only scanned once.
+ * Shared by the conflicting file scanner threads.
+ */
+
+typedef struct {
+    dev_t device;
+    ino_t inode;
+    struct timespec mtime;
+    const char *requiredString;
+    int found;
+} RequiredStringResult;
+
+static struct {
+    RequiredStringResult *slots;
+    unsigned int size;
+    unsigned int used;
+    pthread_mutex_t lock;
+} required_string_cache = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+
+
+static unsigned int hash_required_string_key(const struct stat *stat_buf)
+{
+    uint64_t key = ((uint64_t) stat_buf->st_dev * 0x9e3779b97f4a7c15ULL) ^
+                   (uint64_t) stat_buf->st_ino;
+
+    key ^= key >> 31;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 29;
+
+    return (unsigned int) key;
+}
+
+
+static RequiredStringResult *find_required_string_slot(const struct stat
+                                                       *stat_buf,
+                                                       const char *str)
+{
+    unsigned int mask = required_string_cache.size - 1, h;
+    RequiredStringResult *r;
+
+    for (h = hash_required_string_key(stat_buf) & mask;
+         required_string_cache.slots[h].requiredString; h = (h + 1) & mask) {
+        r = &required_string_cache.slots[h];
+        if (r->device == stat_buf->st_dev && r->inode == stat_buf->st_ino &&
+            strcmp(r->requiredString, str) == 0) {
+            break;
+        }
+    }
+
+    return &required_string_cache.slots[h];
+}
+
+
+/*
+ * lookup_required_string() - returns TRUE and sets *found if the
+ * result of searching the file described by stat_buf for str is
+ * cached.
+ */
+
+static int lookup_required_string(const struct stat *stat_buf,
+                                  const char *str, int *found)
+{
+    RequiredStringResult *r;
+    int ret = FALSE;
+
+    pthread_mutex_lock(&required_string_cache.lock);
+
+    if (required_string_cache.size) {
+        r = find_required_string_slot(stat_buf, str);
+        if (r->requiredString &&
+            r->mtime.tv_sec == stat_buf->st_mtim.tv_sec &&
+            r->mtime.tv_nsec == stat_buf->st_mtim.tv_nsec) {
+            *found = r->found;
+            ret = TRUE;
+        }
+    }
+
+    pthread_mutex_unlock(&required_string_cache.lock);
+
+    return ret;
+}
+
+
+static void cache_required_string(const struct stat *stat_buf,
+                                  const char *str, int found)
+{
+    RequiredStringResult *r;
+
+    pthread_mutex_lock(&required_string_cache.lock);
+
+    /* grow the table to keep the load factor at or below 1/2 */
+
+    if ((required_string_cache.used + 1) * 2 > required_string_cache.size) {
+        RequiredStringResult *old = required_string_cache.slots;
+        unsigned int old_size = required_string_cache.size, i;
+
+        required_string_cache.size = old_size ? old_size * 2 : 64;
+        required_string_cache.slots =
+            nvalloc(sizeof(RequiredStringResult) * required_string_cache.size);
+
+        for (i = 0; i < old_size; i++) {
+            if (old[i].requiredString) {
+                struct stat key;
+
+                key.st_dev = old[i].device;
+                key.st_ino = old[i].inode;
+                *find_required_string_slot(&key, old[i].requiredString) =
+                    old[i];
+            }
+        }
+
+        nvfree(old);
+    }
+
+    r = find_required_string_slot(stat_buf, str);
+    if (!r->requiredString) required_string_cache.used++;
+
+    r->device = stat_buf->st_dev;
+    r->inode = stat_buf->st_ino;
+    r->mtime = stat_buf->st_mtim;
+    r->requiredString = str;
+    r->found = found;
+
+    pthread_mutex_unlock(&required_string_cache.lock);
+}
+
+
+/*
+ * find_required_string() - returns TRUE if str occurs in the buffer,
+ * either at its end or followed by '\0'.
+ */
+
+static int find_required_string(const char *buf, size_t size, const char *str)
+{
+    size_t len = strlen(str);
+    const char *p = buf, *end = buf + size;
+
+    while ((size_t) (end - p) >= len &&
+           (p = memmem(p, end - p, str, len)) != NULL) {
+        if (p + len == end || p[len] == '\0') {
+            return TRUE;
+        }
+        p++;
+    }
+
+    return FALSE;
+}
+
+
+/*
+ * ignore_conflicting_file() - ignore (i.e., do not put it on the list
+ * of files to backup) the conflicting file 'filename' if requiredString
+ * is non-NULL and we cannot find the string in 'filename', or if the
+ * file only conflicts on specific architectures, and the file's
+ * architecture does not match.  If the file cannot be read, it is not
+ * ignored, and the reason is returned in *error, so that it can be
+ * reported from the main thread; the caller must free it.
+ */
+
+static int ignore_conflicting_file(const char *filename,
+                                   const ConflictingFileInfo info,
+                                   char **error)
+{
+    int fd = -1;
+    struct stat stat_buf;
+    char *file = MAP_FAILED;
+    int ret = FALSE;
+    int found;
+    size_t size = 0;
+
+    /* if no requiredString, do not check for the required string */
+
+    if (!info.requiredString) return ret;
+
+    ret = FALSE;
+
+    if ((fd = open(filename, O_RDONLY)) == -1) {
+        *error = nvasprintf("Unable to open '%s' for reading (%s)",
+                            filename, strerror(errno));
+        goto cleanup;
+    }
+
+    if (fstat(fd, &stat_buf) == -1) {
+        *error = nvasprintf("Unable to determine size of '%s' (%s)",
+                            filename, strerror(errno));
+        goto cleanup;
+    }
+
+    if (lookup_required_string(&stat_buf, info.requiredString, &found)) {
+        ret = !found;
+        goto cleanup;
+    }
+
+    size = stat_buf.st_size;
+
+    if (!size) {
+        goto cleanup;
+    }
+
+    if ((file = mmap(0, size, PROT_READ,
+                     MAP_FILE | MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        *error = nvasprintf("Unable to map file '%s' for reading (%s)",
+                            filename, strerror(errno));
+        goto cleanup;
+    }
+
+    /*
+     * if the requiredString is not found within the mapping of file,
+     * ignore the conflicting file; when scanning for the string,
+     * ensure that the string is either at the end of the file, or
+     * followed by '\0'.
+     */
+
+    found = find_required_string(file, size, info.requiredString);
+    cache_required_string(&stat_buf, info.requiredString, found);
+
+    ret = !found;
+
+    /* fall through to cleanup */
+
+ cleanup:
+
+    if (file != MAP_FAILED) {
+        munmap(file, size);
+    }
+
+    if (fd != -1) {
+        close(fd);
+    }
+
+    return ret;
+
+} /* ignore_conflicting_file() */
+
+
+
+
+/*
+ * Conflicting file scanner: find_conflicting_files() traverses all the
+ * search roots at once.  Each directory is a task, executed on a pool
+ * of op->concurrency_level threads (the calling thread included); each
+ * thread has its own deque of tasks, pops the most recently discovered
+ * directory from it, and steals the oldest ones from the other threads
+ * when its own deque is empty, so that large subtrees get split between
+ * threads.
+ *
+ * The traversal mirrors fts_open(FTS_LOGICAL): symbolic links are
+ * followed, broken links are treated as files, and directories which
+ * are their own ancestors are not descended into.  Each directory task
+ * records, in readdir(3) order, its conflicting files and its
+ * subdirectories; the results are then merged depth-first, so that the
+ * FileList has the same order as with a sequential fts traversal.
+ *
+ * With --conflict-search-cache, the listing of every directory that is
+ * searched is saved to CONFLICT_SEARCH_CACHE, keyed by the directory's
+ * path, device, inode and modification time.  A later search reuses the
+ * listing of any directory that has not changed instead of reading it;
+ * only its subdirectories are stat(2)ed, to check whether they changed.
+ * The cache does not notice a symbolic link whose target changes type
+ * (e.g., becomes a directory) without its own directory changing.
+ */
+
+#define CONFLICT_SEARCH_CACHE \
+    (NVIDIA_INSTALLER_CACHE_DIRECTORY "/conflict-search")
+#define CONFLICT_SEARCH_CACHE_MAGIC   "NVCSIDX"
+#define CONFLICT_SEARCH_CACHE_VERSION 1
+
+/*
+ * a directory listing is a sequence of entries, each a type character
+ * followed by the NUL-terminated entry name; only files (including
+ * broken symbolic links) and directories are listed
+ */
+
+#define SCAN_ENTRY_FILE 'f'
+#define SCAN_ENTRY_DIR  'd'
+
+/*
+ * directories modified less than this many seconds before the search
+ * started are not cached, as they may change again within the same
+ * timestamp granularity
+ */
+
+#define CONFLICT_SEARCH_CACHE_SETTLE_TIME 2
+
+/*
+ * cache file layout: a ConflictSearchCacheHeader, then for each
+ * directory a ConflictSearchCacheRecord, followed by the NUL-terminated
+ * path (path_length bytes) and the listing (listing_size bytes); all
+ * values are in host byte order
+ */
+
+typedef struct {
+    char   magic[8];
+    uint32 version;
+    uint32 num_dirs;
+} ConflictSearchCacheHeader;
+
+typedef struct {
+    uint64_t device;
+    uint64_t inode;
+    uint64_t mtime_ns;
+    uint32 path_length;
+    uint32 listing_size;
+} ConflictSearchCacheRecord;
+
+typedef struct {
+    ConflictSearchCacheRecord record;
+    const char *path;
+    const char *listing;
+} CachedDirectory;
+
+typedef struct {
+    char *data;         /* contents of the cache file */
+    CachedDirectory *dirs;
+    int num_dirs;
+    int *slots;         /* index + 1 into dirs, or 0 */
+    unsigned int mask;
+    uint64_t start_ns;
+} ConflictSearchCache;
+
+typedef struct __scan_dir ScanDir;
+
+typedef struct {
+    char *path;         /* conflicting file, or NULL for a subdirectory */
+    ScanDir *dir;
+    char *error;        /* error to report before adding path, or NULL */
+} ScanItem;
+
+struct __scan_dir {
+    char *path;
+    int level;
+    int root;
+    dev_t device;
+    ino_t inode;
+    uint64_t mtime_ns;
+    const ScanDir *parent;
+
+    ScanItem *items;
+    int num_items;
+    int max_items;
+
+    /* directory listing, for the conflict search cache */
+    const char *listing;
+    size_t listing_size;
+    char *own_listing;
+    size_t max_listing;
+    int cacheable;
+};
+
+typedef struct {
+    ScanDir **tasks;
+    int head;
+    int tail;
+    int size;
+    pthread_mutex_t lock;
+} ScanDeque;
+
+typedef struct {
+    int *slots;         /* index + 1 into files, or 0 */
+    unsigned int mask;
+    int num_files;
+    int *lengths;       /* distinct compare lengths */
+    int num_lengths;
+} ConflictingNameTable;
+
+typedef struct {
+    Options *op;
+    const ConflictingFileInfo *files;
+    ConflictingNameTable names;
+    const NoRecursionDirectory *skipdirs;
+    const ConflictSearchCache *cache;
+
+    ScanDeque *deques;
+    int num_deques;
+
+    int queued;         /* tasks in the deques */
+    int pending;        /* tasks not yet completed */
+    int idle;
+    int *root_pending;
+    int roots_done;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} ConflictScanner;
+
+typedef struct {
+    ConflictScanner *scanner;
+    int id;
+} ScanWorker;
+
+
+static unsigned int hash_name_prefix(const char *name, int len)
+{
+    unsigned int h = 2166136261u;
+    int i;
+
+    for (i = 0; i < len; i++) {
+        h = (h ^ (unsigned char) name[i]) * 16777619u;
+    }
+
+    return h;
+}
+
+
+/*
+ * init_conflicting_name_table() - hash the conflicting files by the
+ * prefix of their names that is compared against file names.
+ */
+
+static void init_conflicting_name_table(ConflictingNameTable *t,
+                                        const ConflictingFileInfo *files)
+{
+    unsigned int size = 16, h;
+    int i, j, n;
+
+    for (n = 0; files[n].name; n++);
+
+    t->num_files = n;
+
+    while (size < (unsigned int) n * 2) size <<= 1;
+
+    t->slots = nvalloc(sizeof(int) * size);
+    t->mask = size - 1;
+    t->lengths = nvalloc(sizeof(int) * (n + 1));
+    t->num_lengths = 0;
+
+    for (i = 0; i < n; i++) {
+        h = hash_name_prefix(files[i].name, files[i].len) & t->mask;
+        while (t->slots[h]) h = (h + 1) & t->mask;
+        t->slots[h] = i + 1;
+
+        for (j = 0; j < t->num_lengths; j++) {
+            if (t->lengths[j] == files[i].len) break;
+        }
+        if (j == t->num_lengths) {
+            t->lengths[t->num_lengths++] = files[i].len;
+        }
+    }
+}
+
+
+/*
+ * match_conflicting_name() - store in matches the indices, in
+ * ascending order, of the conflicting files whose compare prefix
+ * matches name (e.g. so that "libGL." matches "libGL.so.1"); returns
+ * the number of matches.
+ */
+
+static int match_conflicting_name(const ConflictingNameTable *t,
+                                  const ConflictingFileInfo *files,
+                                  const char *name, int *matches)
+{
+    int name_len = strlen(name);
+    int i, j, n = 0;
+    unsigned int h;
+
+    for (i = 0; i < t->num_lengths; i++) {
+        int len = t->lengths[i];
+
+        if (len > name_len) continue;
+
+        for (h = hash_name_prefix(name, len) & t->mask; t->slots[h];
+             h = (h + 1) & t->mask) {
+            int idx = t->slots[h] - 1;
+
+            if (files[idx].len == len &&
+                strncmp(name, files[idx].name, len) == 0) {
+                for (j = n++; j > 0 && matches[j - 1] > idx; j--) {
+                    matches[j] = matches[j - 1];
+                }
+                matches[j] = idx;
+            }
+        }
+    }
+
+    return n;
+}
+
+
+static void add_scan_item(ScanDir *dir, char *path, ScanDir *subdir,
+                          char *error)
+{
+    if (dir->num_items >= dir->max_items) {
+        dir->max_items = dir->max_items ? dir->max_items * 2 : 8;
+        dir->items = nvrealloc(dir->items, sizeof(ScanItem) * dir->max_items);
+    }
+
+    dir->items[dir->num_items].path = path;
+    dir->items[dir->num_items].dir = subdir;
+    dir->items[dir->num_items].error = error;
+    dir->num_items++;
+}
+
+
+/*
+ * skip_directory() - whether the directory 'name' at depth 'level'
+ * should not be descended into.
+ */
+
+static int skip_directory(const ConflictScanner *s, const char *name,
+                          int level)
+{
+    const NoRecursionDirectory *dir;
+
+    if (s->op->no_recursion) return TRUE;
+
+    if (s->skipdirs) {
+        for (dir = s->skipdirs; dir->name; dir++) {
+            if ((dir->level < 0 || dir->level >= level) &&
+                strcmp(name, dir->name) == 0) {
+                return TRUE;
+            }
+        }
+    }
+
+    return FALSE;
+}
+
+
+static void push_scan_task(ConflictScanner *s, int id, ScanDir *dir)
+{
+    ScanDeque *q = &s->deques[id];
+
+    pthread_mutex_lock(&q->lock);
+    if (q->tail - q->head >= q->size) {
+        ScanDir **tasks = nvalloc(sizeof(ScanDir *) * q->size * 2);
+        int i;
+
+        for (i = q->head; i < q->tail; i++) {
+            tasks[i - q->head] = q->tasks[i % q->size];
+        }
+        nvfree(q->tasks);
+        q->tasks = tasks;
+        q->tail -= q->head;
+        q->head = 0;
+        q->size *= 2;
+    }
+    q->tasks[q->tail++ % q->size] = dir;
+    pthread_mutex_unlock(&q->lock);
+
+    pthread_mutex_lock(&s->lock);
+    s->queued++;
+    s->pending++;
+    s->root_pending[dir->root]++;
+    if (s->idle) pthread_cond_signal(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+}
+
+
+/*
+ * take_scan_task() - take the newest task from the deque of thread
+ * 'id', or else steal the oldest task of another thread.
+ */
+
+static ScanDir *take_scan_task(ConflictScanner *s, int id)
+{
+    ScanDir *dir = NULL;
+    int i;
+
+    for (i = 0; !dir && i < s->num_deques; i++) {
+        ScanDeque *q = &s->deques[(id + i) % s->num_deques];
+
+        pthread_mutex_lock(&q->lock);
+        if (q->head < q->tail) {
+            dir = (i == 0) ? q->tasks[--q->tail % q->size] :
+                             q->tasks[q->head++ % q->size];
+        }
+        pthread_mutex_unlock(&q->lock);
+    }
+
+    return dir;
+}
+
+
+static uint64_t scan_mtime_ns(const struct stat *stat_buf)
+{
+    return (uint64_t) stat_buf->st_mtim.tv_sec * 1000000000ULL +
+           stat_buf->st_mtim.tv_nsec;
+}
+
+
+/*
+ * scan_path() - the path of the entry 'name' in the directory 'dir'.
+ */
+
+static char *scan_path(const ScanDir *dir, const char *name)
+{
+    int path_len = strlen(dir->path);
+    char *path;
+
+    /* as fts(3) does, don't double the '/' after a root ending in '/' */
+
+    if (path_len > 0 && dir->path[path_len - 1] == '/') path_len--;
+
+    path = nvalloc(path_len + strlen(name) + 2);
+    memcpy(path, dir->path, path_len);
+    path[path_len] = '/';
+    strcpy(path + path_len + 1, name);
+
+    return path;
+}
+
+
+static void add_scan_listing_entry(ScanDir *dir, char type, const char *name)
+{
+    size_t len = strlen(name) + 2;
+
+    if (dir->listing_size + len > dir->max_listing) {
+        while (dir->listing_size + len > dir->max_listing) {
+            dir->max_listing = dir->max_listing ? dir->max_listing * 2 : 256;
+        }
+        dir->own_listing = nvrealloc(dir->own_listing, dir->max_listing);
+        dir->listing = dir->own_listing;
+    }
+
+    dir->own_listing[dir->listing_size] = type;
+    memcpy(dir->own_listing + dir->listing_size + 1, name, len - 1);
+    dir->listing_size += len;
+}
+
+
+/*
+ * scan_file() - record the file 'name' in the directory 'dir' once for
+ * each conflicting file it matches.
+ */
+
+static void scan_file(ConflictScanner *s, ScanDir *dir, const char *name,
+                      int *matches)
+{
+    char *path;
+    int i, n;
+
+    n = match_conflicting_name(&s->names, s->files, name, matches);
+    if (n == 0) return;
+
+    path = scan_path(dir, name);
+
+    for (i = 0; i < n; i++) {
+        char *error = NULL;
+
+        if (!ignore_conflicting_file(path, s->files[matches[i]], &error)) {
+            add_scan_item(dir, nvstrdup(path), NULL, error);
+        } else {
+            nvfree(error);
+        }
+    }
+
+    nvfree(path);
+}
+
+
+/*
+ * scan_subdirectory() - queue the subdirectory 'name' of 'dir' to be
+ * searched, unless it is skipped or is a link back to an ancestor.  If
+ * stat_buf is NULL, the subdirectory is stat(2)ed here, once it is
+ * known not to be skipped; returns FALSE if it is not a directory.
+ */
+
+static int scan_subdirectory(ConflictScanner *s, int id, ScanDir *dir,
+                             const char *name, const struct stat *stat_buf)
+{
+    struct stat local_stat_buf;
+    const ScanDir *p;
+    ScanDir *subdir;
+    char *path;
+
+    if (skip_directory(s, name, dir->level + 1)) return TRUE;
+
+    path = scan_path(dir, name);
+
+    if (!stat_buf) {
+        if (stat(path, &local_stat_buf) == -1 ||
+            !S_ISDIR(local_stat_buf.st_mode)) {
+            nvfree(path);
+            return FALSE;
+        }
+        stat_buf = &local_stat_buf;
+    }
+
+    /* don't follow links back to an ancestor */
+
+    for (p = dir; p; p = p->parent) {
+        if (p->device == stat_buf->st_dev && p->inode == stat_buf->st_ino) {
+            nvfree(path);
+            return TRUE;
+        }
+    }
+
+    subdir = nvalloc(sizeof(ScanDir));
+
+    subdir->path = path;
+    subdir->level = dir->level + 1;
+    subdir->root = dir->root;
+    subdir->device = stat_buf->st_dev;
+    subdir->inode = stat_buf->st_ino;
+    subdir->mtime_ns = scan_mtime_ns(stat_buf);
+    subdir->parent = dir;
+
+    add_scan_item(dir, NULL, subdir, NULL);
+    push_scan_task(s, id, subdir);
+
+    return TRUE;
+}
+
+
+static const CachedDirectory *find_cached_directory(const ConflictSearchCache
+                                                    *cache, const char *path)
+{
+    unsigned int h;
+
+    if (!cache->slots) return NULL;
+
+    for (h = hash_name_prefix(path, strlen(path)) & cache->mask;
+         cache->slots[h]; h = (h + 1) & cache->mask) {
+        const CachedDirectory *cached = &cache->dirs[cache->slots[h] - 1];
+
+        if (strcmp(cached->path, path) == 0) return cached;
+    }
+
+    return NULL;
+}
+
+
+/*
+ * scan_cached_directory() - search 'dir' using its cached listing, if
+ * the directory has not changed since it was cached; returns FALSE if
+ * there is no usable cached listing.
+ */
+
+static int scan_cached_directory(ConflictScanner *s, int id, ScanDir *dir,
+                                 int *matches)
+{
+    const CachedDirectory *cached;
+    const char *entry, *end;
+
+    cached = find_cached_directory(s->cache, dir->path);
+
+    if (!cached ||
+        cached->record.device != (uint64_t) dir->device ||
+        cached->record.inode != (uint64_t) dir->inode ||
+        cached->record.mtime_ns != dir->mtime_ns) {
+        return FALSE;
+    }
+
+    dir->listing = cached->listing;
+    dir->listing_size = cached->record.listing_size;
+    dir->cacheable = TRUE;
+
+    end = cached->listing + cached->record.listing_size;
+
+    for (entry = cached->listing; entry < end; entry += strlen(entry) + 1) {
+        if (entry[0] == SCAN_ENTRY_DIR) {
+            if (!scan_subdirectory(s, id, dir, entry + 1, NULL)) {
+                /* the entry changed type: don't trust the listing again */
+                dir->cacheable = FALSE;
+            }
+        } else {
+            scan_file(s, dir, entry + 1, matches);
+        }
+    }
+
+    return TRUE;
+}
+
+
+/*
+ * scan_directory() - read the directory 'dir', recording conflicting
+ * files, and queueing its subdirectories as new tasks.
+ */
+
+static void scan_directory(ConflictScanner *s, int id, ScanDir *dir)
+{
+    int *matches;
+    struct dirent *ent;
+    struct stat stat_buf;
+    DIR *d;
+    int fd;
+
+    matches = nvalloc(sizeof(int) * (s->names.num_files + 1));
+
+    if (s->cache && scan_cached_directory(s, id, dir, matches)) {
+        nvfree(matches);
+        return;
+    }
+
+    d = opendir(dir->path);
+    if (!d) {
+        nvfree(matches);
+        return;
+    }
+
+    fd = dirfd(d);
+
+    while ((ent = readdir(d)) != NULL) {
+        int is_dir = FALSE, is_file = FALSE;
+
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) {
+            continue;
+        }
+
+        switch (ent->d_type) {
+        case DT_REG:
+            is_file = TRUE;
+            break;
+        case DT_DIR:
+        case DT_LNK:
+        case DT_UNKNOWN:
+            if (fstatat(fd, ent->d_name, &stat_buf, 0) == 0) {
+                is_dir = S_ISDIR(stat_buf.st_mode);
+                is_file = S_ISREG(stat_buf.st_mode);
+            } else if (errno == ENOENT &&
+                       fstatat(fd, ent->d_name, &stat_buf,
+                               AT_SYMLINK_NOFOLLOW) == 0) {
+                is_file = TRUE; /* broken symbolic link */
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (is_file) {
+            if (s->cache) {
+                add_scan_listing_entry(dir, SCAN_ENTRY_FILE, ent->d_name);
+            }
+            scan_file(s, dir, ent->d_name, matches);
+        } else if (is_dir) {
+            if (s->cache) {
+                add_scan_listing_entry(dir, SCAN_ENTRY_DIR, ent->d_name);
+            }
+            scan_subdirectory(s, id, dir, ent->d_name, &stat_buf);
+        }
+    }
+
+    closedir(d);
+    nvfree(matches);
+
+    /* don't cache directories that may still be changing */
+
+    dir->cacheable = s->cache &&
+        dir->mtime_ns + CONFLICT_SEARCH_CACHE_SETTLE_TIME * 1000000000ULL <
+        s->cache->start_ns;
+}
+
+
+
+/*
+ * run_scan_tasks() - execute tasks until all of them are completed.
+ * The calling thread (id 0) reports progress.
+ */
+
+static void run_scan_tasks(ConflictScanner *s, int id, char **roots,
+                           int num_roots)
+{
+    ScanDir *dir;
+    int roots_done;
+
+    while (1) {
+        dir = take_scan_task(s, id);
+
+        if (!dir) {
+            pthread_mutex_lock(&s->lock);
+            while (s->queued == 0 && s->pending > 0) {
+                s->idle++;
+                pthread_cond_wait(&s->cond, &s->lock);
+                s->idle--;
+            }
+            if (s->pending == 0) {
+                pthread_mutex_unlock(&s->lock);
+                return;
+            }
+            pthread_mutex_unlock(&s->lock);
+            continue;
+        }
+
+        pthread_mutex_lock(&s->lock);
+        s->queued--;
+        roots_done = s->roots_done;
+        pthread_mutex_unlock(&s->lock);
+
+        if (roots) {
+            ui_status_update(s->op, (float) roots_done / num_roots,
+                             "Searching: %s", roots[dir->root]);
+        }
+
+        scan_directory(s, id, dir);
+
+        pthread_mutex_lock(&s->lock);
+        if (--s->root_pending[dir->root] == 0) s->roots_done++;
+        if (--s->pending == 0) pthread_cond_broadcast(&s->cond);
+        pthread_mutex_unlock(&s->lock);
+    }
+}
+
+
+static void *scan_worker(void *arg)
+{
+    ScanWorker *w = arg;
+
+    run_scan_tasks(w->scanner, w->id, NULL, 0);
+
+    return NULL;
+}
+
+
+/*
+ * merge_scan_results() - append the conflicting files found under dir
+ * to the FileList, in traversal order, and free the ScanDir.  Errors
+ * recorded by the scanner threads are reported here, on the main
+ * thread, as the ui is not thread-safe.
+ */
+
+static void merge_scan_results(Options *op, ScanDir *dir, FileList *l)
+{
+    int i;
+
+    for (i = 0; i < dir->num_items; i++) {
+        if (dir->items[i].error) {
+            ui_error(op, "%s", dir->items[i].error);
+            nvfree(dir->items[i].error);
+        }
+
+        if (dir->items[i].dir) {
+            merge_scan_results(op, dir->items[i].dir, l);
+        } else {
+            l->filename = nvrealloc(l->filename,
+                                    sizeof(char *) * (l->num + 1));
+            l->filename[l->num++] = dir->items[i].path;
+        }
+    }
+
+    nvfree(dir->items);
+    nvfree(dir->path);
+    nvfree(dir->own_listing);
+    nvfree(dir);
+}
+
+
+static void add_cached_directory(ConflictSearchCache *cache,
+                                 const CachedDirectory *cached)
+{
+    unsigned int h;
+
+    for (h = hash_name_prefix(cached->path, strlen(cached->path)) &
+             cache->mask;
+         cache->slots[h]; h = (h + 1) & cache->mask);
+
+    cache->dirs[cache->num_dirs] = *cached;
+    cache->slots[h] = ++cache->num_dirs;
+}
+
+
+static void init_conflict_search_cache(ConflictSearchCache *cache,
+                                       int max_dirs)
+{
+    unsigned int size = 16;
+
+    while (size < (unsigned int) max_dirs * 2) size <<= 1;
+
+    cache->dirs = nvalloc(sizeof(CachedDirectory) * (max_dirs + 1));
+    cache->num_dirs = 0;
+    cache->slots = nvalloc(sizeof(int) * size);
+    cache->mask = size - 1;
+}
+
+
+/*
+ * load_conflict_search_cache() - read CONFLICT_SEARCH_CACHE into the
+ * cache; a missing, invalid or insecure cache file is ignored.
+ */
+
+static void load_conflict_search_cache(ConflictSearchCache *cache)
+{
+    const ConflictSearchCacheHeader *header;
+    struct stat stat_buf;
+    struct timespec now;
+    size_t offset, size = 0;
+    ssize_t ret;
+    uint32 i;
+    int fd;
+
+    memset(cache, 0, sizeof(ConflictSearchCache));
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    cache->start_ns = (uint64_t) now.tv_sec * 1000000000ULL + now.tv_nsec;
+
+    if ((fd = open(CONFLICT_SEARCH_CACHE, O_RDONLY)) == -1) return;
+
+    if (fstat(fd, &stat_buf) == -1 ||
+        stat_buf.st_uid != geteuid() ||
+        (stat_buf.st_mode & (S_IWGRP | S_IWOTH)) ||
+        stat_buf.st_size < (off_t) sizeof(ConflictSearchCacheHeader)) {
+        close(fd);
+        return;
+    }
+
+    cache->data = nvalloc(stat_buf.st_size);
+
+    while (size < (size_t) stat_buf.st_size) {
+        ret = read(fd, cache->data + size, stat_buf.st_size - size);
+        if (ret <= 0) break;
+        size += ret;
+    }
+
+    close(fd);
+
+    header = (const ConflictSearchCacheHeader *) cache->data;
+
+    if (size != (size_t) stat_buf.st_size ||
+        memcmp(header->magic, CONFLICT_SEARCH_CACHE_MAGIC,
+               sizeof(header->magic)) != 0 ||
+        header->version != CONFLICT_SEARCH_CACHE_VERSION ||
+        header->num_dirs > size / sizeof(ConflictSearchCacheRecord)) {
+        goto fail;
+    }
+
+    init_conflict_search_cache(cache, header->num_dirs);
+
+    offset = sizeof(ConflictSearchCacheHeader);
+
+    for (i = 0; i < header->num_dirs; i++) {
+        CachedDirectory cached;
+
+        if (size - offset < sizeof(ConflictSearchCacheRecord)) goto fail;
+
+        memcpy(&cached.record, cache->data + offset,
+               sizeof(ConflictSearchCacheRecord));
+        offset += sizeof(ConflictSearchCacheRecord);
+
+        if (cached.record.path_length == 0 ||
+            size - offset < (size_t) cached.record.path_length +
+                            cached.record.listing_size) {
+            goto fail;
+        }
+
+        cached.path = cache->data + offset;
+        offset += cached.record.path_length;
+        cached.listing = cache->data + offset;
+        offset += cached.record.listing_size;
+
+        if (cached.path[cached.record.path_length - 1] != '\0' ||
+            (cached.record.listing_size &&
+             cached.listing[cached.record.listing_size - 1] != '\0') ||
+            find_cached_directory(cache, cached.path)) {
+            goto fail;
+        }
+
+        add_cached_directory(cache, &cached);
+    }
+
+    return;
+
+ fail:
+
+    nvfree(cache->data);
+    nvfree(cache->dirs);
+    nvfree(cache->slots);
+    cache->data = NULL;
+    cache->dirs = NULL;
+    cache->slots = NULL;
+    cache->num_dirs = 0;
+}
+
+
+static int count_cacheable_directories(const ScanDir *dir)
+{
+    int i, n = dir->cacheable ? 1 : 0;
+
+    for (i = 0; i < dir->num_items; i++) {
+        if (dir->items[i].dir) {
+            n += count_cacheable_directories(dir->items[i].dir);
+        }
+    }
+
+    return n;
+}
+
+
+static void collect_cacheable_directories(ConflictSearchCache *cache,
+                                          const ScanDir *dir)
+{
+    int i;
+
+    if (dir->cacheable && !find_cached_directory(cache, dir->path)) {
+        CachedDirectory cached;
+
+        cached.record.device = dir->device;
+        cached.record.inode = dir->inode;
+        cached.record.mtime_ns = dir->mtime_ns;
+        cached.record.path_length = strlen(dir->path) + 1;
+        cached.record.listing_size = dir->listing_size;
+        cached.path = dir->path;
+        cached.listing = dir->listing;
+
+        add_cached_directory(cache, &cached);
+    }
+
+    for (i = 0; i < dir->num_items; i++) {
+        if (dir->items[i].dir) {
+            collect_cacheable_directories(cache, dir->items[i].dir);
+        }
+    }
+}
+
+
+/*
+ * save_conflict_search_cache() - write the listings of the directories
+ * searched under root_dirs to CONFLICT_SEARCH_CACHE, along with the
+ * previously cached directories that were not searched this time.
+ * Failure to write the cache is not fatal.
+ */
+
+static void save_conflict_search_cache(Options *op,
+                                       const ConflictSearchCache *old,
+                                       ScanDir **root_dirs, int num_roots)
+{
+    ConflictSearchCache cache;
+    ConflictSearchCacheHeader header;
+    char *tmpname;
+    mode_t orig_mode;
+    FILE *f;
+    int i, n = old->num_dirs, ok;
+
+    for (i = 0; i < num_roots; i++) {
+        n += count_cacheable_directories(root_dirs[i]);
+    }
+
+    init_conflict_search_cache(&cache, n);
+
+    for (i = 0; i < num_roots; i++) {
+        collect_cacheable_directories(&cache, root_dirs[i]);
+    }
+
+    for (i = 0; i < old->num_dirs; i++) {
+        if (!find_cached_directory(&cache, old->dirs[i].path)) {
+            add_cached_directory(&cache, &old->dirs[i]);
+        }
+    }
+
+    if (!directory_exists(NVIDIA_INSTALLER_CACHE_DIRECTORY) &&
+        !mkdir_recursive(op, NVIDIA_INSTALLER_CACHE_DIRECTORY, 0755, FALSE)) {
+        goto done;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CONFLICT_SEARCH_CACHE_MAGIC, sizeof(header.magic));
+    header.version = CONFLICT_SEARCH_CACHE_VERSION;
+    header.num_dirs = cache.num_dirs;
+
+    tmpname = nvstrcat(CONFLICT_SEARCH_CACHE, ".tmp", NULL);
+
+    orig_mode = umask(022);
+    f = fopen(tmpname, "w");
+    umask(orig_mode);
+
+    if (!f) {
+        ui_log(op, "Unable to write the conflicting file search cache "
+               "'%s' (%s).", tmpname, strerror(errno));
+        nvfree(tmpname);
+        goto done;
+    }
+
+    ok = fwrite(&header, sizeof(header), 1, f) == 1;
+
+    for (i = 0; ok && i < cache.num_dirs; i++) {
+        const CachedDirectory *cached = &cache.dirs[i];
+
+        ok = fwrite(&cached->record, sizeof(cached->record), 1, f) == 1 &&
+             fwrite(cached->path, cached->record.path_length, 1, f) == 1 &&
+             (cached->record.listing_size == 0 ||
+              fwrite(cached->listing, cached->record.listing_size, 1,
+                     f) == 1);
+    }
+
+    if (fclose(f) != 0 || !ok || rename(tmpname, CONFLICT_SEARCH_CACHE) != 0) {
+        ui_log(op, "Unable to write the conflicting file search cache '%s'.",
+               CONFLICT_SEARCH_CACHE);
+        unlink(tmpname);
+    }
+
+    nvfree(tmpname);
+
+ done:
+
+    nvfree(cache.dirs);
+    nvfree(cache.slots);
+}
+
+
+/*
+ * find_conflicting_files() - search for any conflicting files in the
+ * hierarchies under the given roots.  If report_progress is TRUE, the
+ * status is updated as the roots are searched.
+ */
+
+static void find_conflicting_files(Options *op,
+                                   char **roots,
+                                   int num_roots,
+                                   ConflictingFileInfo *files,
+                                   FileList *l,
+                                   const NoRecursionDirectory *skipdirs,
+                                   int report_progress)
+{
+    ConflictScanner s;
+    ConflictSearchCache cache;
+    ScanDir **root_dirs;
+    ScanWorker *workers;
+    pthread_t *threads;
+    struct stat stat_buf;
+    int i, num_workers, num_threads = 0;
+
+    memset(&s, 0, sizeof(s));
+    s.op = op;
+    s.files = files;
+    s.skipdirs = skipdirs;
+    s.num_deques = op->concurrency_level > 1 ? op->concurrency_level : 1;
+    s.deques = nvalloc(sizeof(ScanDeque) * s.num_deques);
+    s.root_pending = nvalloc(sizeof(int) * (num_roots + 1));
+    pthread_mutex_init(&s.lock, NULL);
+    pthread_cond_init(&s.cond, NULL);
+
+    init_conflicting_name_table(&s.names, files);
+
+    if (op->conflict_search_cache) {
+        load_conflict_search_cache(&cache);
+        s.cache = &cache;
+    }
+
+    for (i = 0; i < s.num_deques; i++) {
+        s.deques[i].size = 64;
+        s.deques[i].tasks = nvalloc(sizeof(ScanDir *) * s.deques[i].size);
+        pthread_mutex_init(&s.deques[i].lock, NULL);
+    }
+
+    /* queue the roots, matching or skipping any that are not directories */
+
+    root_dirs = nvalloc(sizeof(ScanDir *) * (num_roots + 1));
+
+    for (i = 0; i < num_roots; i++) {
+        const char *name = strrchr(roots[i], '/');
+        int is_file = FALSE, n, j;
+
+        name = name ? name + 1 : roots[i];
+
+        root_dirs[i] = nvalloc(sizeof(ScanDir));
+        root_dirs[i]->path = nvstrdup(roots[i]);
+        root_dirs[i]->root = i;
+
+        if (stat(roots[i], &stat_buf) == 0) {
+            if (S_ISDIR(stat_buf.st_mode)) {
+                if (!skip_directory(&s, name, 0)) {
+                    root_dirs[i]->device = stat_buf.st_dev;
+                    root_dirs[i]->inode = stat_buf.st_ino;
+                    root_dirs[i]->mtime_ns = scan_mtime_ns(&stat_buf);
+                    push_scan_task(&s, 0, root_dirs[i]);
+                }
+                continue;
+            }
+            is_file = S_ISREG(stat_buf.st_mode);
+        } else if (errno == ENOENT && lstat(roots[i], &stat_buf) == 0) {
+            is_file = TRUE;
+        }
+
+        if (is_file) {
+            int *matches = nvalloc(sizeof(int) * (s.names.num_files + 1));
+
+            n = match_conflicting_name(&s.names, files, name, matches);
+            for (j = 0; j < n; j++) {
+                char *error = NULL;
+
+                if (!ignore_conflicting_file(roots[i], files[matches[j]],
+                                             &error)) {
+                    add_scan_item(root_dirs[i], nvstrdup(roots[i]), NULL,
+                                  error);
+                } else {
+                    nvfree(error);
+                }
+            }
+            nvfree(matches);
+        }
+    }
+
+    /* start the workers, and take part in the search */
+
+    threads = nvalloc(sizeof(pthread_t) * s.num_deques);
+    workers = nvalloc(sizeof(ScanWorker) * s.num_deques);
+    num_workers = s.pending > 0 ? s.num_deques : 1;
+
+    for (i = 1; i < num_workers; i++) {
+        workers[i].scanner = &s;
+        workers[i].id = i;
+        if (pthread_create(&threads[num_threads], NULL, scan_worker,
+                           &workers[i]) != 0) {
+            break;
+        }
+        num_threads++;
+    }
+
+    run_scan_tasks(&s, 0, report_progress ? roots : NULL, num_roots);
+
+    for (i = 0; i < num_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    if (s.cache) {
+        save_conflict_search_cache(op, &cache, root_dirs, num_roots);
+        nvfree(cache.data);
+        nvfree(cache.dirs);
+        nvfree(cache.slots);
+    }
+
+    for (i = 0; i < num_roots; i++) {
+        merge_scan_results(op, root_dirs[i], l);
+    }
+
+    for (i = 0; i < s.num_deques; i++) {
+        nvfree(s.deques[i].tasks);
+        pthread_mutex_destroy(&s.deques[i].lock);
+    }
+
+    nvfree(root_dirs);
+    nvfree(threads);
+    nvfree(workers);
+    nvfree(s.deques);
+    nvfree(s.root_pending);
+    nvfree(s.names.slots);
+    nvfree(s.names.lengths);
+    pthread_mutex_destroy(&s.lock);
+    pthread_cond_destroy(&s.cond);
+
+} /* find_conflicting_files() */
+
+void get_conflicting_file_info(const char *file, ConflictingFileInfo *cfi)
+{
+    char *c;
+
+    cfi->name = file;
 
     /*
      * match the names of DSOs with "libfoo.so*" by stopping any comparisons
@@ -914,83 +2812,45 @@ ConflictingFileInfo *build_conflicting_file_list(Options *op, Package *p)
 
 /*
  * condense_file_list() - Take a FileList structure and delete any
- * duplicate entries in the list.  This is a pretty brain dead
- * brute-force algorithm.
+ * duplicate entries in the list, as well as any files that are part of
+ * the package, preserving the order of the remaining entries.
  */
 
 static void condense_file_list(Package *p, FileList *l)
 {
-    char **s = NULL;
-    int n = 0, i, j, keep;
+    FileIdSet set;
+    struct stat stat_buf;
+    int n = 0, i;
 
-    struct stat stat_buf, *stat_bufs;
+    /*
+     * seed the set with the files in the package we're trying to
+     * install; we don't want to remove files that are in the package;
+     * symlinks may have tricked us into looking for conflicting files
+     * inside our unpacked .run file.
+     */
 
-    /* allocate enough space in our temporary 'stat' array */
+    init_file_id_set(&set, p->num_entries + l->num);
 
-    if (l->num) {
-        stat_bufs  = nvalloc(sizeof(struct stat) * l->num);
-    } else {
-        stat_bufs  = NULL;
+    for (i = 0; i < p->num_entries; i++) {
+        add_file_id(&set, p->entries[i].device, p->entries[i].inode);
     }
-    
+
     /*
-     * walk through our original (uncondensed) list of files and move
-     * unique files to a new (condensed) list.  For each file in the
-     * original list, get the filesystem information for the file, and
-     * then compare that to the filesystem information for all the
-     * files in the new list.  If the file from the original list does
-     * not match any file in the new list, add it to the new list.
+     * walk through the list of files and keep, in place, each file
+     * whose device and inode have not been seen yet.
      */
 
     for (i = 0; i < l->num; i++) {
-        keep = TRUE;
-
-        if (lstat(l->filename[i], &stat_buf) == -1)
-            continue;
-
-        /*
-         * check if this file is in the package we're trying to
-         * install; we don't want to remove files that are in the
-         * package; symlinks may have tricked us into looking for
-         * conflicting files inside our unpacked .run file.
-         */
-
-        for (j = 0; j < p->num_entries; j++) {
-            if ((p->entries[j].device == stat_buf.st_dev) &&
-                (p->entries[j].inode == stat_buf.st_ino)) {
-                keep = FALSE;
-                break;
-            }
-        }
-
-        for (j = 0; keep && (j < n); j++) {
-
-            /*
-             * determine if the two files are the same by comparing
-             * device and inode
-             */
-
-            if ((stat_buf.st_dev == stat_bufs[j].st_dev) &&
-                (stat_buf.st_ino == stat_bufs[j].st_ino)) {
-                keep = FALSE;
-                break;
-            }
-        }
-
-        if (keep) {
-            s = (char **) nvrealloc(s, sizeof(char *) * (n + 1));
-            s[n] = nvstrdup(l->filename[i]);
-            stat_bufs[n] = stat_buf;
-            n++;
+        if (lstat(l->filename[i], &stat_buf) == 0 &&
+            add_file_id(&set, stat_buf.st_dev, stat_buf.st_ino)) {
+            l->filename[n++] = l->filename[i];
+        } else {
+            free(l->filename[i]);
         }
     }
-    
-    if (stat_bufs) nvfree((void *)stat_bufs);
 
-    for (i = 0; i < l->num; i++) free(l->filename[i]);
-    free(l->filename);
+    nvfree(set.slots);
 
-    l->filename = s;
     l->num = n;
 
 } /* condense_file_list() */
@@ -1015,6 +2875,7 @@ static void add_command(CommandList *c, int cmd, ...)
     c->cmds[n].s1   = NULL;
     c->cmds[n].s2   = NULL;
     c->cmds[n].mode = 0x0;
+    c->cmds[n].flags = 0;
     
     va_start(ap, cmd);
 
@@ -1035,6 +2896,8 @@ static void add_command(CommandList *c, int cmd, ...)
       case RUN_CMD:
         s = va_arg(ap, char *);
         c->cmds[n].s0 = nvstrdup(s);
+        s = va_arg(ap, char *);
+        c->cmds[n].s1 = nvstrdup(s);
         break;
       case SYMLINK_CMD:
         s = va_arg(ap, char *);
@@ -34,6 +34,7 @@ typedef struct {
     char *s1;
     char *s2;
     mode_t mode;
+    int flags;
 } Command;
 
 typedef struct {
@@ -63,10 +64,21 @@ typedef struct {
  * BACKUP - move the file named in s0, storing it in the backup
  * directory and recording the data as appropriate.
  *
- * RUN - execute the string in s0
+ * RUN - execute the string in s0; if s1 is non-NULL, the command only
+ * modifies the file named in s1, and may run concurrently with commands
+ * that do not touch that file.
  *
  * SYMLINK - create a symbolic link named s0, pointing at the filename
  * specified in s1.
+ *
+ * The flags of a command allow its external command to be performed
+ * in-process instead, falling back to running the command if that fails:
+ *
+ * CMD_FLAG_CLEAR_EXECSTACK - the post-install step of an INSTALL is
+ * `execstack -c s1`.
+ *
+ * CMD_FLAG_SET_SECURITY_CONTEXT - a RUN is `chcon -t <type> s1`, where
+ * <type> is op->selinux_chcon_type.
  */
 
 #define INSTALL_CMD 1
@@ -75,6 +87,9 @@ typedef struct {
 #define SYMLINK_CMD 4
 #define DELETE_CMD  5
 
+#define CMD_FLAG_CLEAR_EXECSTACK      0x1
+#define CMD_FLAG_SET_SECURITY_CONTEXT 0x2
+
 
 CommandList *build_command_list(Options*, Package *);
 void free_command_list(Options*, CommandList*);
@@ -39,6 +39,7 @@
 #include <fcntl.h>
 #include <string.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include "nvidia-installer.h"
 #include "user-interface.h"
@@ -69,34 +70,102 @@ static uint32 crc_init(uint32 crc)
 
 
 
-uint32 compute_crc_from_buffer(const uint8 *buf, int len)
+/*
+ * The CRC is computed "slice-by-8": crctab[0] is the classic byte-wise
+ * table, and crctab[k][i] is the CRC contribution of byte i followed by
+ * k zero bytes, so that eight input bytes can be folded into the CRC
+ * with eight independent table lookups.  The result is identical to
+ * the byte-wise algorithm.
+ *
+ * The tables are initialized once, with pthread_once(), so that CRCs
+ * may be computed concurrently from multiple threads.
+ */
+
+#define CRC_SLICES 8
+
+static uint32 crctab[CRC_SLICES][256];
+static pthread_once_t crctab_once = PTHREAD_ONCE_INIT;
+
+static void crctab_init(void)
 {
-    uint32 cword = ~0;
-    static uint32 *crctab = NULL;
-    int i;
+    int i, k;
 
-    if (!crctab) {
-        crctab = (uint32 *) nvalloc(sizeof(uint32) * 256);
-        for (i=0; i < 256; i++) {
-            crctab[i] = crc_init(i << 24);
+    for (i = 0; i < 256; i++) {
+        crctab[0][i] = crc_init(i << 24);
+    }
+
+    for (k = 1; k < CRC_SLICES; k++) {
+        for (i = 0; i < 256; i++) {
+            uint32 prev = crctab[k - 1][i];
+            crctab[k][i] = crctab[0][prev >> 24] ^ (prev << 8);
         }
     }
 
-    for (i = 0; i < len; i++) {
-        cword = crctab[buf[i] ^ (cword >> 24)] ^ (cword << 8);
+} /* crctab_init() */
+
+
+
+/*
+ * compute_crc_update() - fold len bytes of buf into the running CRC
+ * cword; a CRC computation starts with cword = ~0.
+ */
+
+uint32 compute_crc_update(uint32 cword, const uint8 *buf, size_t len)
+{
+    pthread_once(&crctab_once, crctab_init);
+
+    while (len >= CRC_SLICES) {
+        uint32 hi = cword ^ (((uint32) buf[0] << 24) |
+                             ((uint32) buf[1] << 16) |
+                             ((uint32) buf[2] << 8)  |
+                              (uint32) buf[3]);
+
+        cword = crctab[7][hi >> 24]          ^
+                crctab[6][(hi >> 16) & 0xff] ^
+                crctab[5][(hi >> 8) & 0xff]  ^
+                crctab[4][hi & 0xff]         ^
+                crctab[3][buf[4]]            ^
+                crctab[2][buf[5]]            ^
+                crctab[1][buf[6]]            ^
+                crctab[0][buf[7]];
+
+        buf += CRC_SLICES;
+        len -= CRC_SLICES;
+    }
+
+    while (len--) {
+        cword = crctab[0][*buf++ ^ (cword >> 24)] ^ (cword << 8);
     }
 
     return cword;
+
+} /* compute_crc_update() */
+
+
+
+uint32 compute_crc_from_buffer(const uint8 *buf, int len)
+{
+    if (len <= 0) {
+        return ~0;
+    }
+
+    return compute_crc_update(~0, buf, len);
 }
 
 
 
-uint32 compute_crc(Options *op, const char *filename)
+/*
+ * try_compute_crc() - compute the CRC of the given file without
+ * reporting errors; returns FALSE, with errno set, on failure.  This
+ * may be called from multiple threads.
+ */
+
+int try_compute_crc(const char *filename, uint32 *crc)
 {
     uint32 cword = ~0;
     uint8 *buf = MAP_FAILED;
     int success = FALSE;
-    int fd;
+    int fd, err;
     struct stat stat_buf;
     size_t len = 0;
 
@@ -113,15 +182,12 @@ uint32 compute_crc(Options *op, const char *filename)
     buf = mmap(0, len, PROT_READ, MAP_FILE | MAP_SHARED, fd, 0);
     if (buf == MAP_FAILED) goto done;
 
-    cword = compute_crc_from_buffer(buf, len);
+    cword = compute_crc_update(cword, buf, len);
 
     success = TRUE;
 
  done:
-    if (!success) {
-        ui_warn(op, "Unable to compute CRC for file '%s' (%s).",
-                filename, strerror(errno));
-    }
+    err = errno;
 
     if (buf != MAP_FAILED) {
         munmap(buf, len);
@@ -129,7 +195,25 @@ uint32 compute_crc(Options *op, const char *filename)
     if (fd >= 0) {
         close(fd);
     }
-    
+
+    *crc = cword;
+    errno = err;
+
+    return success;
+
+} /* try_compute_crc() */
+
+
+
+uint32 compute_crc(Options *op, const char *filename)
+{
+    uint32 cword;
+
+    if (!try_compute_crc(filename, &cword)) {
+        ui_warn(op, "Unable to compute CRC for file '%s' (%s).",
+                filename, strerror(errno));
+    }
+
     return cword;
         
 } /* compute_crc() */
@@ -21,7 +21,9 @@
 #ifndef __NVIDIA_INSTALLER_CRC_H__
 #define __NVIDIA_INSTALLER_CRC_H__
 
+uint32 compute_crc_update(uint32 cword, const uint8 *buf, size_t len);
 uint32 compute_crc_from_buffer(const uint8 *buf, int len);
 uint32 compute_crc(Options *op, const char *filename);
+int try_compute_crc(const char *filename, uint32 *crc);
 
 #endif /* __NVIDIA_INSTALLER_CRC_H__ */
@@ -36,6 +36,10 @@
 #include <utime.h>
 #include <time.h>
 #include <sys/wait.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#include <sys/xattr.h>
 
 #include "nvidia-installer.h"
 #include "user-interface.h"
@@ -43,6 +47,7 @@
 #include "misc.h"
 #include "precompiled.h"
 #include "backup.h"
+#include "crc.h"
 
 
 static char *get_xdg_data_dir(void);
@@ -208,73 +213,368 @@ int touch_directory(Options *op, const char *victim)
 
 
 /*
- * copy_file() - copy the file specified by srcfile to dstfile, using
- * mmap and memcpy.  The destination file is created with the
- * permissions specified by mode.  Roughly based on code presented by
- * Richard Stevens, in Advanced Programming in the Unix Environment,
- * 12.9.
+ * copy_file() - copy the file specified by srcfile to dstfile.  The
+ * destination file is created with the permissions specified by mode.
  */
 
 int copy_file(Options *op, const char *srcfile,
               const char *dstfile, mode_t mode)
 {
+    return copy_file_with_crc(op, srcfile, dstfile, mode, NULL, NULL, NULL);
+
+} /* copy_file() */
+
+
+
+/*
+ * copy strategy names, indexed by CopyStrategy; these are also the
+ * values accepted by the --copy-strategy option
+ */
+
+static const char *copy_strategy_names[] = {
+    [COPY_STRATEGY_AUTO]            = "auto",
+    [COPY_STRATEGY_REFLINK]         = "reflink",
+    [COPY_STRATEGY_COPY_FILE_RANGE] = "copy-file-range",
+    [COPY_STRATEGY_SENDFILE]        = "sendfile",
+    [COPY_STRATEGY_MMAP]            = "mmap",
+};
+
+const char *copy_strategy_name(CopyStrategy strategy)
+{
+    if (strategy < 0 || strategy >= ARRAY_LEN(copy_strategy_names)) {
+        return "unknown";
+    }
+
+    return copy_strategy_names[strategy];
+}
+
+int parse_copy_strategy(const char *str, CopyStrategy *strategy)
+{
+    int i;
+
+    for (i = 0; i < ARRAY_LEN(copy_strategy_names); i++) {
+        if (strcmp(str, copy_strategy_names[i]) == 0) {
+            *strategy = i;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+
+
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+
+/*
+ * copy_unsupported() - return TRUE if errno indicates that a copy
+ * strategy is not supported for this pair of files, as opposed to an
+ * I/O error.
+ */
+
+static int copy_unsupported(int err)
+{
+    return err == EOPNOTSUPP || err == ENOTSUP || err == EXDEV ||
+           err == EINVAL || err == ENOSYS || err == ENOTTY;
+}
+
+/*
+ * The copy_with_*() helpers return 1 on success, 0 if the strategy is
+ * not supported (nothing has been written), and -1 on error; errno is
+ * set in the latter two cases.
+ */
+
+static int copy_with_reflink(int src_fd, int dst_fd, size_t len)
+{
+    if (ioctl(dst_fd, FICLONE, src_fd) == 0) {
+        return 1;
+    }
+
+    return copy_unsupported(errno) ? 0 : -1;
+}
+
+static int copy_with_copy_file_range(int src_fd, int dst_fd, size_t len)
+{
+#if defined(SYS_copy_file_range)
+    loff_t off_in = 0, off_out = 0;
+
+    while (off_in < len) {
+        ssize_t ret = syscall(SYS_copy_file_range, src_fd, &off_in,
+                              dst_fd, &off_out, len - off_in, 0);
+        if (ret < 0 && errno == EINTR) continue;
+        if (ret <= 0) {
+            if (ret == 0) errno = EIO;
+            return (off_in == 0 && copy_unsupported(errno)) ? 0 : -1;
+        }
+    }
+
+    return 1;
+#else
+    errno = ENOSYS;
+    return 0;
+#endif
+}
+
+static int copy_with_sendfile(int src_fd, int dst_fd, size_t len)
+{
+    off_t offset = 0;
+
+    while (offset < len) {
+        ssize_t ret = sendfile(dst_fd, src_fd, &offset, len - offset);
+        if (ret < 0 && errno == EINTR) continue;
+        if (ret <= 0) {
+            if (ret == 0) errno = EIO;
+            return (offset == 0 && copy_unsupported(errno)) ? 0 : -1;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * report_copy_error() - report an error while copying a file: the
+ * message is returned in *error if error is non-NULL (see
+ * copy_file_with_crc()), and passed to ui_error() otherwise.
+ */
+
+static void report_copy_error(Options *op, char **error, const char *fmt, ...)
+    NV_ATTRIBUTE_PRINTF(3, 4);
+
+static void report_copy_error(Options *op, char **error, const char *fmt, ...)
+{
+    char *msg;
+
+    NV_VSNPRINTF(msg, fmt);
+
+    if (error) {
+        nvfree(*error);
+        *error = msg;
+    } else {
+        ui_error(op, "%s", msg);
+        nvfree(msg);
+    }
+}
+
+/*
+ * copy_with_mmap() - copy using mmap and memcpy; roughly based on code
+ * presented by Richard Stevens, in Advanced Programming in the Unix
+ * Environment, 12.9.  If crc is non-NULL, also compute the CRC of the
+ * copied data in the same pass: each chunk is checksummed right after
+ * it is copied, while it is still in the cache.  Errors are reported
+ * with report_copy_error(); returns TRUE on success.
+ */
+
+#define COPY_CHUNK_SIZE (1 << 20)
+
+static int copy_with_mmap(Options *op, const char *srcfile, int src_fd,
+                          const char *dstfile, int dst_fd, size_t len,
+                          uint32 *crc, char **error)
+{
+    char *src, *dst;
+    size_t offset;
+
+    if (lseek(dst_fd, len - 1, SEEK_SET) == -1) {
+        report_copy_error(op, error,
+                          "Unable to set file size for '%s' (%s)", dstfile,
+                          strerror (errno));
+        return FALSE;
+    }
+    if (write(dst_fd, "", 1) != 1) {
+        report_copy_error(op, error,
+                          "Unable to write file size for '%s' (%s)", dstfile,
+                          strerror (errno));
+        return FALSE;
+    }
+    if ((src = mmap(0, len, PROT_READ,
+                    MAP_FILE | MAP_SHARED, src_fd, 0)) == (void *) -1) {
+        report_copy_error(op, error,
+                          "Unable to map source file '%s' for copying (%s)",
+                          srcfile, strerror (errno));
+        return FALSE;
+    }
+    if ((dst = mmap(0, len, PROT_READ | PROT_WRITE,
+                    MAP_FILE | MAP_SHARED, dst_fd, 0)) == (void *) -1) {
+        report_copy_error(op, error,
+                          "Unable to map destination file '%s' for "
+                          "copying (%s)",
+                          dstfile, strerror (errno));
+        munmap(src, len);
+        return FALSE;
+    }
+
+    if (crc) {
+        uint32 cword = ~0;
+
+        for (offset = 0; offset < len; offset += COPY_CHUNK_SIZE) {
+            size_t chunk = len - offset;
+
+            if (chunk > COPY_CHUNK_SIZE) chunk = COPY_CHUNK_SIZE;
+
+            memcpy(dst + offset, src + offset, chunk);
+            cword = compute_crc_update(cword, (uint8 *) src + offset, chunk);
+        }
+
+        *crc = cword;
+    } else {
+        memcpy (dst, src, len);
+    }
+
+    if (munmap (src, len) == -1) {
+        report_copy_error(op, error,
+                          "Unable to unmap source file '%s' after "
+                          "copying (%s)",
+                          srcfile, strerror (errno));
+        munmap(dst, len);
+        return FALSE;
+    }
+    if (munmap (dst, len) == -1) {
+        report_copy_error(op, error,
+                          "Unable to unmap destination file '%s' after "
+                          "copying (%s)",
+                          dstfile, strerror (errno));
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/*
+ * crc_from_fd() - compute the CRC of the first len bytes of fd, for
+ * strategies where the copied data does not pass through the installer.
+ */
+
+static int crc_from_fd(Options *op, const char *filename, int fd, size_t len,
+                       uint32 *crc, char **error)
+{
+    uint8 *buf;
+
+    buf = mmap(0, len, PROT_READ, MAP_FILE | MAP_SHARED, fd, 0);
+    if (buf == MAP_FAILED) {
+        report_copy_error(op, error,
+                          "Unable to map '%s' to compute its CRC (%s)",
+                          filename, strerror(errno));
+        return FALSE;
+    }
+
+    *crc = compute_crc_update(~0, buf, len);
+    munmap(buf, len);
+
+    return TRUE;
+}
+
+
+
+/*
+ * copy_file_with_crc() - copy the file specified by srcfile to dstfile,
+ * creating the destination with the permissions specified by mode.
+ *
+ * Unless a strategy is forced with --copy-strategy, the contents are
+ * copied by the cheapest method that works for the pair of files:
+ * FICLONE reflinks share the data blocks on filesystems such as btrfs
+ * and XFS, copy_file_range(2) and sendfile(2) copy within the kernel,
+ * and the mmap path is always available.  The strategy used is
+ * returned in *strategy, if non-NULL.
+ *
+ * If crc is non-NULL, the CRC of the copied data (as compute_crc()
+ * would report for dstfile) is returned in *crc.
+ *
+ * If error is non-NULL, errors are not reported through the ui: the
+ * message is returned in *error instead, which the caller must free.
+ * This allows copy_file_with_crc() to be called from any thread.
+ */
+
+int copy_file_with_crc(Options *op, const char *srcfile,
+                       const char *dstfile, mode_t mode, uint32 *crc,
+                       CopyStrategy *strategy, char **error)
+{
+    static const CopyStrategy auto_strategies[] = {
+        COPY_STRATEGY_REFLINK,
+        COPY_STRATEGY_COPY_FILE_RANGE,
+        COPY_STRATEGY_SENDFILE,
+        COPY_STRATEGY_MMAP,
+    };
+    const CopyStrategy *candidates = auto_strategies;
+    int num_candidates = ARRAY_LEN(auto_strategies);
     int src_fd = -1, dst_fd = -1;
     int success = FALSE;
     struct stat stat_buf;
-    char *src, *dst;
-    
-    if ((src_fd = open(srcfile, O_RDONLY)) == -1) {
-        ui_error (op, "Unable to open '%s' for copying (%s)",
-                  srcfile, strerror (errno));
+    CopyStrategy used = COPY_STRATEGY_AUTO;
+    size_t len;
+    int i, ret;
+
+    if (crc) *crc = 0;
+    if (strategy) *strategy = COPY_STRATEGY_AUTO;
+
+    if (op->copy_strategy != COPY_STRATEGY_AUTO) {
+        candidates = &op->copy_strategy;
+        num_candidates = 1;
+    }
+
+    if ((src_fd = open(srcfile, O_RDONLY | O_CLOEXEC)) == -1) {
+        report_copy_error(op, error,
+                          "Unable to open '%s' for copying (%s)", srcfile,
+                          strerror (errno));
         goto done;
     }
-    if ((dst_fd = open(dstfile, O_RDWR | O_CREAT | O_TRUNC, mode)) == -1) {
-        ui_error (op, "Unable to create '%s' for copying (%s)",
-                  dstfile, strerror (errno));
+    if ((dst_fd = open(dstfile, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
+                       mode)) == -1) {
+        report_copy_error(op, error,
+                          "Unable to create '%s' for copying (%s)", dstfile,
+                          strerror (errno));
         goto done;
     }
     if (fstat(src_fd, &stat_buf) == -1) {
-        ui_error (op, "Unable to determine size of '%s' (%s)",
-                  srcfile, strerror (errno));
+        report_copy_error(op, error,
+                          "Unable to determine size of '%s' (%s)", srcfile,
+                          strerror (errno));
         goto done;
     }
     if (stat_buf.st_size == 0) {
         success = TRUE;
         goto done;
     }
-    if (lseek(dst_fd, stat_buf.st_size - 1, SEEK_SET) == -1) {
-        ui_error (op, "Unable to set file size for '%s' (%s)",
-                  dstfile, strerror (errno));
-        goto done;
-    }
-    if (write(dst_fd, "", 1) != 1) {
-        ui_error (op, "Unable to write file size for '%s' (%s)",
-                  dstfile, strerror (errno));
-        goto done;
-    }
-    if ((src = mmap(0, stat_buf.st_size, PROT_READ,
-                    MAP_FILE | MAP_SHARED, src_fd, 0)) == (void *) -1) {
-        ui_error (op, "Unable to map source file '%s' for copying (%s)",
-                  srcfile, strerror (errno));
-        goto done;
-    }
-    if ((dst = mmap(0, stat_buf.st_size, PROT_READ | PROT_WRITE,
-                    MAP_FILE | MAP_SHARED, dst_fd, 0)) == (void *) -1) {
-        ui_error (op, "Unable to map destination file '%s' for copying (%s)",
-                  dstfile, strerror (errno));
-        goto done;
-    }
-    
-    memcpy (dst, src, stat_buf.st_size);
-    
-    if (munmap (src, stat_buf.st_size) == -1) {
-        ui_error (op, "Unable to unmap source file '%s' after copying (%s)",
-                 srcfile, strerror (errno));
-        goto done;
+
+    len = stat_buf.st_size;
+
+    for (i = 0; i < num_candidates; i++) {
+        used = candidates[i];
+
+        switch (used) {
+        case COPY_STRATEGY_REFLINK:
+            ret = copy_with_reflink(src_fd, dst_fd, len);
+            break;
+        case COPY_STRATEGY_COPY_FILE_RANGE:
+            ret = copy_with_copy_file_range(src_fd, dst_fd, len);
+            break;
+        case COPY_STRATEGY_SENDFILE:
+            ret = copy_with_sendfile(src_fd, dst_fd, len);
+            break;
+        case COPY_STRATEGY_MMAP:
+        default:
+            if (!copy_with_mmap(op, srcfile, src_fd, dstfile, dst_fd, len,
+                                crc, error)) {
+                goto done;
+            }
+            success = TRUE;
+            goto done;
+        }
+
+        if (ret > 0) {
+            break;
+        }
+
+        if (ret < 0 || num_candidates == 1) {
+            report_copy_error(op, error,
+                              "Unable to copy '%s' to '%s' using %s (%s)",
+                              srcfile, dstfile, copy_strategy_name(used),
+                              strerror(errno));
+            goto done;
+        }
     }
-    if (munmap (dst, stat_buf.st_size) == -1) {
-        ui_error (op, "Unable to unmap destination file '%s' after "
-                 "copying (%s)", dstfile, strerror (errno));
+
+    if (crc && !crc_from_fd(op, srcfile, src_fd, len, crc, error)) {
         goto done;
     }
 
@@ -289,6 +589,8 @@ int copy_file(Options *op, const char *srcfile,
          */
 
         fchmod(dst_fd, mode);
+
+        if (strategy) *strategy = used;
     }
 
     if (src_fd != -1) {
@@ -1626,21 +1928,137 @@ int copy_directory_contents(Options *op, const char *src, const char *dst)
 
 
 /*
- * pack_precompiled_files() - Create a new precompiled files package for the
- * given PrecompiledFileInfo array and save it to disk.
+ * clone_directory() - recursive helper for clone_directory_contents().
  */
 
-int pack_precompiled_files(Options *op, Package *p, int num_files,
-                           PrecompiledFileInfo *files)
+static int clone_directory(Options *op, const FileIdSet *inputs,
+                           const char *src, const char *dst, int *try_link,
+                           int *linked, int *copied)
 {
-    char time_str[256], *proc_version_string;
-    char *outfile, *descr;
+    DIR *dir;
+    struct dirent *ent;
+    int status = FALSE;
+
+    if ((dir = opendir(src)) == NULL) {
+        ui_error(op, "Unable to open directory '%s' (%s).",
+                 src, strerror(errno));
+        return FALSE;
+    }
+
+    while ((ent = readdir(dir)) != NULL) {
+        struct stat stat_buf;
+        char *srcfile, *dstfile;
+        int ret;
+
+        if (((strcmp(ent->d_name, ".")) == 0) ||
+            ((strcmp(ent->d_name, "..")) == 0)) continue;
+
+        srcfile = nvstrcat(src, "/", ent->d_name, NULL);
+        dstfile = nvstrcat(dst, "/", ent->d_name, NULL);
+
+        ret = (stat(srcfile, &stat_buf) != -1);
+
+        if (ret) {
+            if (S_ISDIR(stat_buf.st_mode)) {
+                ret = mkdir_recursive(op, dstfile, stat_buf.st_mode, FALSE) &&
+                      clone_directory(op, inputs, srcfile, dstfile, try_link,
+                                      linked, copied);
+            } else if (S_ISREG(stat_buf.st_mode)) {
+                if (*try_link &&
+                    find_file_id(inputs, stat_buf.st_dev, stat_buf.st_ino)) {
+                    if (link(srcfile, dstfile) == 0) {
+                        (*linked)++;
+                        goto next;
+                    }
+
+                    /* don't retry links across filesystems */
+
+                    if (errno == EXDEV) {
+                        *try_link = FALSE;
+                    }
+                }
+
+                ret = copy_file(op, srcfile, dstfile, stat_buf.st_mode);
+                (*copied)++;
+            }
+        }
+
+    next:
+        nvfree(srcfile);
+        nvfree(dstfile);
+
+        if (!ret) {
+            goto done;
+        }
+    }
+
+    status = TRUE;
+
+  done:
+
+    if (closedir(dir) != 0) {
+        ui_error(op, "Failure while closing directory '%s' (%s).",
+                 src, strerror(errno));
+
+        return FALSE;
+    }
+
+    return status;
+}
+
+
+
+/*
+ * clone_directory_contents() - recursively clone the contents of directory
+ * src to directory dst, like copy_directory_contents(), to set up a scratch
+ * build tree.  Files that are unmodified kernel module source files of the
+ * package, as identified by their device and inode, are only ever read by
+ * the build: they are hard linked rather than copied.  All other files, and
+ * files that cannot be hard linked, e.g. because dst is on a different
+ * filesystem, are copied with copy_file(), which reflinks them or copies
+ * them within the kernel where possible.  The numbers of files that were
+ * linked and copied are returned in *linked and *copied.
+ */
+
+int clone_directory_contents(Options *op, Package *p, const char *src,
+                             const char *dst, int *linked, int *copied)
+{
+    FileIdSet inputs;
+    int try_link = TRUE, ret, i;
+
+    *linked = *copied = 0;
+
+    init_file_id_set(&inputs, p->num_entries);
+
+    for (i = 0; i < p->num_entries; i++) {
+        if (p->entries[i].type == FILE_TYPE_KERNEL_MODULE_SRC &&
+            p->entries[i].inode != 0) {
+            add_file_id(&inputs, p->entries[i].device, p->entries[i].inode);
+        }
+    }
+
+    ret = clone_directory(op, &inputs, src, dst, &try_link, linked, copied);
+
+    nvfree(inputs.slots);
+
+    return ret;
+}
+
+
+
+/*
+ * write_precompiled_package() - write the precompiled package 'info' to a
+ * new, uniquely named file in the package's precompiled kernel interface
+ * directory, and free it.
+ */
+
+static int write_precompiled_package(Options *op, Package *p,
+                                     PrecompiledInfo *info)
+{
+    char time_str[256];
+    char *outfile;
     time_t t;
-    struct utsname buf;
     int ret;
-    PrecompiledInfo *info;
-
-    ui_log(op, "Packaging precompiled kernel interface.");
 
     /* make sure the precompiled_kernel_interface_directory exists */
 
@@ -1648,6 +2066,7 @@ int pack_precompiled_files(Options *op, Package *p, int num_files,
                          FALSE)) {
         ui_error(op, "Failed to create the directory '%s'!",
                  p->precompiled_kernel_interface_directory);
+        free_precompiled(info);
         return FALSE;
     }
     
@@ -1656,6 +2075,46 @@ int pack_precompiled_files(Options *op, Package *p, int num_files,
     t = time(NULL);
     snprintf(time_str, 256, "%lu", t);
 
+    outfile = nvstrcat(p->precompiled_kernel_interface_directory, "/",
+                       PRECOMPILED_PACKAGE_FILENAME, "-", p->version,
+                       ".", time_str, NULL);
+
+    ret = precompiled_pack(info, outfile);
+
+    /* keep the directory's precompiled package index up to date */
+
+    if (ret) {
+        precompiled_update_index(op, p->precompiled_kernel_interface_directory);
+    }
+
+    nvfree(outfile);
+    free_precompiled(info);
+
+    if (ret) {
+        return TRUE;
+    }
+    else {
+        ui_error(op, "Unable to package precompiled kernel interface.");
+        return FALSE;
+    }
+}
+
+
+
+/*
+ * pack_precompiled_files() - Create a new precompiled files package for the
+ * given PrecompiledFileInfo array and save it to disk.
+ */
+
+int pack_precompiled_files(Options *op, Package *p, int num_files,
+                           PrecompiledFileInfo *files)
+{
+    char *proc_version_string, *descr;
+    struct utsname buf;
+    PrecompiledInfo *info;
+
+    ui_log(op, "Packaging precompiled kernel interface.");
+
     /* use the uname string as the description */
 
     if (uname(&buf) != 0) {
@@ -1675,29 +2134,33 @@ int pack_precompiled_files(Options *op, Package *p, int num_files,
 
     info = nvalloc(sizeof(PrecompiledInfo));
 
-    outfile = nvstrcat(p->precompiled_kernel_interface_directory, "/",
-                       PRECOMPILED_PACKAGE_FILENAME, "-", p->version,
-                       ".", time_str, NULL);
-
     info->version = nvstrdup(p->version);
     info->proc_version_string = proc_version_string;
     info->description = descr;
     info->num_files = num_files;
     info->files = files;
 
-    ret = precompiled_pack(info, outfile);
+    return write_precompiled_package(op, p, info);
+}
 
-    nvfree(outfile);
-    free_precompiled(info);
 
-    if (ret) {
-        return TRUE;
-    }
-    else {
-        /* XXX precompiled_pack() never fails */
-        ui_error(op, "Unable to package precompiled kernel interface.");
-        return FALSE;
-    }
+
+/*
+ * pack_precompiled_bundle() - Create a new precompiled files package for the
+ * kernels of the given multi-kernel bundle, as returned by
+ * build_multiple_kernel_interfaces().  The bundle is freed.
+ */
+
+int pack_precompiled_bundle(Options *op, Package *p, PrecompiledInfo *bundle)
+{
+    ui_log(op, "Packaging precompiled kernel interfaces for %d kernels.",
+           bundle->num_kernels);
+
+    nvfree(bundle->description);
+    bundle->description = nvasprintf("Precompiled kernel interfaces for %d "
+                                     "kernels", bundle->num_kernels);
+
+    return write_precompiled_package(op, p, bundle);
 }
 
 
@@ -2074,9 +2537,81 @@ void process_dkms_conf(Options *op, Package *p)
 
 }
 
+/*
+ * set_file_selinux_type() - set the type of the SELinux security context
+ * of the file to 'type', like `chcon -t type filename`, by rewriting the
+ * file's security.selinux extended attribute.  Returns TRUE on success;
+ * on failure, returns FALSE with errno set, e.g. if the file is not
+ * labeled or the resulting context is not valid.  This does not use the
+ * ui, so it may be called from any thread.
+ */
+
+#define SELINUX_XATTR "security.selinux"
+
+int set_file_selinux_type(const char *filename, const char *type)
+{
+    char buf[256], *context = buf, *start, *end, *new_context;
+    ssize_t len;
+    int ret = FALSE, err;
+
+    len = getxattr(filename, SELINUX_XATTR, buf, sizeof(buf) - 1);
+
+    if (len < 0 && errno == ERANGE) {
+        len = getxattr(filename, SELINUX_XATTR, NULL, 0);
+        if (len < 0) {
+            return FALSE;
+        }
+        context = nvalloc(len + 1);
+        len = getxattr(filename, SELINUX_XATTR, context, len);
+    }
+
+    if (len <= 0) {
+        if (len == 0) errno = ENODATA;
+        goto done;
+    }
+
+    /* the attribute value may or may not include the terminating NUL */
+
+    context[len] = '\0';
+
+    /* the context is user:role:type[:level]; replace the type */
+
+    start = strchr(context, ':');
+    if (start) start = strchr(start + 1, ':');
+    if (!start) {
+        errno = EINVAL;
+        goto done;
+    }
+
+    start++;
+    end = start + strcspn(start, ":");
+
+    new_context = nvasprintf("%.*s%s%s", (int) (start - context), context,
+                             type, end);
+
+    ret = (setxattr(filename, SELINUX_XATTR, new_context,
+                    strlen(new_context) + 1, 0) == 0);
+
+    nvfree(new_context);
+
+ done:
+
+    if (context != buf) {
+        err = errno;
+        nvfree(context);
+        errno = err;
+    }
+
+    return ret;
+}
+
+
+
 /*
  * set_security_context() - set the security context of the file to 'type'
  * Returns TRUE on success or if SELinux is disabled, FALSE otherwise
+ *
+ * The context is set in-process if possible, and with chcon(1) otherwise.
  */
 int set_security_context(Options *op, const char *filename, const char *type)
 {
@@ -2086,6 +2621,10 @@ int set_security_context(Options *op, const char *filename, const char *type)
     if (op->selinux_enabled == FALSE) {
         return TRUE;
     } 
+
+    if (set_file_selinux_type(filename, type)) {
+        return TRUE;
+    }
     
     cmd = nvstrcat(op->utils[CHCON], " -t ", type, " ", filename, NULL);
     
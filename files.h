@@ -27,6 +27,11 @@ int remove_directory(Options *op, const char *victim);
 int touch_directory(Options *op, const char *victim);
 int copy_file(Options *op, const char *srcfile,
               const char *dstfile, mode_t mode);
+int copy_file_with_crc(Options *op, const char *srcfile,
+                       const char *dstfile, mode_t mode, uint32 *crc,
+                       CopyStrategy *strategy, char **error);
+const char *copy_strategy_name(CopyStrategy strategy);
+int parse_copy_strategy(const char *str, CopyStrategy *strategy);
 char *write_temp_file(Options *op, const int len,
                       const unsigned char *data, mode_t perm);
 int set_destinations(Options *op, Package *p); /* XXX move? */
@@ -51,13 +56,17 @@ char *make_tmpdir(Options *op);
 int nvrename(Options *op, const char *src, const char *dst);
 int check_for_existing_rpms(Options *op);
 int copy_directory_contents(Options *op, const char *src, const char *dst);
+int clone_directory_contents(Options *op, Package *p, const char *src,
+                             const char *dst, int *linked, int *copied);
 int pack_precompiled_files(Options *op, Package *p, int num_files,
                            PrecompiledFileInfo *files);
+int pack_precompiled_bundle(Options *op, Package *p, PrecompiledInfo *bundle);
 
 char *process_template_file(Options *op, PackageEntry *pe,
                             char **tokens, char **replacements);
 void process_dot_desktop_files(Options *op, Package *p);
 void process_dkms_conf(Options *op, Package *p);
+int set_file_selinux_type(const char *filename, const char *type);
 int set_security_context(Options *op, const char *filename, const char *type);
 void get_default_prefixes_and_paths(Options *op);
 void get_compat32_path(Options *op);
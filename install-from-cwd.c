@@ -552,7 +552,9 @@ precompiled_done:
 /*
  * add_this_kernel() - build a precompiled kernel interface for the
  * running kernel, and repackage the .run file to include the new
- * precompiled kernel interface.
+ * precompiled kernel interface.  With --add-kernels, build precompiled
+ * kernel interfaces for each of the given kernels instead, and package
+ * them together as a single multi-kernel bundle.
  */
 
 int add_this_kernel(Options *op)
@@ -568,6 +570,22 @@ int add_this_kernel(Options *op)
 
     if (!check_development_tools(op, p)) goto failed;
 
+    if (op->add_kernels) {
+        PrecompiledInfo *bundle;
+
+        bundle = build_multiple_kernel_interfaces(op, p, op->add_kernels);
+
+        if (!bundle || !pack_precompiled_bundle(op, p, bundle)) {
+            ui_error(op, "Unable to add precompiled kernel interfaces for "
+                     "the kernels '%s'.", op->add_kernels);
+            free_package(p);
+            return FALSE;
+        }
+
+        free_package(p);
+        return TRUE;
+    }
+
     /* find the kernel header files */
 
     if (!determine_kernel_source_path(op, p)) goto failed;
@@ -689,6 +707,90 @@ static int parse_kernel_modules_list(Package *p, char *list) {
 }
 
 
+/*
+ * next_manifest_line() - in-place counterpart of get_next_line() for
+ * the manifest string arena: the line starting at 'buf' is terminated
+ * by overwriting its newline, carriage return or EOF byte with a NUL
+ * terminator, and the line itself is returned.  '*end' is set to the
+ * next printable character following the line, or NULL if the end of
+ * the manifest was reached.  'limit' points at the NUL terminator
+ * appended to the manifest contents.
+ */
+
+static char *next_manifest_line(char *buf, char **end, const char *limit)
+{
+    char *c, *next;
+
+    *end = NULL;
+
+    // Cast all char comparisons to EOF to signed char, as get_next_line()
+    // does, to allow proper sign extension where char is unsigned
+    if (!buf || buf >= limit || *buf == '\0' ||
+        ((signed char)*buf) == EOF) return NULL;
+
+    for (c = buf; c < limit && *c != '\0' && ((signed char)*c) != EOF &&
+                  *c != '\n' && *c != '\r'; c++);
+
+    /* skip the terminator and any other non-printable characters */
+
+    for (next = c; next < limit && *next != '\0' &&
+                   ((signed char)*next) != EOF && !isprint(*next); next++);
+
+    if (next < limit && *next != '\0' && ((signed char)*next) != EOF) {
+        *end = next;
+    }
+
+    *c = '\0';
+
+    return buf;
+
+} /* next_manifest_line() */
+
+
+
+/*
+ * next_manifest_word() - in-place counterpart of read_next_word(): skip
+ * any whitespace in the NUL terminated line 'buf', NUL terminate the
+ * word that follows and return it.  '*e' is set to the character after
+ * the word.  Returns NULL if there are no more words in the line.
+ */
+
+static char *next_manifest_word(char *buf, char **e)
+{
+    char *c = buf;
+    char *start;
+
+    while (*c && isspace(*c)) c++;
+    start = c;
+    while (*c && !isspace(*c)) c++;
+
+    if (c == start) return NULL;
+
+    if (*c) *c++ = '\0';
+
+    *e = c;
+
+    return start;
+
+} /* next_manifest_word() */
+
+
+
+/*
+ * package_owns_string() - return TRUE if the string 's' points into the
+ * package's manifest string arena, and therefore must not be freed on
+ * its own.
+ */
+
+static int package_owns_string(const Package *p, const char *s)
+{
+    return s && p->manifest_strings &&
+           s >= p->manifest_strings &&
+           s < p->manifest_strings + p->manifest_strings_size;
+}
+
+
+
 /*
  * parse_manifest() - open and read the .manifest file in the current
  * directory.
@@ -718,13 +820,22 @@ static int parse_kernel_modules_list(Package *p, char *list) {
  *   - certain file types will have a path
  *   - file types which inherit their paths will have a path depth
  *   - symbolic links will name the target of the link
+ *
+ * The manifest is copied once into a string arena owned by the Package
+ * and tokenized in place: the strings referenced by the header fields
+ * and the package entries all point into the arena, rather than being
+ * allocated individually.  The arena is twice the size of the manifest
+ * so that the paths derived for INHERIT_PATH_DEPTH entries, which are
+ * never longer than the file names they are derived from, can be
+ * carved out of the second half.
  */
 
 static Package *parse_manifest (Options *op)
 {
-    char *buf, *c, *tmpstr;
-    int line;
-    int fd, ret, len = 0;
+    char *buf, *c, *tmpstr, *limit, *derived;
+    int line = 0;
+    int fd, ret;
+    size_t len = 0;
     struct stat stat_buf;
     Package *p;
     char *manifest = MAP_FAILED, *ptr;
@@ -747,32 +858,44 @@ static Package *parse_manifest (Options *op)
 
     manifest = mmap(0, len, PROT_READ, MAP_FILE|MAP_SHARED, fd, 0);
     if (manifest == MAP_FAILED) goto cannot_open;
-    
+
+    /* copy the manifest into the string arena */
+
+    p->manifest_strings_size = 2 * (len + 1);
+    p->manifest_strings = nvalloc(p->manifest_strings_size);
+    memcpy(p->manifest_strings, manifest, len);
+    limit = p->manifest_strings + len;
+    derived = limit + 1;
+
+    munmap(manifest, len);
+    manifest = MAP_FAILED;
+    close(fd);
+    fd = -1;
+
     /* the first line is the description */
 
     line = 1;
-    p->description = get_next_line(manifest, &ptr, manifest, len);
+    p->description = next_manifest_line(p->manifest_strings, &ptr, limit);
     if (!p->description) goto invalid_manifest_file;
     
     /* the second line is the version */
     
     line++;
-    p->version = get_next_line(ptr, &ptr, manifest, len);
+    p->version = next_manifest_line(ptr, &ptr, limit);
     if (!p->version) goto invalid_manifest_file;
     
     /* Ignore the third line */
 
     line++;
-    nvfree(get_next_line(ptr, &ptr, manifest, len));
+    next_manifest_line(ptr, &ptr, limit);
 
     /* the fourth line is the list of kernel modules. */
 
     line++;
-    tmpstr = get_next_line(ptr, &ptr, manifest, len);
-    if (parse_kernel_modules_list(p, tmpstr) == 0) {
+    tmpstr = next_manifest_line(ptr, &ptr, limit);
+    if (!tmpstr || parse_kernel_modules_list(p, tmpstr) == 0) {
         goto invalid_manifest_file;
     }
-    nvfree(tmpstr);
 
     /*
      * set the default value of excluded_kernel_modules to an empty, heap
@@ -787,14 +910,14 @@ static Package *parse_manifest (Options *op)
      */
 
     line++;
-    nvfree(get_next_line(ptr, &ptr, manifest, len));
+    next_manifest_line(ptr, &ptr, limit);
     line++;
-    nvfree(get_next_line(ptr, &ptr, manifest, len));
+    next_manifest_line(ptr, &ptr, limit);
 
     /* the seventh line is the kernel module build directory */
 
     line++;
-    p->kernel_module_build_directory = get_next_line(ptr, &ptr, manifest, len);
+    p->kernel_module_build_directory = next_manifest_line(ptr, &ptr, limit);
     if (!p->kernel_module_build_directory) goto invalid_manifest_file;
     remove_trailing_slashes(p->kernel_module_build_directory);
 
@@ -805,7 +928,7 @@ static Package *parse_manifest (Options *op)
 
     line++;
     p->precompiled_kernel_interface_directory =
-        get_next_line(ptr, &ptr, manifest, len);
+        next_manifest_line(ptr, &ptr, limit);
     if (!p->precompiled_kernel_interface_directory)
         goto invalid_manifest_file;
     remove_trailing_slashes(p->precompiled_kernel_interface_directory);
@@ -814,13 +937,11 @@ static Package *parse_manifest (Options *op)
 
     line++;
     
-    for (; (buf = get_next_line(ptr, &ptr, manifest, len)); line++) {
-        char *flag = NULL;
+    for (; (buf = next_manifest_line(ptr, &ptr, limit)); line++) {
+        char *flag;
         PackageEntry entry;
-        int entry_success = FALSE;
 
         if (buf[0] == '\0') {
-            free(buf);
             break;
         }
 
@@ -830,35 +951,31 @@ static Package *parse_manifest (Options *op)
 
         /* read the file name and permissions */
 
-        c = buf;
-
-        entry.file = read_next_word(buf, &c);
+        entry.file = next_manifest_word(buf, &c);
 
-        if (!entry.file) goto entry_done;
+        if (!entry.file) goto invalid_manifest_file;
 
-        tmpstr = read_next_word(c, &c);
+        tmpstr = next_manifest_word(c, &c);
 
-        if (!tmpstr) goto entry_done;
+        if (!tmpstr) goto invalid_manifest_file;
 
         /* translate the mode string into an octal mode */
 
         ret = mode_string_to_mode(op, tmpstr, &entry.mode);
 
-        free(tmpstr);
-
-        if (!ret) goto entry_done;
+        if (!ret) goto invalid_manifest_file;
 
         /* every file has a type field */
 
         entry.type = FILE_TYPE_NONE;
 
-        flag = read_next_word(c, &c);
-        if (!flag) goto entry_done;
+        flag = next_manifest_word(c, &c);
+        if (!flag) goto invalid_manifest_file;
 
         entry.type = parse_manifest_file_type(flag, &entry.caps);
 
         if (entry.type == FILE_TYPE_NONE) {
-            goto entry_done;
+            goto invalid_manifest_file;
         }
 
         /* Track whether certain file types were packaged */
@@ -881,16 +998,15 @@ static Package *parse_manifest (Options *op)
         entry.compat_arch = FILE_COMPAT_ARCH_NONE;
 
         if (entry.caps.has_arch) {
-            nvfree(flag);
-            flag = read_next_word(c, &c);
-            if (!flag) goto entry_done;
+            flag = next_manifest_word(c, &c);
+            if (!flag) goto invalid_manifest_file;
 
             if (strcmp(flag, "COMPAT32") == 0)
                 entry.compat_arch = FILE_COMPAT_ARCH_COMPAT32;
             else if (strcmp(flag, "NATIVE") == 0)
                 entry.compat_arch = FILE_COMPAT_ARCH_NATIVE;
             else {
-                goto entry_done;
+                goto invalid_manifest_file;
             }
         }
 
@@ -903,42 +1019,43 @@ static Package *parse_manifest (Options *op)
         /* some file types have a path field, or inherit their paths */
 
         if (entry.caps.has_path) {
-            entry.path = read_next_word(c, &c);
+            entry.path = next_manifest_word(c, &c);
             if (!entry.path) goto invalid_manifest_file;
         } else if (entry.caps.inherit_path) {
             int i;
-            char *path, *depth, *slash;
+            char *start, *depth, *slash;
             const char * const depth_marker = "INHERIT_PATH_DEPTH:";
 
-            depth = read_next_word(c, &c);
+            depth = next_manifest_word(c, &c);
             if (!depth ||
                 strncmp(depth, depth_marker, strlen(depth_marker)) != 0) {
                 goto invalid_manifest_file;
             }
             entry.inherit_path_depth = atoi(depth + strlen(depth_marker));
-            nvfree(depth);
 
             /* Remove the file component from the packaged filename */
-            path = entry.path = nvstrdup(entry.file);
-            slash = strrchr(path, '/');
+            slash = strrchr(entry.file, '/');
             if (slash == NULL) {
                 goto invalid_manifest_file;
             }
-            slash[1] = '\0';
 
             /* Strip leading directory components from the path */
+            start = entry.file;
             for (i = 0; i < entry.inherit_path_depth; i++) {
-                slash = strchr(entry.path, '/');
+                start = strchr(start, '/');
 
-                if (slash == NULL) {
+                if (start == NULL || start > slash) {
                     goto invalid_manifest_file;
                 }
 
-                entry.path = slash + 1;
+                start++;
             }
 
-            entry.path = nvstrdup(entry.path);
-            nvfree(path);
+            /* copy the remaining directory, with its trailing slash */
+            entry.path = derived;
+            memcpy(derived, start, slash + 1 - start);
+            derived += slash + 1 - start;
+            *derived++ = '\0';
         } else {
             entry.path = NULL;
         }
@@ -946,7 +1063,7 @@ static Package *parse_manifest (Options *op)
         /* symlinks have a target */
 
         if (entry.caps.is_symlink) {
-            entry.target = read_next_word(c, &c);
+            entry.target = next_manifest_word(c, &c);
             if (!entry.target) goto invalid_manifest_file;
         } else {
             entry.target = NULL;
@@ -972,17 +1089,6 @@ static Package *parse_manifest (Options *op)
                           entry.type,
                           entry.compat_arch,
                           entry.mode);
-
-        entry_success = TRUE;
-
- entry_done:
-        /* clean up */
-
-        nvfree(buf);
-        nvfree(flag);
-        if (!entry_success) {
-            goto invalid_manifest_file;
-        }
     }
 
     /* If no OpenGL files were packaged, we can't install them. Set the
@@ -993,9 +1099,6 @@ static Package *parse_manifest (Options *op)
         op->no_opengl_files = TRUE;
     }
 
-    munmap(manifest, len);
-    if (fd != -1) close(fd);
-
     return p;
     
  cannot_open:
@@ -1020,7 +1123,8 @@ static Package *parse_manifest (Options *op)
 
 /*
  * add_package_entry() - add a PackageEntry to the package's entries
- * array.
+ * array.  The array grows geometrically, so that adding n entries costs
+ * O(log n) reallocations rather than n.
  */
 
 void add_package_entry(Package *p,
@@ -1038,8 +1142,11 @@ void add_package_entry(Package *p,
 
     n = p->num_entries;
 
-    p->entries =
-        (PackageEntry *) nvrealloc(p->entries, (n + 1) * sizeof(PackageEntry));
+    if (n >= p->max_entries) {
+        p->max_entries = p->max_entries ? p->max_entries * 2 : 64;
+        p->entries = (PackageEntry *)
+            nvrealloc(p->entries, p->max_entries * sizeof(PackageEntry));
+    }
 
     memset(&p->entries[n], 0, sizeof(PackageEntry));
 
@@ -1077,12 +1184,23 @@ static void free_package(Package *p)
 
     if (!p) return;
     
-    nvfree(p->description);
-    nvfree(p->version);
-    
-    nvfree(p->kernel_module_build_directory);
+    /*
+     * The header strings normally point into the manifest string arena,
+     * which is freed below along with the entries' strings.
+     */
 
-    nvfree(p->precompiled_kernel_interface_directory);
+    if (!package_owns_string(p, p->description)) {
+        nvfree(p->description);
+    }
+    if (!package_owns_string(p, p->version)) {
+        nvfree(p->version);
+    }
+    if (!package_owns_string(p, p->kernel_module_build_directory)) {
+        nvfree(p->kernel_module_build_directory);
+    }
+    if (!package_owns_string(p, p->precompiled_kernel_interface_directory)) {
+        nvfree(p->precompiled_kernel_interface_directory);
+    }
 
     for (i = 0; i < p->num_kernel_modules; i++) {
         free_kernel_module_info(p->kernel_modules[i]);
@@ -1092,9 +1210,15 @@ static void free_package(Package *p)
     nvfree(p->excluded_kernel_modules);
 
     for (i = 0; i < p->num_entries; i++) {
-        nvfree(p->entries[i].file);
-        nvfree(p->entries[i].path);
-        nvfree(p->entries[i].target);
+        if (!package_owns_string(p, p->entries[i].file)) {
+            nvfree(p->entries[i].file);
+        }
+        if (!package_owns_string(p, p->entries[i].path)) {
+            nvfree(p->entries[i].path);
+        }
+        if (!package_owns_string(p, p->entries[i].target)) {
+            nvfree(p->entries[i].target);
+        }
         nvfree(p->entries[i].dst);
 
         /*
@@ -1105,6 +1229,8 @@ static void free_package(Package *p)
 
     nvfree((char *) p->entries);
 
+    nvfree(p->manifest_strings);
+
     nvfree((char *) p);
     
 } /* free_package() */
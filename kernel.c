@@ -17,12 +17,15 @@
  * along with this program; if not, see <http://www.gnu.org/licenses>.
  */
 
+#define _GNU_SOURCE /* needed for memmem */
+
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
 #include <sys/utsname.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <sys/sysctl.h>
 #include <ctype.h>
 #include <stdlib.h>
@@ -33,6 +36,9 @@
 #include <limits.h>
 #include <fts.h>
 #include <syscall.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
 
 #include "nvidia-installer.h"
 #include "kernel.h"
@@ -63,11 +69,16 @@ static int run_conftest(Options *op, const char *dir, const char *args,
                         char **result);
 static int run_make(Options *op, Package *p, const char *dir, const char *target,
                     char **vars, const char *status, int lines);
+static char *make_command(Options *op, Package *p, const char *flags,
+                          const char *target, char **vars);
 static void load_kernel_module_quiet(Options *op, const char *module_name);
 static void modprobe_remove_kernel_module_quiet(Options *op, const char *name);
 static int kernel_configuration_conflict(Options *op, Package *p,
                                          int target_system_checks);
-static int check_cc_version(Options *op, Package *p);
+static int report_cc_version_check(Options *op, int ret, const char *result);
+static int report_sanity_check(Options *op, const char *sanity_check_name,
+                               int ret, const char *result);
+static int check_kernel_source_path(Options *op);
 
 /*
  * Message text that is used by several error messages.
@@ -150,858 +161,2424 @@ int determine_kernel_module_installation_path(Options *op)
 
 
 /*
- * run_conftest() - run conftest.sh with the given additional arguments; pass
- * the result back to the caller. Returns TRUE on success, or FALSE on failure.
+ * conftest result cache: with --conftest-cache, the result of each
+ * conftest run against a configured kernel is saved to CONFTEST_CACHE,
+ * keyed by a fingerprint of the build (the kernel source and output
+ * paths, the CRC of the kernel's .config and the identity of a few of
+ * its generated headers, the compiler, the CRC of the driver's
+ * conftest.sh and the architecture) together with the conftest
+ * arguments.  A later run with the same fingerprint reuses the saved
+ * exit status and output instead of running conftest.sh again.
  */
 
-static int run_conftest(Options *op, const char *dir, const char *args,
-                        char **result)
-{
-    char *cmd, *arch, *kernel_source_path, *kernel_output_path;
-    int ret;
+#define CONFTEST_CACHE (NVIDIA_INSTALLER_CACHE_DIRECTORY "/conftest")
+#define CONFTEST_CACHE_MAGIC   "NVCTCCH"
+#define CONFTEST_CACHE_VERSION 1
 
-    if (result) {
-        *result = NULL;
-    }
+/* the oldest entries are dropped once the cache holds this many */
 
-    arch = get_machine_arch(op);
-    if (!arch) {
-        return FALSE;
-    }
+#define CONFTEST_CACHE_MAX_ENTRIES 1024
 
-    /* Some conftests don't require kernel source/output paths;
-     * if run_conftest() is run early enough, these may not be
-     * set yet, so use a placeholder string instead of NULL to
-     * prevent premature termination of nvstrcat() below. */
-    kernel_source_path = kernel_output_path = "DIRECTORY_PLACEHOLDER";
-    if (op->kernel_source_path) {
-        kernel_source_path = op->kernel_source_path;
-    }
-    if (op->kernel_output_path) {
-        kernel_output_path = op->kernel_output_path;
-    }
+/*
+ * cache file layout: a ConftestCacheHeader, then for each entry a
+ * ConftestCacheRecord, followed by the NUL-terminated key (key_length
+ * bytes) and the NUL-terminated conftest output (output_length bytes);
+ * entries are in the order they were added, and all values are in host
+ * byte order
+ */
 
-    cmd = nvstrcat("sh \"", dir, "/conftest.sh\" \"",
-                   op->utils[CC], "\" \"",
-                   arch, "\" \"",
-                   kernel_source_path, "\" \"",
-                   kernel_output_path, "\" ",
-                   args, NULL);
+typedef struct {
+    char   magic[8];
+    uint32 version;
+    uint32 num_entries;
+} ConftestCacheHeader;
+
+typedef struct {
+    uint32 key_length;
+    uint32 output_length;
+    uint32 success;
+} ConftestCacheRecord;
+
+typedef struct {
+    char *key;
+    char *output;
+    int success;
+} ConftestCacheEntry;
 
-    ret = run_command(op, cmd, result, FALSE, 0, TRUE);
-    nvfree(cmd);
+static struct {
+    int loaded;
+    int num_entries;
+    ConftestCacheEntry *entries;
+} conftest_cache;
 
-    return ret == 0;
-} /* run_conftest() */
+/*
+ * a conftest run in the background by run_conftests(): the caller fills in
+ * dir, args and fatal, and gets the result in ret and output
+ */
+
+typedef enum {
+    CONFTEST_JOB_PENDING = 0,
+    CONFTEST_JOB_RUNNING,
+    CONFTEST_JOB_DONE,
+} ConftestJobState;
+
+typedef struct {
+    const char *dir;
+    const char *args;
+    int fatal;          /* a failure cancels the jobs that follow */
+
+    int ret;            /* TRUE if the conftest succeeded */
+    char *output;
+
+    ConftestJobState state;
+    int cancelled;
+    char *key;
+    pid_t pid;
+    int fd;
+    int output_len;
+    int output_size;
+} ConftestJob;
 
 
 
 /*
- * determine_kernel_source_path() - find the qualified path to the
- * kernel source tree.  This is called from install_from_cwd() if we
- * need to compile the kernel interface files.  Assigns
- * op->kernel_source_path and returns TRUE if successful.  Returns
- * FALSE if no kernel source tree was found.
+ * append_file_identity() - append the device, inode, size and
+ * modification time of the given file to the fingerprint string,
+ * following symbolic links; a missing file is recorded as such.
  */
 
-int determine_kernel_source_path(Options *op, Package *p)
+static char *append_file_identity(char *fingerprint, const char *filename)
 {
-    char *result;
-    char *version_h, *uapi_version_h;
-    int ret, count = 0;
-    
-    /* determine the kernel source path */
-    
-    op->kernel_source_path = default_kernel_source_path(op);
-    
-    if (op->expert) {
-        
-    ask_for_kernel_source_path:
-        
-        result = ui_get_input(op, op->kernel_source_path,
-                              "Kernel source path");
-        if (result && result[0]) {
-            if (!directory_exists(result)) {
-                ui_warn(op, "Kernel source path '%s' does not exist.",
-                        result);
-                free(result);
-                
-                if (++count < NUM_TIMES_QUESTIONS_ASKED) {
-                    goto ask_for_kernel_source_path;
-                } else {
-                    op->kernel_source_path = NULL;
-                }
-            } else {
-                op->kernel_source_path = result;
-            }
-        } else {
-            ui_warn(op, "Invalid kernel source path.");
-            if (result) free(result);
-            
-            if (++count < NUM_TIMES_QUESTIONS_ASKED) {
-                goto ask_for_kernel_source_path;
-            } else {
-                op->kernel_source_path = NULL;
-            }
-        }
+    struct stat stat_buf;
+    char *identity, *ret;
+
+    if (stat(filename, &stat_buf) == 0) {
+        identity = nvasprintf("%s %llu %llu %lld %lld.%09ld\n", filename,
+                              (unsigned long long) stat_buf.st_dev,
+                              (unsigned long long) stat_buf.st_ino,
+                              (long long) stat_buf.st_size,
+                              (long long) stat_buf.st_mtim.tv_sec,
+                              stat_buf.st_mtim.tv_nsec);
+    } else {
+        identity = nvstrcat(filename, " -\n", NULL);
     }
 
-    /* if we STILL don't have a kernel source path, give up */
-    
-    if (!op->kernel_source_path) {
-        ui_error(op, "Unable to find the kernel source tree for the "
-                 "currently running kernel.  %s", install_your_kernel_source);
-        
-        /*
-         * I suppose we could ask them here for the kernel source
-         * path, but we've already given users multiple methods of
-         * specifying their kernel source tree.
-         */
-        
-        return FALSE;
-    }
+    ret = nvstrcat(fingerprint, identity, NULL);
+    nvfree(identity);
+    nvfree(fingerprint);
 
-    /* reject /usr as an invalid kernel source path */
+    return ret;
+}
 
-    if (!strcmp(op->kernel_source_path, "/usr") ||
-            !strcmp(op->kernel_source_path, "/usr/")) {
-        ui_error (op, "The kernel source path '%s' is invalid.  %s",
-                  op->kernel_source_path, install_your_kernel_source);
-        op->kernel_source_path = NULL;
-        return FALSE;
-    }
 
-    /* check that the kernel source path exists */
 
-    if (!directory_exists(op->kernel_source_path)) {
-        ui_error (op, "The kernel source path '%s' does not exist.  %s",
-                  op->kernel_source_path, install_your_kernel_source);
-        op->kernel_source_path = NULL;
-        return FALSE;
+/*
+ * environment variables read by conftest.sh to override the result of a
+ * conftest; their values are part of the cache key of that conftest
+ */
+
+static const struct {
+    const char *test;
+    const char *variable;
+} conftest_overrides[] = {
+    { "cc_version_check", "IGNORE_CC_MISMATCH" },
+    { "xen_sanity_check", "IGNORE_XEN_PRESENCE" },
+    { "preempt_rt_sanity_check", "IGNORE_PREEMPT_RT_PRESENCE" },
+};
+
+
+/*
+ * conftest_args_match() - whether the conftest.sh arguments args run the
+ * given test.
+ */
+
+static int conftest_args_match(const char *args, const char *test)
+{
+    size_t len = strlen(test);
+
+    return strncmp(args, test, len) == 0 &&
+           (args[len] == '\0' || args[len] == ' ');
+}
+
+
+/*
+ * conftest_cache_key() - build the conftest cache key for running
+ * conftest.sh from dir with the given arguments, without running any
+ * commands.  Returns NULL if the result should not be cached: the
+ * kernel source and output paths must be known and the kernel must be
+ * configured.
+ */
+
+static char *conftest_cache_key(Options *op, const char *dir,
+                                const char *arch, const char *args)
+{
+    char *key, *filename, *cc, *word, *path;
+    uint32 config_crc, conftest_crc;
+    int ok, i;
+
+    if (!op->kernel_source_path || !op->kernel_output_path) {
+        return NULL;
     }
 
-    /* check that <path>/include/linux/kernel.h exists */
+    filename = nvstrcat(op->kernel_output_path, "/.config", NULL);
+    ok = try_compute_crc(filename, &config_crc);
+    nvfree(filename);
+    if (!ok) {
+        return NULL;
+    }
 
-    result = nvstrcat(op->kernel_source_path, "/include/linux/kernel.h", NULL);
-    if (access(result, F_OK) == -1) {
-        ui_error(op, "The kernel header file '%s' does not exist.  "
-                 "The most likely reason for this is that the kernel source "
-                 "path '%s' is incorrect.  %s", result,
-                 op->kernel_source_path, install_your_kernel_source);
-        free(result);
-        return FALSE;
+    filename = nvstrcat(dir, "/conftest.sh", NULL);
+    ok = try_compute_crc(filename, &conftest_crc);
+    nvfree(filename);
+    if (!ok) {
+        return NULL;
     }
-    free(result);
 
-    if (!determine_kernel_output_path(op)) return FALSE;
+    key = nvasprintf("%s\n%s\n%08x\n%08x\n%s\n%s\n%s\n",
+                     op->kernel_source_path, op->kernel_output_path,
+                     config_crc, conftest_crc, arch, op->utils[CC], args);
 
-    /* check to make sure that either include/linux/version.h or
-     * include/generated/uapi/linux/version.h is present in the output dir */
+    filename = nvstrcat(op->kernel_source_path, "/Makefile", NULL);
+    key = append_file_identity(key, filename);
+    nvfree(filename);
 
-#define VERSION_H_PATH "/include/linux/version.h"
-#define UAPI_VERSION_H_PATH "/include/generated/uapi/linux/version.h"
+    filename = nvstrcat(op->kernel_output_path,
+                        "/include/generated/autoconf.h", NULL);
+    key = append_file_identity(key, filename);
+    nvfree(filename);
 
-    version_h = nvstrcat(op->kernel_output_path, VERSION_H_PATH, NULL);
-    uapi_version_h = nvstrcat(op->kernel_output_path, UAPI_VERSION_H_PATH,
-                              NULL);
+    filename = nvstrcat(op->kernel_output_path,
+                        "/include/generated/utsrelease.h", NULL);
+    key = append_file_identity(key, filename);
+    nvfree(filename);
 
-    ret = access(version_h, F_OK) == 0 || access(uapi_version_h, F_OK) == 0;
+    /*
+     * identify the compiler by the executables named in CC (e.g.,
+     * "ccache gcc"), so that upgrading the compiler invalidates the
+     * cached results
+     */
 
-    free(version_h);
-    free(uapi_version_h);
+    cc = nvstrdup(op->utils[CC]);
 
-    if (!ret) {
-        ui_error(op, "Neither the '" VERSION_H_PATH "' nor the '"
-                 UAPI_VERSION_H_PATH "' kernel header file exists.  "
-                 "The most likely reason for this is that the kernel "
-                 "source files in '%s' have not been configured.",
-                 op->kernel_output_path);
-        return FALSE;
+    for (word = strtok(cc, " \t"); word; word = strtok(NULL, " \t")) {
+        if (word[0] == '-') continue;
+
+        path = strchr(word, '/') ? nvstrdup(word) : find_system_util(word);
+        if (path) {
+            key = append_file_identity(key, path);
+            nvfree(path);
+        }
     }
 
-    /* OK, we seem to have a path to a configured kernel source tree */
-    
-    ui_log(op, "Kernel source path: '%s'\n", op->kernel_source_path);
-    ui_log(op, "Kernel output path: '%s'\n", op->kernel_output_path);
-    
-    return TRUE;
-    
-} /* determine_kernel_source_path() */
+    nvfree(cc);
 
+    /*
+     * some checks can be overridden by setting a variable in the
+     * environment (e.g., as their failure messages suggest)
+     */
 
-/*
- * determine_kernel_output_path() - determine the kernel output
- * path; unless specified, the kernel output path is assumed to be
- * the same as the kernel source path.
- */
+    for (i = 0; i < ARRAY_LEN(conftest_overrides); i++) {
+        const char *value;
+        char *tmp;
 
-int determine_kernel_output_path(Options *op)
-{
-    char *str, *tmp;
-    int len;
+        if (!conftest_args_match(args, conftest_overrides[i].test)) continue;
 
-    /* check --kernel-output-path */
+        value = getenv(conftest_overrides[i].variable);
+        tmp = nvasprintf("%s%s=%s\n", key, conftest_overrides[i].variable,
+                         value ? value : "");
+        nvfree(key);
+        key = tmp;
+    }
 
-    if (op->kernel_output_path) {
-        ui_log(op, "Using the kernel output path '%s' as specified by the "
-               "'--kernel-output-path' commandline option.",
-               op->kernel_output_path);
+    /*
+     * cc_version_check also depends on the compiler that built the running
+     * kernel, which conftest.sh reads from /proc/version
+     */
 
-        if (!directory_exists(op->kernel_output_path)) {
-            ui_error(op, "The kernel output path '%s' does not exist.",
-                     op->kernel_output_path);
-            op->kernel_output_path = NULL;
-            return FALSE;
+    if (conftest_args_match(args, "cc_version_check")) {
+        char *proc_version = NULL, *tmp;
+
+        if (!read_text_file("/proc/version", &proc_version)) {
+            proc_version = NULL;
         }
 
-        return TRUE;
+        tmp = nvstrcat(key, proc_version ? proc_version : "-\n", NULL);
+        nvfree(proc_version);
+        nvfree(key);
+        key = tmp;
     }
 
-    /* check SYSOUT */
+    return key;
+}
 
-    str = getenv("SYSOUT");
-    if (str) {
-        ui_log(op, "Using the kernel output path '%s', as specified by the "
-               "SYSOUT environment variable.", str);
-        op->kernel_output_path = str;
 
-        if (!directory_exists(op->kernel_output_path)) {
-            ui_error(op, "The kernel output path '%s' does not exist.",
-                     op->kernel_output_path);
-            op->kernel_output_path = NULL;
-            return FALSE;
+
+/*
+ * load_conftest_cache() - read CONFTEST_CACHE into conftest_cache; a
+ * missing, invalid or insecure cache file is ignored.
+ */
+
+static void load_conftest_cache(void)
+{
+    ConftestCacheHeader header;
+    ConftestCacheRecord record;
+    ConftestCacheEntry *entries = NULL;
+    struct stat stat_buf;
+    uint32 i;
+    FILE *f;
+
+    conftest_cache.loaded = TRUE;
+
+    f = fopen(CONFTEST_CACHE, "r");
+    if (!f) return;
+
+    if (fstat(fileno(f), &stat_buf) == -1 ||
+        stat_buf.st_uid != geteuid() ||
+        (stat_buf.st_mode & (S_IWGRP | S_IWOTH)) ||
+        fread(&header, sizeof(header), 1, f) != 1 ||
+        memcmp(header.magic, CONFTEST_CACHE_MAGIC,
+               sizeof(header.magic)) != 0 ||
+        header.version != CONFTEST_CACHE_VERSION ||
+        header.num_entries > CONFTEST_CACHE_MAX_ENTRIES) {
+        goto fail;
+    }
+
+    entries = nvalloc(sizeof(ConftestCacheEntry) * header.num_entries);
+
+    for (i = 0; i < header.num_entries; i++) {
+        if (fread(&record, sizeof(record), 1, f) != 1 ||
+            record.key_length == 0 || record.output_length == 0 ||
+            record.key_length > stat_buf.st_size ||
+            record.output_length > stat_buf.st_size) {
+            goto fail;
         }
 
-        return TRUE;
+        entries[i].key = nvalloc(record.key_length);
+        entries[i].output = nvalloc(record.output_length);
+        entries[i].success = record.success != 0;
+
+        if (fread(entries[i].key, record.key_length, 1, f) != 1 ||
+            fread(entries[i].output, record.output_length, 1, f) != 1 ||
+            entries[i].key[record.key_length - 1] != '\0' ||
+            entries[i].output[record.output_length - 1] != '\0') {
+            i++;
+            goto fail;
+        }
     }
 
-    /* check /lib/modules/`uname -r`/{source,build} */
+    fclose(f);
 
-    tmp = get_kernel_name(op);
+    conftest_cache.entries = entries;
+    conftest_cache.num_entries = header.num_entries;
 
-    if (tmp) {
-        str = nvstrcat("/lib/modules/", tmp, "/source", NULL);
-        len = strlen(str);
+    return;
 
-        if (!strncmp(op->kernel_source_path, str, len)) {
-            nvfree(str);
-            str = nvstrcat("/lib/modules/", tmp, "/build", NULL);
+ fail:
 
-            if (directory_exists(str)) {
-                op->kernel_output_path = str;
-                return TRUE;
-            }
-        }
+    if (entries) {
+        uint32 j;
 
-        nvfree(str);
+        for (j = 0; j < i; j++) {
+            nvfree(entries[j].key);
+            nvfree(entries[j].output);
+        }
+        nvfree(entries);
     }
 
-    op->kernel_output_path = op->kernel_source_path;
-    return TRUE;
+    fclose(f);
 }
 
 
+
 /*
- * attach_signature() - If we have a detached signature, verify the checksum of
- * the linked module and append the signature.
+ * save_conftest_cache() - write conftest_cache to CONFTEST_CACHE.
+ * Failure to write the cache is not fatal.
  */
-static int attach_signature(Options *op, Package *p,
-                            const PrecompiledFileInfo *fileInfo,
-                            const char *module_name) {
-    uint32 actual_crc;
-    char *module_path;
-    int ret = FALSE, command_ret;
 
-    const char *choices[2] = {
-        "Install unsigned kernel module",
-        "Abort installation"
-    };
+static void save_conftest_cache(Options *op)
+{
+    ConftestCacheHeader header;
+    char *tmpname;
+    mode_t orig_mode;
+    FILE *f;
+    int i, ok;
+
+    if (!directory_exists(NVIDIA_INSTALLER_CACHE_DIRECTORY) &&
+        !mkdir_recursive(op, NVIDIA_INSTALLER_CACHE_DIRECTORY, 0755, FALSE)) {
+        return;
+    }
 
-    ui_log(op, "Attaching module signature to linked kernel module.");
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CONFTEST_CACHE_MAGIC, sizeof(header.magic));
+    header.version = CONFTEST_CACHE_VERSION;
+    header.num_entries = conftest_cache.num_entries;
 
-    module_path = nvstrcat(p->kernel_module_build_directory, "/",
-                           fileInfo->target_directory, "/", module_name, NULL);
+    tmpname = nvstrcat(CONFTEST_CACHE, ".tmp", NULL);
 
-    command_ret = verify_crc(op, module_path, fileInfo->linked_module_crc,
-                             &actual_crc);
+    orig_mode = umask(022);
+    f = fopen(tmpname, "w");
+    umask(orig_mode);
 
-    if (command_ret) {
-        FILE *module_file;
+    if (!f) {
+        ui_log(op, "Unable to write the conftest cache '%s' (%s).",
+               tmpname, strerror(errno));
+        nvfree(tmpname);
+        return;
+    }
 
-        module_file = fopen(module_path, "a+");
+    ok = fwrite(&header, sizeof(header), 1, f) == 1;
 
-        if (module_file && fileInfo->signature_size) {
-            command_ret = fwrite(fileInfo->signature, 1,
-                                 fileInfo->signature_size, module_file);
-            if (command_ret == fileInfo->signature_size) {
-                op->kernel_module_signed = ret = !ferror(module_file);
-            }
-        } else {
-            ret = (ui_multiple_choice(op, choices, 2, 1,
-                                      "A detached signature was included with "
-                                      "the precompiled interface, but opening "
-                                      "the linked kernel module and/or the "
-                                      "signature file failed.\n\nThe detached "
-                                      "signature will not be added; would you "
-                                      "still like to install the unsigned "
-                                      "kernel module?") == 0);
-        }
+    for (i = 0; ok && i < conftest_cache.num_entries; i++) {
+        const ConftestCacheEntry *entry = &conftest_cache.entries[i];
+        ConftestCacheRecord record;
 
-        if (module_file) {
-            fclose(module_file);
-        }
-    } else {
-        ret = (ui_multiple_choice(op, choices, 2, 1,
-                                  "A detached signature was included with the "
-                                  "precompiled interface, but the checksum of "
-                                  "the linked kernel module (%d) did not match "
-                                  "the checksum of the the kernel module for "
-                                  "which the detached signature was generated "
-                                  "(%d).\n\nThis can happen if the linker on "
-                                  "the installation target system is not the "
-                                  "same as the linker on the system that built "
-                                  "the precompiled interface.\n\nThe detached "
-                                  "signature will not be added; would you "
-                                  "still like to install the unsigned kernel "
-                                  "module?", actual_crc,
-                                  fileInfo->linked_module_crc) == 0);
+        record.key_length = strlen(entry->key) + 1;
+        record.output_length = strlen(entry->output) + 1;
+        record.success = entry->success;
+
+        ok = fwrite(&record, sizeof(record), 1, f) == 1 &&
+             fwrite(entry->key, record.key_length, 1, f) == 1 &&
+             fwrite(entry->output, record.output_length, 1, f) == 1;
     }
 
-    if (ret) {
-        if(op->kernel_module_signed) {
-            ui_log(op, "Signature attached successfully.");
-        } else {
-            ui_log(op, "Signature not attached.");
-        }
-    } else {
-        ui_error(op, "Failed to attach signature.");
+    if (fclose(f) != 0 || !ok || rename(tmpname, CONFTEST_CACHE) != 0) {
+        ui_log(op, "Unable to write the conftest cache '%s'.",
+               CONFTEST_CACHE);
+        unlink(tmpname);
     }
 
-    nvfree(module_path);
-    return ret;
-} /* attach_signature() */
+    nvfree(tmpname);
+}
+
 
 
 /*
- * unpack_kernel_modules() - unpack the precompiled file bundle, and link any
- * prebuilt kernel interface against their respective binary-only core object
- * files. This results in a complete kernel module, ready for installation.
- *
- * e.g.: ld -r -o nvidia.ko nv-linux.o nvidia/nv-kernel.o_binary
- *
- * If the precompiled file is a complete kernel module instead of an interface
- * file, no additional action is needed after unpacking.
+ * find_conftest_cache_entry() - return the cached result for the given
+ * key, or NULL if there is none.
  */
 
-int unpack_kernel_modules(Options *op, Package *p, const char *build_directory,
-                          const PrecompiledFileInfo *fileInfo)
+static const ConftestCacheEntry *find_conftest_cache_entry(const char *key)
 {
-    char *cmd;
-    int ret;
-    uint32 attrmask;
+    int i;
 
-    if (fileInfo->type != PRECOMPILED_FILE_TYPE_INTERFACE &&
-        fileInfo->type != PRECOMPILED_FILE_TYPE_MODULE) {
-        ui_error(op, "The file does not appear to be a valid precompiled "
-                 "kernel interface or module.");
-        return FALSE;
+    if (!conftest_cache.loaded) {
+        load_conftest_cache();
     }
 
-    ret = precompiled_file_unpack(op, fileInfo, build_directory);
-    if (!ret) {
-        ui_error(op, "Failed to unpack the precompiled file.");
-        return FALSE;
-    } else if (fileInfo->type == PRECOMPILED_FILE_TYPE_MODULE) {
-        ui_log(op, "Kernel module unpacked successfully.");
-        return TRUE;
+    for (i = conftest_cache.num_entries - 1; i >= 0; i--) {
+        if (strcmp(conftest_cache.entries[i].key, key) == 0) {
+            return &conftest_cache.entries[i];
+        }
     }
 
-    cmd = nvstrcat("cd ", build_directory,
-                   "; ", op->utils[LD], " ", LD_OPTIONS, " -o ",
-                   fileInfo->linked_module_name, " ",
-                   fileInfo->target_directory, "/", fileInfo->name, " ",
-                   fileInfo->target_directory, "/", fileInfo->core_object_name,
-                   NULL);
+    return NULL;
+}
 
-    ret = run_command(op, cmd, NULL, TRUE, 0, TRUE);
 
-    free(cmd);
 
-    if (ret != 0) {
-        ui_error(op, "Unable to link kernel module.");
-        return FALSE;
+/*
+ * add_conftest_cache_entry() - add a conftest result to the cache,
+ * dropping the oldest entry if the cache is full, and save the cache.
+ */
+
+static void add_conftest_cache_entry(Options *op, const char *key,
+                                     const char *output, int success)
+{
+    ConftestCacheEntry *entry;
+
+    if (conftest_cache.num_entries == CONFTEST_CACHE_MAX_ENTRIES) {
+        nvfree(conftest_cache.entries[0].key);
+        nvfree(conftest_cache.entries[0].output);
+        memmove(&conftest_cache.entries[0], &conftest_cache.entries[1],
+                sizeof(ConftestCacheEntry) * (conftest_cache.num_entries - 1));
+        conftest_cache.num_entries--;
     }
 
-    ui_log(op, "Kernel module linked successfully.");
+    conftest_cache.entries =
+        nvrealloc(conftest_cache.entries, sizeof(ConftestCacheEntry) *
+                                          (conftest_cache.num_entries + 1));
 
-    attrmask = PRECOMPILED_ATTR(DETACHED_SIGNATURE) |
-               PRECOMPILED_ATTR(LINKED_MODULE_CRC);
+    entry = &conftest_cache.entries[conftest_cache.num_entries++];
+    entry->key = nvstrdup(key);
+    entry->output = nvstrdup(output ? output : "");
+    entry->success = success;
 
-    if ((fileInfo->attributes & attrmask) == attrmask) {
-        return attach_signature(op, p, fileInfo,
-                                fileInfo->linked_module_name);
+    save_conftest_cache(op);
+}
+
+
+
+/*
+ * conftest_argv() - build the argument vector for running conftest.sh from
+ * dir with the given additional, space-separated, arguments.  The vector
+ * should be freed with free_conftest_argv().
+ */
+
+static char **conftest_argv(Options *op, const char *dir, const char *arch,
+                            const char *args)
+{
+    char **argv, *words, *word;
+    int n = 0;
+
+    argv = nvalloc(sizeof(char *) * (7 + strlen(args) / 2 + 1));
+
+    argv[n++] = nvstrdup("sh");
+    argv[n++] = nvstrcat(dir, "/conftest.sh", NULL);
+    argv[n++] = nvstrdup(op->utils[CC]);
+    argv[n++] = nvstrdup(arch);
+
+    /* Some conftests don't require kernel source/output paths;
+     * if run_conftest() is run early enough, these may not be
+     * set yet, so use a placeholder string instead of NULL. */
+    argv[n++] = nvstrdup(op->kernel_source_path ? op->kernel_source_path :
+                         "DIRECTORY_PLACEHOLDER");
+    argv[n++] = nvstrdup(op->kernel_output_path ? op->kernel_output_path :
+                         "DIRECTORY_PLACEHOLDER");
+
+    words = nvstrdup(args);
+    for (word = strtok(words, " "); word; word = strtok(NULL, " ")) {
+        argv[n++] = nvstrdup(word);
     }
+    nvfree(words);
 
-    return TRUE;
-   
+    return argv;
 }
 
 
-static int check_file(Options *op, Package *p, const char *dir,
-                      const char *modname)
+static void free_conftest_argv(char **argv)
 {
-    int ret;
-    char *path;
+    int i;
 
-    path = nvstrcat(dir, "/", modname, ".ko", NULL);
-    ret = access(path, F_OK);
+    for (i = 0; argv[i]; i++) {
+        nvfree(argv[i]);
+    }
+    nvfree(argv);
+}
 
-    if (ret == -1) {
-        char *single_module_list = nvstrcat("NV_KERNEL_MODULES=\"", modname,
-                                            "\"", NULL);
-        char *rebuild_msg = nvstrcat("Checking to see whether the ", modname,
-                                     " kernel module was successfully built",
-                                     NULL);
-        /* Attempt to rebuild the individual module, in case the failure
-         * is module-specific and due to a different module */
-        run_make(op, p, dir, single_module_list, NULL, rebuild_msg, 25);
-        nvfree(single_module_list);
-        nvfree(rebuild_msg);
 
-        /* Check the file again */
-        ret = access(path, F_OK);
+
+/*
+ * lookup_conftest_cache() - with --conftest-cache, return the cached
+ * result of the given conftest, or NULL if there is none.  The cache key,
+ * if the result may be cached, is returned in key.
+ */
+
+static const ConftestCacheEntry *lookup_conftest_cache(Options *op,
+                                                       const char *dir,
+                                                       const char *arch,
+                                                       const char *args,
+                                                       char **key)
+{
+    const ConftestCacheEntry *entry;
+
+    *key = NULL;
+
+    if (!op->conftest_cache) {
+        return NULL;
     }
 
-    nvfree(path);
+    *key = conftest_cache_key(op, dir, arch, args);
+    if (!*key) {
+        return NULL;
+    }
 
-    if (ret == -1) {
-        ui_error(op, "The %s kernel module was not created.", modname);
+    entry = find_conftest_cache_entry(*key);
+    if (entry) {
+        ui_log(op, "Using the cached result of conftest '%s'.", args);
     }
 
-    return ret != -1;
+    return entry;
 }
 
 
 
 /*
- * Build the kernel modules that part of this package.
+ * record_conftest_result() - add the result of a conftest to the cache,
+ * if it may be cached; only the results of conftests that ran to
+ * completion are cached.
  */
 
-int build_kernel_modules(Options *op, Package *p)
+static void record_conftest_result(Options *op, const char *key, int status,
+                                   const char *output)
 {
-    return build_kernel_interfaces(op, p, NULL);
+    if (key && status != -1 && WIFEXITED(status)) {
+        add_conftest_cache_entry(op, key, output, status == 0);
+    }
 }
 
 
+
 /*
- * Run the module_signing_script with three or four arguments.
- * Return TRUE on success.
+ * run_conftest() - run conftest.sh with the given additional arguments; pass
+ * the result back to the caller. Returns TRUE on success, or FALSE on failure.
+ * With --conftest-cache, a cached result is used if there is one.
  */
-static int try_sign_file(Options *op, const char *file, int num_args)
+
+static int run_conftest(Options *op, const char *dir, const char *args,
+                        char **result)
 {
-    char *cmd;
-    const char *arg_1;
+    const ConftestCacheEntry *entry;
+    char **argv, *arch, *output = NULL, *key;
     int ret;
 
-    switch (num_args) {
-        case 3: arg_1 = ""; break;
-        case 4: arg_1 = op->module_signing_hash; break;
-        default: return FALSE;
+    if (result) {
+        *result = NULL;
     }
 
-    cmd = nvstrcat("\"", op->module_signing_script, "\" ",
-                   arg_1, " \"",
-                   op->module_signing_secret_key, "\" \"",
-                   op->module_signing_public_key, "\" \"",
-                   file, "\"", NULL);
-    ret = run_command(op, cmd, NULL, TRUE, 1, TRUE);
-    nvfree(cmd);
+    arch = get_machine_arch(op);
+    if (!arch) {
+        return FALSE;
+    }
 
-    return ret == 0;
-}
+    entry = lookup_conftest_cache(op, dir, arch, args, &key);
 
-/*
- * sign_kernel_module() - sign a kernel module. The caller is responsible
- * for ensuring that the kernel module is already built successfully and that
- * op->module_signing_{secret,public}_key are set.
- */
-int sign_kernel_module(Options *op, const char *build_directory, 
-                       const char *module_filename, int status) {
-    char *file;
-    int success;
-    static int num_args = 3;
+    if (entry) {
+        if (result) {
+            *result = nvstrdup(entry->output);
+        }
+        nvfree(key);
+        return entry->success;
+    }
 
-    /* Lazily set the default value for module_signing_script. */
+    argv = conftest_argv(op, dir, arch, args);
 
-    if (!op->module_signing_script) {
-        op->module_signing_script = nvstrcat(op->kernel_source_path,
-                                             "/scripts/sign-file", NULL);
-    }
+    ret = run_command_argv(op, argv, NULL, &output, FALSE, 0, TRUE, 0);
 
-    if (status) {
-        ui_status_begin(op, "Signing kernel module:", "Signing");
+    record_conftest_result(op, key, ret, output);
+
+    if (result) {
+        *result = output;
+    } else {
+        nvfree(output);
     }
 
-    file = nvstrcat(build_directory, "/", module_filename, NULL);
+    nvfree(key);
+    free_conftest_argv(argv);
 
-  try_sign:
+    return ret == 0;
+} /* run_conftest() */
 
-    success = try_sign_file(op, file, num_args);
 
-    /* If sign-file failed to run with three arguments, try running it with
-     * four arguments on all subsequent signing attempts. */
 
-    if (num_args == 3 && !success) {
-        num_args = 4;
+/*
+ * start_conftest_job() - start running a conftest in the background, in its
+ * own process group so that it can be cancelled along with any compiler it
+ * runs.  A cached result, or a failure to start the conftest, completes the
+ * job immediately.
+ */
 
-        /* The four-arg version of sign-file needs a hash. */
+static void start_conftest_job(Options *op, ConftestJob *job)
+{
+    const ConftestCacheEntry *entry;
+    char **argv, *arch;
 
-        if (!op->module_signing_hash) {
-            op->module_signing_hash = guess_module_signing_hash(op,
-                                          build_directory);
-        }
+    job->state = CONFTEST_JOB_DONE;
+    job->ret = FALSE;
 
-        if (op->module_signing_hash) {
-            goto try_sign;
-        } else {
-            ui_error(op, "The installer was unable to sign %s without "
-                     "specifying a hash algorithm on the command line to %s, "
-                     "and was also unable to automatically detect the hash. "
-                     "If you need to sign the NVIDIA kernel modules, please "
-                     "try again and set the '--module-signing-hash' option on "
-                     "the installer's command line.",
-                     file, op->module_signing_script);
-        }
+    arch = get_machine_arch(op);
+    if (!arch) {
+        return;
     }
 
-    nvfree(file);
+    entry = lookup_conftest_cache(op, job->dir, arch, job->args, &job->key);
 
-    if (status) {
-        ui_status_end(op, success ? "done." : "Failed to sign kernel module.");
+    if (entry) {
+        job->output = nvstrdup(entry->output);
+        job->ret = entry->success;
+        return;
+    }
+
+    argv = conftest_argv(op, job->dir, arch, job->args);
+    job->pid = spawn_command(argv, NULL, TRUE, TRUE, &job->fd);
+
+    if (job->pid != -1) {
+        job->state = CONFTEST_JOB_RUNNING;
     } else {
-        ui_log(op, success ? "Signed kernel module." : "Module signing failed");
+        ui_error(op, "Failure executing command '%s' (%s).", argv[1],
+                 strerror(errno));
     }
 
-    op->kernel_module_signed = success;
-    return success;
+    free_conftest_argv(argv);
 }
 
 
 
 /*
- * create_detached_signature() - Link a precompiled interface into a module,
- * sign the resulting linked module, and store a CRC for the linked, unsigned
- * module and the detached signature in the provided PrecompiledFileInfo record.
+ * read_conftest_job_output() - read the available output of a running
+ * conftest.  Returns FALSE once the conftest has finished, after recording
+ * its result.
  */
-static int create_detached_signature(Options *op, Package *p,
-                                     const char *build_dir,
-                                     PrecompiledFileInfo *fileInfo,
-                                     const char *module_filename)
+
+static int read_conftest_job_output(Options *op, ConftestJob *job)
+{
+    int n, status;
+
+    if (job->output_size - job->output_len < NV_MIN_LINE_LEN) {
+        job->output_size = job->output_size ? job->output_size * 2 :
+                                              NV_LINE_LEN;
+        job->output = nvrealloc(job->output, job->output_size);
+    }
+
+    n = read(job->fd, job->output + job->output_len,
+             job->output_size - job->output_len - 1);
+
+    if (n > 0) {
+        job->output_len += n;
+        job->output[job->output_len] = '\0';
+        return TRUE;
+    }
+
+    if (n < 0 && (errno == EINTR || errno == EAGAIN)) {
+        return TRUE;
+    }
+
+    close(job->fd);
+
+    status = wait_for_child(job->pid);
+
+    /* like run_command(), strip the trailing newline */
+
+    job->output[job->output_len] = '\0';
+    if (job->output_len > 0 && job->output[job->output_len - 1] == '\n') {
+        job->output[job->output_len - 1] = '\0';
+    }
+
+    job->state = CONFTEST_JOB_DONE;
+    job->ret = (status == 0);
+
+    if (!job->cancelled) {
+        record_conftest_result(op, job->key, status, job->output);
+    }
+
+    return FALSE;
+}
+
+
+
+/*
+ * cancel_conftest_jobs() - cancel the given conftest jobs: jobs which have
+ * not been started yet will not be, and running jobs are terminated.
+ */
+
+static void cancel_conftest_jobs(ConftestJob *jobs, int num_jobs)
+{
+    int i;
+
+    for (i = 0; i < num_jobs; i++) {
+        if (jobs[i].state != CONFTEST_JOB_DONE && !jobs[i].cancelled) {
+            jobs[i].cancelled = TRUE;
+            if (jobs[i].state == CONFTEST_JOB_RUNNING) {
+                kill(-jobs[i].pid, SIGTERM);
+            }
+        }
+    }
+}
+
+
+
+/*
+ * run_conftests() - run the given conftests concurrently, with up to
+ * op->concurrency_level of them running at a time, and record the result of
+ * each in its ConftestJob.  When a job marked 'fatal' fails, the jobs after
+ * it are cancelled, so that the first failure in job order is the same as if
+ * the jobs had been run one after another.
+ */
+
+static void run_conftests(Options *op, ConftestJob *jobs, int num_jobs)
+{
+    struct pollfd *fds;
+    int *running;
+    struct sigaction act, old_act;
+    nfds_t num_running = 0;
+    int next = 0, i;
+
+    fds = nvalloc(sizeof(struct pollfd) * num_jobs);
+    running = nvalloc(sizeof(int) * num_jobs);
+
+    /* see the comment about SIGWINCH in run_command() */
+
+    if (op->sigwinch_workaround) {
+        act.sa_handler = SIG_IGN;
+        sigemptyset(&act.sa_mask);
+        act.sa_flags = 0;
+
+        if (sigaction(SIGWINCH, &act, &old_act) < 0)
+            old_act.sa_handler = NULL;
+    }
+
+    while (next < num_jobs || num_running > 0) {
+
+        /* start conftests while there are free job slots */
+
+        while (next < num_jobs && num_running < op->concurrency_level) {
+            ConftestJob *job = &jobs[next];
+
+            if (job->cancelled) {
+                next++;
+                continue;
+            }
+
+            start_conftest_job(op, job);
+
+            if (job->state == CONFTEST_JOB_RUNNING) {
+                running[num_running++] = next;
+            } else if (job->fatal && !job->ret) {
+                cancel_conftest_jobs(jobs + next + 1, num_jobs - next - 1);
+            }
+
+            next++;
+        }
+
+        if (num_running == 0) {
+            continue;
+        }
+
+        for (i = 0; i < num_running; i++) {
+            fds[i].fd = jobs[running[i]].fd;
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
+
+        if (poll(fds, num_running, -1) < 0 && errno != EINTR) {
+            ui_error(op, "Error waiting for the conftests (%s).",
+                     strerror(errno));
+            cancel_conftest_jobs(jobs, num_jobs);
+            break;
+        }
+
+        for (i = num_running - 1; i >= 0; i--) {
+            int j = running[i];
+
+            if (!fds[i].revents || read_conftest_job_output(op, &jobs[j])) {
+                continue;
+            }
+
+            running[i] = running[--num_running];
+
+            if (jobs[j].fatal && !jobs[j].ret && !jobs[j].cancelled) {
+                cancel_conftest_jobs(jobs + j + 1, num_jobs - j - 1);
+            }
+        }
+    }
+
+    /* reap any conftests left running after an error */
+
+    for (i = 0; i < num_running; i++) {
+        while (read_conftest_job_output(op, &jobs[running[i]]));
+    }
+
+    if (op->sigwinch_workaround) {
+        sigaction(SIGWINCH, &old_act, NULL);
+    }
+
+    nvfree(running);
+    nvfree(fds);
+}
+
+
+
+/*
+ * determine_kernel_source_path() - find the qualified path to the
+ * kernel source tree.  This is called from install_from_cwd() if we
+ * need to compile the kernel interface files.  Assigns
+ * op->kernel_source_path and returns TRUE if successful.  Returns
+ * FALSE if no kernel source tree was found.
+ */
+
+int determine_kernel_source_path(Options *op, Package *p)
+{
+    char *result;
+    int count = 0;
+    
+    /* determine the kernel source path */
+    
+    op->kernel_source_path = default_kernel_source_path(op);
+    
+    if (op->expert) {
+        
+    ask_for_kernel_source_path:
+        
+        result = ui_get_input(op, op->kernel_source_path,
+                              "Kernel source path");
+        if (result && result[0]) {
+            if (!directory_exists(result)) {
+                ui_warn(op, "Kernel source path '%s' does not exist.",
+                        result);
+                free(result);
+                
+                if (++count < NUM_TIMES_QUESTIONS_ASKED) {
+                    goto ask_for_kernel_source_path;
+                } else {
+                    op->kernel_source_path = NULL;
+                }
+            } else {
+                op->kernel_source_path = result;
+            }
+        } else {
+            ui_warn(op, "Invalid kernel source path.");
+            if (result) free(result);
+            
+            if (++count < NUM_TIMES_QUESTIONS_ASKED) {
+                goto ask_for_kernel_source_path;
+            } else {
+                op->kernel_source_path = NULL;
+            }
+        }
+    }
+
+    /* if we STILL don't have a kernel source path, give up */
+    
+    if (!op->kernel_source_path) {
+        ui_error(op, "Unable to find the kernel source tree for the "
+                 "currently running kernel.  %s", install_your_kernel_source);
+        
+        /*
+         * I suppose we could ask them here for the kernel source
+         * path, but we've already given users multiple methods of
+         * specifying their kernel source tree.
+         */
+        
+        return FALSE;
+    }
+
+    return check_kernel_source_path(op);
+
+} /* determine_kernel_source_path() */
+
+
+/*
+ * check_kernel_source_path() - check that op->kernel_source_path is a
+ * kernel source tree, determine the kernel output path, and check that the
+ * kernel has been configured.  Returns TRUE if successful.
+ */
+
+static int check_kernel_source_path(Options *op)
+{
+    char *result;
+    char *version_h, *uapi_version_h;
+    int ret;
+
+    /* reject /usr as an invalid kernel source path */
+
+    if (!strcmp(op->kernel_source_path, "/usr") ||
+            !strcmp(op->kernel_source_path, "/usr/")) {
+        ui_error (op, "The kernel source path '%s' is invalid.  %s",
+                  op->kernel_source_path, install_your_kernel_source);
+        op->kernel_source_path = NULL;
+        return FALSE;
+    }
+
+    /* check that the kernel source path exists */
+
+    if (!directory_exists(op->kernel_source_path)) {
+        ui_error (op, "The kernel source path '%s' does not exist.  %s",
+                  op->kernel_source_path, install_your_kernel_source);
+        op->kernel_source_path = NULL;
+        return FALSE;
+    }
+
+    /* check that <path>/include/linux/kernel.h exists */
+
+    result = nvstrcat(op->kernel_source_path, "/include/linux/kernel.h", NULL);
+    if (access(result, F_OK) == -1) {
+        ui_error(op, "The kernel header file '%s' does not exist.  "
+                 "The most likely reason for this is that the kernel source "
+                 "path '%s' is incorrect.  %s", result,
+                 op->kernel_source_path, install_your_kernel_source);
+        free(result);
+        return FALSE;
+    }
+    free(result);
+
+    if (!determine_kernel_output_path(op)) return FALSE;
+
+    /* check to make sure that either include/linux/version.h or
+     * include/generated/uapi/linux/version.h is present in the output dir */
+
+#define VERSION_H_PATH "/include/linux/version.h"
+#define UAPI_VERSION_H_PATH "/include/generated/uapi/linux/version.h"
+
+    version_h = nvstrcat(op->kernel_output_path, VERSION_H_PATH, NULL);
+    uapi_version_h = nvstrcat(op->kernel_output_path, UAPI_VERSION_H_PATH,
+                              NULL);
+
+    ret = access(version_h, F_OK) == 0 || access(uapi_version_h, F_OK) == 0;
+
+    free(version_h);
+    free(uapi_version_h);
+
+    if (!ret) {
+        ui_error(op, "Neither the '" VERSION_H_PATH "' nor the '"
+                 UAPI_VERSION_H_PATH "' kernel header file exists.  "
+                 "The most likely reason for this is that the kernel "
+                 "source files in '%s' have not been configured.",
+                 op->kernel_output_path);
+        return FALSE;
+    }
+
+    /* OK, we seem to have a path to a configured kernel source tree */
+    
+    ui_log(op, "Kernel source path: '%s'\n", op->kernel_source_path);
+    ui_log(op, "Kernel output path: '%s'\n", op->kernel_output_path);
+    
+    return TRUE;
+    
+} /* check_kernel_source_path() */
+
+
+/*
+ * determine_kernel_output_path() - determine the kernel output
+ * path; unless specified, the kernel output path is assumed to be
+ * the same as the kernel source path.
+ */
+
+int determine_kernel_output_path(Options *op)
+{
+    char *str, *tmp;
+    int len;
+
+    /* check --kernel-output-path */
+
+    if (op->kernel_output_path) {
+        ui_log(op, "Using the kernel output path '%s' as specified by the "
+               "'--kernel-output-path' commandline option.",
+               op->kernel_output_path);
+
+        if (!directory_exists(op->kernel_output_path)) {
+            ui_error(op, "The kernel output path '%s' does not exist.",
+                     op->kernel_output_path);
+            op->kernel_output_path = NULL;
+            return FALSE;
+        }
+
+        return TRUE;
+    }
+
+    /* check SYSOUT */
+
+    str = getenv("SYSOUT");
+    if (str) {
+        ui_log(op, "Using the kernel output path '%s', as specified by the "
+               "SYSOUT environment variable.", str);
+        op->kernel_output_path = str;
+
+        if (!directory_exists(op->kernel_output_path)) {
+            ui_error(op, "The kernel output path '%s' does not exist.",
+                     op->kernel_output_path);
+            op->kernel_output_path = NULL;
+            return FALSE;
+        }
+
+        return TRUE;
+    }
+
+    /* check /lib/modules/`uname -r`/{source,build} */
+
+    tmp = get_kernel_name(op);
+
+    if (tmp) {
+        str = nvstrcat("/lib/modules/", tmp, "/source", NULL);
+        len = strlen(str);
+
+        if (!strncmp(op->kernel_source_path, str, len)) {
+            nvfree(str);
+            str = nvstrcat("/lib/modules/", tmp, "/build", NULL);
+
+            if (directory_exists(str)) {
+                op->kernel_output_path = str;
+                return TRUE;
+            }
+        }
+
+        nvfree(str);
+    }
+
+    op->kernel_output_path = op->kernel_source_path;
+    return TRUE;
+}
+
+
+/*
+ * attach_signature() - If we have a detached signature, verify the checksum of
+ * the linked module and append the signature.
+ */
+static int attach_signature(Options *op, Package *p,
+                            const PrecompiledFileInfo *fileInfo,
+                            const char *module_name) {
+    uint32 actual_crc;
+    char *module_path;
+    int ret = FALSE, command_ret;
+
+    const char *choices[2] = {
+        "Install unsigned kernel module",
+        "Abort installation"
+    };
+
+    ui_log(op, "Attaching module signature to linked kernel module.");
+
+    module_path = nvstrcat(p->kernel_module_build_directory, "/",
+                           fileInfo->target_directory, "/", module_name, NULL);
+
+    command_ret = verify_crc(op, module_path, fileInfo->linked_module_crc,
+                             &actual_crc);
+
+    if (command_ret) {
+        FILE *module_file;
+
+        module_file = fopen(module_path, "a+");
+
+        if (module_file && fileInfo->signature_size) {
+            command_ret = fwrite(fileInfo->signature, 1,
+                                 fileInfo->signature_size, module_file);
+            if (command_ret == fileInfo->signature_size) {
+                op->kernel_module_signed = ret = !ferror(module_file);
+            }
+        } else {
+            ret = (ui_multiple_choice(op, choices, 2, 1,
+                                      "A detached signature was included with "
+                                      "the precompiled interface, but opening "
+                                      "the linked kernel module and/or the "
+                                      "signature file failed.\n\nThe detached "
+                                      "signature will not be added; would you "
+                                      "still like to install the unsigned "
+                                      "kernel module?") == 0);
+        }
+
+        if (module_file) {
+            fclose(module_file);
+        }
+    } else {
+        ret = (ui_multiple_choice(op, choices, 2, 1,
+                                  "A detached signature was included with the "
+                                  "precompiled interface, but the checksum of "
+                                  "the linked kernel module (%d) did not match "
+                                  "the checksum of the the kernel module for "
+                                  "which the detached signature was generated "
+                                  "(%d).\n\nThis can happen if the linker on "
+                                  "the installation target system is not the "
+                                  "same as the linker on the system that built "
+                                  "the precompiled interface.\n\nThe detached "
+                                  "signature will not be added; would you "
+                                  "still like to install the unsigned kernel "
+                                  "module?", actual_crc,
+                                  fileInfo->linked_module_crc) == 0);
+    }
+
+    if (ret) {
+        if(op->kernel_module_signed) {
+            ui_log(op, "Signature attached successfully.");
+        } else {
+            ui_log(op, "Signature not attached.");
+        }
+    } else {
+        ui_error(op, "Failed to attach signature.");
+    }
+
+    nvfree(module_path);
+    return ret;
+} /* attach_signature() */
+
+
+/*
+ * unpack_kernel_modules() - unpack the precompiled file bundle, and link any
+ * prebuilt kernel interface against their respective binary-only core object
+ * files. This results in a complete kernel module, ready for installation.
+ *
+ * e.g.: ld -r -o nvidia.ko nv-linux.o nvidia/nv-kernel.o_binary
+ *
+ * If the precompiled file is a complete kernel module instead of an interface
+ * file, no additional action is needed after unpacking.
+ */
+
+int unpack_kernel_modules(Options *op, Package *p, const char *build_directory,
+                          const PrecompiledFileInfo *fileInfo)
+{
+    char *cmd;
+    int ret;
+    uint32 attrmask;
+
+    if (fileInfo->type != PRECOMPILED_FILE_TYPE_INTERFACE &&
+        fileInfo->type != PRECOMPILED_FILE_TYPE_MODULE) {
+        ui_error(op, "The file does not appear to be a valid precompiled "
+                 "kernel interface or module.");
+        return FALSE;
+    }
+
+    ret = precompiled_file_unpack(op, fileInfo, build_directory);
+    if (!ret) {
+        ui_error(op, "Failed to unpack the precompiled file.");
+        return FALSE;
+    } else if (fileInfo->type == PRECOMPILED_FILE_TYPE_MODULE) {
+        ui_log(op, "Kernel module unpacked successfully.");
+        return TRUE;
+    }
+
+    cmd = nvstrcat("cd ", build_directory,
+                   "; ", op->utils[LD], " ", LD_OPTIONS, " -o ",
+                   fileInfo->linked_module_name, " ",
+                   fileInfo->target_directory, "/", fileInfo->name, " ",
+                   fileInfo->target_directory, "/", fileInfo->core_object_name,
+                   NULL);
+
+    ret = run_command(op, cmd, NULL, TRUE, 0, TRUE);
+
+    free(cmd);
+
+    if (ret != 0) {
+        ui_error(op, "Unable to link kernel module.");
+        return FALSE;
+    }
+
+    ui_log(op, "Kernel module linked successfully.");
+
+    attrmask = PRECOMPILED_ATTR(DETACHED_SIGNATURE) |
+               PRECOMPILED_ATTR(LINKED_MODULE_CRC);
+
+    if ((fileInfo->attributes & attrmask) == attrmask) {
+        return attach_signature(op, p, fileInfo,
+                                fileInfo->linked_module_name);
+    }
+
+    return TRUE;
+   
+}
+
+
+static int check_file(Options *op, Package *p, const char *dir,
+                      const char *modname)
+{
+    int ret;
+    char *path;
+
+    path = nvstrcat(dir, "/", modname, ".ko", NULL);
+    ret = access(path, F_OK);
+
+    if (ret == -1) {
+        char *single_module_list = nvstrcat("NV_KERNEL_MODULES=\"", modname,
+                                            "\"", NULL);
+        char *rebuild_msg = nvstrcat("Checking to see whether the ", modname,
+                                     " kernel module was successfully built",
+                                     NULL);
+        /* Attempt to rebuild the individual module, in case the failure
+         * is module-specific and due to a different module */
+        run_make(op, p, dir, single_module_list, NULL, rebuild_msg, 25);
+        nvfree(single_module_list);
+        nvfree(rebuild_msg);
+
+        /* Check the file again */
+        ret = access(path, F_OK);
+    }
+
+    nvfree(path);
+
+    if (ret == -1) {
+        ui_error(op, "The %s kernel module was not created.", modname);
+    }
+
+    return ret != -1;
+}
+
+
+
+/*
+ * Build the kernel modules that part of this package.
+ */
+
+int build_kernel_modules(Options *op, Package *p)
+{
+    return build_kernel_interfaces(op, p, NULL);
+}
+
+
+/*
+ * Run the module_signing_script with three or four arguments.
+ * Return TRUE on success.
+ */
+static int try_sign_file(Options *op, const char *file, int num_args)
+{
+    char *cmd;
+    const char *arg_1;
+    int ret;
+
+    switch (num_args) {
+        case 3: arg_1 = ""; break;
+        case 4: arg_1 = op->module_signing_hash; break;
+        default: return FALSE;
+    }
+
+    cmd = nvstrcat("\"", op->module_signing_script, "\" ",
+                   arg_1, " \"",
+                   op->module_signing_secret_key, "\" \"",
+                   op->module_signing_public_key, "\" \"",
+                   file, "\"", NULL);
+    ret = run_command(op, cmd, NULL, TRUE, 1, TRUE);
+    nvfree(cmd);
+
+    return ret == 0;
+}
+
+/*
+ * sign_kernel_module() - sign a kernel module. The caller is responsible
+ * for ensuring that the kernel module is already built successfully and that
+ * op->module_signing_{secret,public}_key are set.
+ */
+int sign_kernel_module(Options *op, const char *build_directory, 
+                       const char *module_filename, int status) {
+    char *file;
+    int success;
+    static int num_args = 3;
+
+    /* Lazily set the default value for module_signing_script. */
+
+    if (!op->module_signing_script) {
+        op->module_signing_script = nvstrcat(op->kernel_source_path,
+                                             "/scripts/sign-file", NULL);
+    }
+
+    if (status) {
+        ui_status_begin(op, "Signing kernel module:", "Signing");
+    }
+
+    file = nvstrcat(build_directory, "/", module_filename, NULL);
+
+  try_sign:
+
+    success = try_sign_file(op, file, num_args);
+
+    /* If sign-file failed to run with three arguments, try running it with
+     * four arguments on all subsequent signing attempts. */
+
+    if (num_args == 3 && !success) {
+        num_args = 4;
+
+        /* The four-arg version of sign-file needs a hash. */
+
+        if (!op->module_signing_hash) {
+            op->module_signing_hash = guess_module_signing_hash(op,
+                                          build_directory);
+        }
+
+        if (op->module_signing_hash) {
+            goto try_sign;
+        } else {
+            ui_error(op, "The installer was unable to sign %s without "
+                     "specifying a hash algorithm on the command line to %s, "
+                     "and was also unable to automatically detect the hash. "
+                     "If you need to sign the NVIDIA kernel modules, please "
+                     "try again and set the '--module-signing-hash' option on "
+                     "the installer's command line.",
+                     file, op->module_signing_script);
+        }
+    }
+
+    nvfree(file);
+
+    if (status) {
+        ui_status_end(op, success ? "done." : "Failed to sign kernel module.");
+    } else {
+        ui_log(op, success ? "Signed kernel module." : "Module signing failed");
+    }
+
+    op->kernel_module_signed = success;
+    return success;
+}
+
+
+
+/*
+ * create_detached_signature() - Link a precompiled interface into a module,
+ * sign the resulting linked module, and store a CRC for the linked, unsigned
+ * module and the detached signature in the provided PrecompiledFileInfo record.
+ */
+static int create_detached_signature(Options *op, Package *p,
+                                     const char *build_dir,
+                                     PrecompiledFileInfo *fileInfo,
+                                     const char *module_filename)
 {
     int ret, command_ret;
     struct stat st;
     char *module_path = NULL, *error = NULL, *target_dir = NULL;
 
-    ui_status_begin(op, "Creating a detached signature for the linked "
-                    "kernel module:", "Linking module");
+    ui_status_begin(op, "Creating a detached signature for the linked "
+                    "kernel module:", "Linking module");
+
+    ret = unpack_kernel_modules(op, p, build_dir, fileInfo);
+
+    if (!ret) {
+        ui_error(op, "Failed to link a kernel module for signing.");
+        goto done;
+    }
+
+    target_dir = nvstrcat(build_dir, "/", fileInfo->target_directory, NULL);
+    module_path = nvstrcat(target_dir, "/", module_filename, NULL);
+    command_ret = stat(module_path, &st);
+
+    if (command_ret != 0) {
+        ret = FALSE;
+        error = "Unable to determine size of linked module.";
+        goto done;
+    }
+
+    ui_status_update(op, .25, "Generating module checksum");
+
+    fileInfo->linked_module_crc = compute_crc(op, module_path);
+    fileInfo->attributes |= PRECOMPILED_ATTR(LINKED_MODULE_CRC);
+
+    ui_status_update(op, .50, "Signing linked module");
+
+    ret = sign_kernel_module(op, target_dir, module_filename, FALSE);
+
+    if (!ret) {
+        error = "Failed to sign the linked kernel module.";
+        goto done;
+    }
+
+    ui_status_update(op, .75, "Detaching module signature");
+
+    fileInfo->signature_size = byte_tail(module_path, st.st_size,
+                                         &(fileInfo->signature));
+
+    if (!(fileInfo->signature) || fileInfo->signature_size == 0) {
+        error = "Failed to detach the module signature";
+        goto done;
+    }
+
+    fileInfo->attributes |= PRECOMPILED_ATTR(DETACHED_SIGNATURE);
+
+done:
+    if (ret) {
+        ui_status_end(op, "done.");
+    } else {
+        ui_status_end(op, "Error.");
+        if (error) {
+            ui_error(op, "%s", error);
+        }
+    }
+
+    nvfree(module_path);
+    nvfree(target_dir);
+    return ret;
+}
+
+
+/*
+ * pack_kernel_interface() - Store the input built interfaces in the
+ * PrecompiledFileInfo array.
+ *
+ * Returns true if the packing was successful, or false on error.
+ */
+static int pack_kernel_interface(Options *op, Package *p,
+                                 const char *build_dir,
+                                 PrecompiledFileInfo *fileInfo,
+                                 const char *kernel_interface,
+                                 const char *module_filename,
+                                 const char *core_file)
+{
+    int command_ret;
+    char *file_path = nvstrcat(build_dir, "/", kernel_interface, NULL);
+
+    command_ret = precompiled_read_interface(fileInfo, file_path,
+                                             module_filename,
+                                             core_file, ".", TRUE);
+
+    nvfree(file_path);
+
+    if (command_ret) {
+        if (op->module_signing_secret_key && op->module_signing_public_key) {
+            if (!create_detached_signature(op, p, build_dir, fileInfo,
+                                           module_filename)) {
+                return FALSE;
+            }
+        }
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+static void handle_optional_module_failure(Options *op,
+                                           KernelModuleInfo module,
+                                           const char *action) {
+    if (module.is_optional) {
+        ui_error(op, "The %s kernel module failed to %s. This kernel module "
+                 "is required for the proper operation of %s. If you do not "
+                 "need to use %s, you can try to install this driver package "
+                 "again with the '--%s' option.",
+                 module.module_name, action, module.optional_module_dependee,
+                 module.optional_module_dependee, module.disable_option);
+    }
+}
+
+
+static int pack_kernel_module(Options *op,
+                              const char *build_dir,
+                              PrecompiledFileInfo *fileInfo,
+                              const char *module_filename)
+{
+    int command_ret;
+    char *file_path = nvstrcat(build_dir, "/", module_filename, NULL);
+
+    if (op->module_signing_secret_key && op->module_signing_public_key) {
+        if (sign_kernel_module(op, build_dir, module_filename, FALSE)) {
+            fileInfo->attributes |= PRECOMPILED_ATTR(EMBEDDED_SIGNATURE);
+        } else {
+            ui_error(op, "Failed to sign precompiled kernel module %s!",
+                     module_filename);
+            return FALSE;
+        }
+    }
+
+    command_ret = precompiled_read_module(fileInfo, file_path, "", TRUE);
+
+    nvfree(file_path);
+
+    if (command_ret) {
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+
+
+/*
+ * clone_build_directory() - copy the kernel module sources to the given
+ * temporary build directory, and log how long it took.
+ */
+
+static int clone_build_directory(Options *op, Package *p, const char *dir)
+{
+    struct timespec start, end;
+    int linked, copied, ret;
+
+    ui_log(op, "Copying kernel module sources to temporary directory.");
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ret = clone_directory_contents(op, p, p->kernel_module_build_directory,
+                                   dir, &linked, &copied);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (!ret) {
+        ui_error(op, "Unable to copy the kernel module sources to temporary "
+                 "directory '%s'.", dir);
+        return FALSE;
+    }
+
+    ui_log(op, "Cloned the kernel module sources to '%s' in %.3f seconds "
+           "(%d files hard linked, %d files copied).", dir,
+           (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9,
+           linked, copied);
+
+    return TRUE;
+}
+
+
+
+/*
+ * the sanity checks run before building the kernel modules, in the order
+ * their failures are reported
+ */
+
+static const struct {
+    const char *sanity_check_name;
+    const char *conftest_args;
+} sanity_checks[] = {
+    { "Compiler", "cc_sanity_check just_msg" },
+    { "Dom0", "dom0_sanity_check just_msg" },
+    { "Xen", "xen_sanity_check just_msg" },
+    { "PREEMPT_RT", "preempt_rt_sanity_check just_msg" },
+    { "vgpu_kvm", "vgpu_kvm_sanity_check just_msg" },
+};
+
+#define CC_VERSION_CHECK_ARGS "cc_version_check just_msg"
+
+
+
+/*
+ * run_sanity_checks() - run the sanity check conftests in the given build
+ * directory, and check the compiler version.  The conftests are run
+ * concurrently, and their results reported in order.  Returns TRUE if the
+ * kernel modules may be built.
+ */
+
+static int run_sanity_checks(Options *op, Package *p, const char *builddir)
+{
+    ConftestJob jobs[ARRAY_LEN(sanity_checks) + 1];
+    int i, num_jobs = 0, ret = TRUE;
+
+    memset(jobs, 0, sizeof(jobs));
+
+    for (i = 0; i < ARRAY_LEN(sanity_checks); i++) {
+        jobs[num_jobs].dir = builddir;
+        jobs[num_jobs].args = sanity_checks[i].conftest_args;
+        jobs[num_jobs].fatal = TRUE;
+        num_jobs++;
+    }
+
+    /* a failed cc_version_check is handled by report_cc_version_check() */
+
+    if (!op->ignore_cc_version_check) {
+        jobs[num_jobs].dir = p->kernel_module_build_directory;
+        jobs[num_jobs].args = CC_VERSION_CHECK_ARGS;
+        num_jobs++;
+    }
+
+    run_conftests(op, jobs, num_jobs);
+
+    /* report the results in order, stopping at the first failure */
+
+    for (i = 0; ret && i < ARRAY_LEN(sanity_checks); i++) {
+        ret = report_sanity_check(op, sanity_checks[i].sanity_check_name,
+                                  jobs[i].ret, jobs[i].output);
+    }
+
+    /* check the cc_version_check result last, to allow
+     * report_cc_version_check() to set IGNORE_CC_MISMATCH if needed */
+
+    if (ret) {
+        ret = report_cc_version_check(op, num_jobs > i ? jobs[i].ret : TRUE,
+                                      num_jobs > i ? jobs[i].output : NULL);
+    }
+
+    for (i = 0; i < num_jobs; i++) {
+        nvfree(jobs[i].output);
+        nvfree(jobs[i].key);
+    }
+
+    return ret;
+}
+
+
+
+/*
+ * build_kernel_interfaces() - build the kernel modules and interfaces, and
+ * store any precompiled files in a newly allocated PrecompiledFileInfo array.
+ * Return the number of packaged files, or 0 on error.
+ *
+ * If fileInfos is NULL, stop after building the kernel modules and do not
+ * build the interfaces.
+ *
+ * When building interfaces, copy everything into a temporary directory and
+ * work out of the tmpdir. For kernel module only builds, operate within
+ * p->kernel_module_build_directory, as later packaging steps will look for
+ * the built files there. If a tmpdir is created, it is removed before exit.
+ */
+
+int build_kernel_interfaces(Options *op, Package *p,
+                            PrecompiledFileInfo ** fileInfos)
+{
+    char *tmpdir = NULL, *builddir;
+    int ret, files_packaged = 0, i;
+
+    /* do not build if there is a kernel configuration conflict (and don't
+     * perform target system checks if we're only building interfaces) */
+
+    if (kernel_configuration_conflict(op, p, fileInfos == NULL)) {
+        return 0;
+    }
+
+    if (fileInfos) {
+        *fileInfos = NULL;
+    }
+
+    /* create a temporary directory if we will be packing interfaces */
 
-    ret = unpack_kernel_modules(op, p, build_dir, fileInfo);
+    if (fileInfos) {
+        tmpdir = make_tmpdir(op);
+        builddir = tmpdir;
+
+        if (!tmpdir) {
+            ui_error(op, "Unable to create a temporary build directory.");
+            goto done;
+        }
+
+        /* copy the kernel module sources to it */
+
+        if (!clone_build_directory(op, p, tmpdir)) {
+            goto done;
+        }
+    } else {
+        builddir = p->kernel_module_build_directory;
+    }
+    
+    /*
+     * touch the contents of the build directory, to avoid make time
+     * skew error messages
+     */
+
+    if (!run_sanity_checks(op, p, builddir)) {
+        goto done;
+    }
+
+    ui_log(op, "Cleaning kernel module build directory.");
+    run_make(op, p, builddir, "clean", NULL, NULL, 0);
+    ret = run_make(op, p, builddir, "", NULL, "Building kernel modules", 25);
+
+    /* Test to make sure that all kernel modules were built. */
+    for (i = 0; i < p->num_kernel_modules; i++) {
+        if (!check_file(op, p, builddir, p->kernel_modules[i].module_name)) {
+            handle_optional_module_failure(op, p->kernel_modules[i], "build");
+            goto done;
+        }
+    }
 
+    /*
+     * Now check the status of the overall build: it may have failed, despite
+     * having produced all expected kernel modules.
+     */
     if (!ret) {
-        ui_error(op, "Failed to link a kernel module for signing.");
         goto done;
     }
 
-    target_dir = nvstrcat(build_dir, "/", fileInfo->target_directory, NULL);
-    module_path = nvstrcat(target_dir, "/", module_filename, NULL);
-    command_ret = stat(module_path, &st);
+    ui_log(op, "Kernel module compilation complete.");
 
-    if (command_ret != 0) {
-        ret = FALSE;
-        error = "Unable to determine size of linked module.";
+    /*
+     * If we're not building interfaces, return the number of built modules
+     * instead of the number of packaged interfaces.
+     */
+    if (fileInfos == NULL) {
+        /* If we've made it this far, all the modules were built. */
+        files_packaged = p->num_kernel_modules;
         goto done;
     }
 
-    ui_status_update(op, .25, "Generating module checksum");
+    *fileInfos = nvalloc(sizeof(PrecompiledFileInfo) *
+        (p->num_kernel_modules + 1));
 
-    fileInfo->linked_module_crc = compute_crc(op, module_path);
-    fileInfo->attributes |= PRECOMPILED_ATTR(LINKED_MODULE_CRC);
+    for (files_packaged = 0;
+         files_packaged < p->num_kernel_modules;
+         files_packaged++) {
+        PrecompiledFileInfo *fileInfo = *fileInfos + files_packaged;
+        KernelModuleInfo *module = p->kernel_modules + files_packaged;
 
-    ui_status_update(op, .50, "Signing linked module");
+        if (module->has_separate_interface_file) {
+            if (!(run_make(op, p, tmpdir, module->interface_filename,
+                           NULL, NULL, 0) &&
+                pack_kernel_interface(op, p, tmpdir, fileInfo,
+                                      module->interface_filename,
+                                      module->module_filename,
+                                      module->core_object_name))) {
+                goto done;
+            }
+        } else if (!pack_kernel_module(op, tmpdir, fileInfo,
+                                       module->module_filename)) {
+                goto done;
+        }
+    }
 
-    ret = sign_kernel_module(op, target_dir, module_filename, FALSE);
+done:
 
-    if (!ret) {
-        error = "Failed to sign the linked kernel module.";
+    if (files_packaged == 0 && fileInfos) {
+        nvfree(*fileInfos);
+        *fileInfos = NULL;
+    }
+
+    if (tmpdir) {
+        remove_directory(op, tmpdir);
+        nvfree(tmpdir);
+    }
+
+    return files_packaged;
+}
+
+
+
+/*
+ * TargetKernel: one of the kernels for which build_multiple_kernel_interfaces()
+ * builds precompiled kernel interfaces.
+ */
+
+typedef struct {
+    char *name;                 /* the entry of the kernel list */
+    char *source_path;
+    char *output_path;
+    char *proc_version_string;
+    char *description;
+    char *builddir;             /* the kernel's copy of the build directory */
+    pid_t pid;                  /* the build, while it runs */
+    int fd;                     /* output of the build, while it runs */
+    char *output;
+    int output_len, output_size;
+    int built;
+} TargetKernel;
+
+
+static void select_target_kernel(Options *op, const TargetKernel *k)
+{
+    op->kernel_source_path = k->source_path;
+    op->kernel_output_path = k->output_path;
+}
+
+
+/*
+ * read_kernel_header_string() - return the value of the string macro 'name'
+ * defined in the generated kernel header 'header' of the given kernel
+ * output directory, or NULL if it cannot be found.
+ */
+
+static char *read_kernel_header_string(const char *output_path,
+                                       const char *header, const char *name)
+{
+    char *path, *line, *value = NULL;
+    FILE *fp;
+    int eof = FALSE, len = strlen(name);
+
+    path = nvstrcat(output_path, "/include/generated/", header, NULL);
+    fp = fopen(path, "r");
+    nvfree(path);
+
+    if (!fp) {
+        return NULL;
+    }
+
+    while (!value && !eof && (line = fget_next_line(fp, &eof))) {
+        char *s = line, *end;
+
+        if (strncmp(s, "#define ", 8) == 0 &&
+            strncmp(s + 8, name, len) == 0 && isspace(s[8 + len])) {
+
+            s = strchr(s + 8 + len, '"');
+            end = s ? strrchr(s + 1, '"') : NULL;
+
+            if (end) {
+                value = nvstrndup(s + 1, end - s - 1);
+            }
+        }
+
+        nvfree(line);
+    }
+
+    fclose(fp);
+    return value;
+}
+
+
+/*
+ * read_kernel_banner() - return the version banner of the kernel release
+ * 'release' (the linux_banner string, which the kernel reports in
+ * /proc/version), found in the uncompressed kernel image 'path', or NULL.
+ */
+
+static char *read_kernel_banner(const char *path, const char *release)
+{
+    char *prefix, *banner = NULL;
+    const char *data, *start, *end;
+    struct stat stat_buf;
+    size_t len;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) == -1) {
+        return NULL;
+    }
+
+    if (fstat(fd, &stat_buf) == -1 || stat_buf.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+
+    len = stat_buf.st_size;
+    data = mmap(0, len, PROT_READ, MAP_FILE | MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+
+    prefix = nvstrcat("Linux version ", release, " (", NULL);
+    start = memmem(data, len, prefix, strlen(prefix));
+
+    if (start) {
+        end = memchr(start, '\n', len - (start - data));
+        if (end) {
+            banner = nvstrndup(start, end - start);
+        }
+    }
+
+    nvfree(prefix);
+    munmap((void *) data, len);
+
+    return banner;
+}
+
+
+/*
+ * get_target_kernel_proc_version() - determine the proc version string and
+ * description of a target kernel.  The proc version string of the running
+ * kernel is read from /proc.  For other kernels, it is read from the
+ * version banner in the kernel's vmlinux, if one can be found; otherwise,
+ * it is assembled from the kernel's generated headers, the same way that
+ * the kernel itself builds its banner.  The headers that are needed for
+ * that are not part of the build tree of recent kernels.
+ */
+
+static int get_target_kernel_proc_version(Options *op, TargetKernel *k)
+{
+    char *release, *version, *compile_by, *compile_host, *compiler, *machine;
+    struct utsname buf;
+    int ret = FALSE;
+
+    release = read_kernel_header_string(k->output_path, "utsrelease.h",
+                                        "UTS_RELEASE");
+    version = read_kernel_header_string(k->output_path, "utsversion.h",
+                                        "UTS_VERSION");
+    if (!version) {
+        version = read_kernel_header_string(k->output_path, "compile.h",
+                                            "UTS_VERSION");
+    }
+    compile_by = read_kernel_header_string(k->output_path, "compile.h",
+                                           "LINUX_COMPILE_BY");
+    compile_host = read_kernel_header_string(k->output_path, "compile.h",
+                                             "LINUX_COMPILE_HOST");
+    compiler = read_kernel_header_string(k->output_path, "compile.h",
+                                         "LINUX_COMPILER");
+    machine = read_kernel_header_string(k->output_path, "compile.h",
+                                        "UTS_MACHINE");
+
+    if (uname(&buf) != 0) {
+        ui_error(op, "Failed to retrieve uname identifiers from the kernel!");
         goto done;
     }
 
-    ui_status_update(op, .75, "Detaching module signature");
+    if (release && strcmp(release, buf.release) == 0) {
+        k->proc_version_string = read_proc_version(op, op->proc_mount_point);
+        k->description = nvstrcat(buf.sysname, " ", buf.release, " ",
+                                  buf.version, " ", buf.machine, NULL);
+    } else if (release) {
+        char *vmlinux[] = {
+            nvstrcat(k->output_path, "/vmlinux", NULL),
+            nvstrcat("/boot/vmlinux-", release, NULL),
+            nvstrcat("/usr/lib/debug/boot/vmlinux-", release, NULL),
+            nvstrcat("/usr/lib/debug/lib/modules/", release, "/vmlinux",
+                     NULL),
+        };
+        int i;
+
+        for (i = 0; i < ARRAY_LEN(vmlinux); i++) {
+            if (!k->proc_version_string) {
+                k->proc_version_string = read_kernel_banner(vmlinux[i],
+                                                            release);
+                if (k->proc_version_string) {
+                    const char *uts_version =
+                        strstr(k->proc_version_string, ") #");
+
+                    ui_log(op, "Read the version banner of the kernel '%s' "
+                           "from '%s'.", k->name, vmlinux[i]);
+                    k->description =
+                        nvstrcat("Linux ", release, " ",
+                                 uts_version ? uts_version + 2 : "", " ",
+                                 machine ? machine : buf.machine, NULL);
+                }
+            }
+            nvfree(vmlinux[i]);
+        }
+    }
 
-    fileInfo->signature_size = byte_tail(module_path, st.st_size,
-                                         &(fileInfo->signature));
+    if (!k->proc_version_string &&
+        release && version && compile_by && compile_host && compiler) {
+        k->proc_version_string = nvstrcat("Linux version ", release,
+                                          " (", compile_by, "@",
+                                          compile_host, ") (", compiler,
+                                          ") ", version, NULL);
+        k->description = nvstrcat("Linux ", release, " ", version, " ",
+                                  machine ? machine : buf.machine, NULL);
+    }
 
-    if (!(fileInfo->signature) || fileInfo->signature_size == 0) {
-        error = "Failed to detach the module signature";
+    if (!k->proc_version_string) {
+        ui_error(op, "Unable to determine the proc version string of the "
+                 "kernel '%s': no vmlinux image of the kernel was found, and "
+                 "the kernel output path '%s' does not contain the "
+                 "generated headers needed to reconstruct it.", k->name,
+                 k->output_path);
         goto done;
     }
 
-    fileInfo->attributes |= PRECOMPILED_ATTR(DETACHED_SIGNATURE);
+    ui_log(op, "Proc version string of the kernel '%s': '%s'", k->name,
+           k->proc_version_string);
+    ret = TRUE;
 
 done:
-    if (ret) {
-        ui_status_end(op, "done.");
+    nvfree(release);
+    nvfree(version);
+    nvfree(compile_by);
+    nvfree(compile_host);
+    nvfree(compiler);
+    nvfree(machine);
+
+    return ret;
+}
+
+
+/*
+ * resolve_target_kernel() - determine the kernel source and output paths of
+ * an entry of the kernel list given to build_multiple_kernel_interfaces(),
+ * which is either the name of an installed kernel (as `uname -r` would
+ * report it), or the path to a configured kernel source tree, optionally
+ * followed by ':' and the path to the kernel output tree.
+ */
+
+static int resolve_target_kernel(Options *op, TargetKernel *k)
+{
+    if (k->name[0] == '/') {
+        char *colon = strchr(k->name, ':');
+
+        if (colon) {
+            k->source_path = nvstrndup(k->name, colon - k->name);
+            k->output_path = nvstrdup(colon + 1);
+        } else {
+            k->source_path = nvstrdup(k->name);
+            k->output_path = nvstrdup(k->name);
+        }
     } else {
-        ui_status_end(op, "Error.");
-        if (error) {
-            ui_error(op, "%s", error);
+        char *source = nvstrcat("/lib/modules/", k->name, "/source", NULL);
+        char *build = nvstrcat("/lib/modules/", k->name, "/build", NULL);
+
+        if (directory_exists(source)) {
+            k->source_path = source;
+            k->output_path = nvstrdup(directory_exists(build) ? build : source);
+            nvfree(build);
+        } else if (directory_exists(build)) {
+            k->source_path = build;
+            k->output_path = nvstrdup(build);
+            nvfree(source);
+        } else {
+            nvfree(source);
+            nvfree(build);
+            k->source_path = nvstrcat("/usr/src/linux-", k->name, NULL);
+            k->output_path = nvstrdup(k->source_path);
         }
     }
 
-    nvfree(module_path);
-    nvfree(target_dir);
-    return ret;
+    ui_log(op, "Resolving the kernel source tree of the kernel '%s'.",
+           k->name);
+
+    select_target_kernel(op, k);
+
+    return check_kernel_source_path(op) &&
+           get_target_kernel_proc_version(op, k);
 }
 
 
 /*
- * pack_kernel_interface() - Store the input built interfaces in the
- * PrecompiledFileInfo array.
- *
- * Returns true if the packing was successful, or false on error.
+ * prepare_target_kernel() - copy the kernel module sources to the given
+ * directory for the build of the given kernel, and run the sanity checks
+ * against the kernel.
  */
-static int pack_kernel_interface(Options *op, Package *p,
-                                 const char *build_dir,
-                                 PrecompiledFileInfo *fileInfo,
-                                 const char *kernel_interface,
-                                 const char *module_filename,
-                                 const char *core_file)
+
+static int prepare_target_kernel(Options *op, Package *p, TargetKernel *k,
+                                 const char *builddir)
 {
-    int command_ret;
-    char *file_path = nvstrcat(build_dir, "/", kernel_interface, NULL);
+    /* the target system checks do not apply when only building interfaces */
 
-    command_ret = precompiled_read_interface(fileInfo, file_path,
-                                             module_filename,
-                                             core_file, ".");
+    if (kernel_configuration_conflict(op, p, FALSE)) {
+        return FALSE;
+    }
 
-    nvfree(file_path);
+    k->builddir = nvstrdup(builddir);
 
-    if (command_ret) {
-        if (op->module_signing_secret_key && op->module_signing_public_key) {
-            if (!create_detached_signature(op, p, build_dir, fileInfo,
-                                           module_filename)) {
-                return FALSE;
-            }
-        }
-        return TRUE;
+    if (!mkdir_recursive(op, k->builddir, 0755, FALSE)) {
+        ui_error(op, "Unable to create the build directory '%s'.",
+                 k->builddir);
+        return FALSE;
     }
 
-    return FALSE;
+    if (!clone_build_directory(op, p, k->builddir)) {
+        return FALSE;
+    }
+
+    return run_sanity_checks(op, p, k->builddir);
 }
 
 
-static void handle_optional_module_failure(Options *op,
-                                           KernelModuleInfo module,
-                                           const char *action) {
-    if (module.is_optional) {
-        ui_error(op, "The %s kernel module failed to %s. This kernel module "
-                 "is required for the proper operation of %s. If you do not "
-                 "need to use %s, you can try to install this driver package "
-                 "again with the '--%s' option.",
-                 module.module_name, action, module.optional_module_dependee,
-                 module.optional_module_dependee, module.disable_option);
-    }
+/*
+ * start_target_kernel_build() - start cleaning and building the kernel
+ * modules and interfaces for the selected kernel in the background.  The
+ * make processes do not get a job count of their own: they take their job
+ * slots from the jobserver described by 'makeflags'.
+ */
+
+static int start_target_kernel_build(Options *op, Package *p, TargetKernel *k,
+                                     const char *makeflags)
+{
+    char *cmd, *clean, *build, *interfaces = nvstrdup("");
+    int i;
+
+    for (i = 0; i < p->num_kernel_modules; i++) {
+        if (p->kernel_modules[i].has_separate_interface_file) {
+            char *old = interfaces;
+
+            interfaces = nvstrcat(old, " ",
+                                  p->kernel_modules[i].interface_filename,
+                                  NULL);
+            nvfree(old);
+        }
+    }
+
+    clean = make_command(op, p, " ", "clean", NULL);
+    build = make_command(op, p, " ", "", NULL);
+
+    cmd = nvstrcat("exec 2>&1; cd \"", k->builddir, "\" || exit 1; ",
+                   "export MAKEFLAGS=\"", makeflags, "\"; ",
+                   clean, "; ", build, NULL);
+
+    if (interfaces[0]) {
+        char *old = cmd, *make = make_command(op, p, " ", interfaces, NULL);
+
+        cmd = nvstrcat(old, " && ", make, NULL);
+        nvfree(make);
+        nvfree(old);
+    }
+
+    ui_log(op, "Building the kernel modules for the kernel '%s': '%s'",
+           k->name, cmd);
+
+    {
+        char *const argv[] = { "/bin/sh", "-c", cmd, NULL };
+
+        k->pid = spawn_command(argv, NULL, FALSE, FALSE, &k->fd);
+    }
+
+    if (k->pid == -1) {
+        ui_error(op, "Failure executing command '%s' (%s).", cmd,
+                 strerror(errno));
+    }
+
+    nvfree(interfaces);
+    nvfree(clean);
+    nvfree(build);
+    nvfree(cmd);
+
+    return k->pid != -1;
 }
 
 
-static int pack_kernel_module(Options *op,
-                              const char *build_dir,
-                              PrecompiledFileInfo *fileInfo,
-                              const char *module_filename)
+/*
+ * read_target_kernel_output() - read the available output of a running
+ * build.  Returns FALSE once the build has finished, after recording
+ * whether it succeeded.
+ */
+
+static int read_target_kernel_output(TargetKernel *k)
 {
-    int command_ret;
-    char *file_path = nvstrcat(build_dir, "/", module_filename, NULL);
+    int n;
 
-    if (op->module_signing_secret_key && op->module_signing_public_key) {
-        if (sign_kernel_module(op, build_dir, module_filename, FALSE)) {
-            fileInfo->attributes |= PRECOMPILED_ATTR(EMBEDDED_SIGNATURE);
-        } else {
-            ui_error(op, "Failed to sign precompiled kernel module %s!",
-                     module_filename);
-            return FALSE;
-        }
+    if (k->output_size - k->output_len < NV_MIN_LINE_LEN) {
+        k->output_size = k->output_size ? k->output_size * 2 : NV_LINE_LEN;
+        k->output = nvrealloc(k->output, k->output_size);
     }
 
-    command_ret = precompiled_read_module(fileInfo, file_path, "");
+    n = read(k->fd, k->output + k->output_len,
+             k->output_size - k->output_len - 1);
 
-    nvfree(file_path);
+    if (n > 0) {
+        k->output_len += n;
+        k->output[k->output_len] = '\0';
+        return TRUE;
+    }
 
-    if (command_ret) {
+    if (n < 0 && (errno == EINTR || errno == EAGAIN)) {
         return TRUE;
     }
 
+    k->output[k->output_len] = '\0';
+    close(k->fd);
+    k->built = (wait_for_child(k->pid) == 0);
+    k->pid = -1;
+
     return FALSE;
 }
 
 
-
-
 /*
- * build_kernel_interfaces() - build the kernel modules and interfaces, and
- * store any precompiled files in a newly allocated PrecompiledFileInfo array.
- * Return the number of packaged files, or 0 on error.
+ * run_target_kernel_builds() - build the kernel modules and interfaces for
+ * all of the target kernels, with up to op->concurrency_level jobs at a
+ * time across all builds.
  *
- * If fileInfos is NULL, stop after building the kernel modules and do not
- * build the interfaces.
- *
- * When building interfaces, copy everything into a temporary directory and
- * work out of the tmpdir. For kernel module only builds, operate within
- * p->kernel_module_build_directory, as later packaging steps will look for
- * the built files there. If a tmpdir is created, it is removed before exit.
+ * The installer owns the GNU make jobserver shared by the builds: every
+ * running build holds one implicit job slot, and the jobserver pipe holds
+ * a token for each of the remaining ones.  When a build finishes and no
+ * more builds are waiting for its slot, the slot is returned to the pipe
+ * as a token, so that the remaining builds can use it.
  */
 
-int build_kernel_interfaces(Options *op, Package *p,
-                            PrecompiledFileInfo ** fileInfos)
+static void run_target_kernel_builds(Options *op, Package *p,
+                                     TargetKernel *kernels, int num_kernels)
 {
-    char *tmpdir = NULL, *builddir;
-    int ret, files_packaged = 0, i;
+    struct pollfd *fds;
+    TargetKernel **running;
+    struct sigaction act, old_act;
+    char *makeflags;
+    nfds_t num_running = 0;
+    int jobserver[2], next = 0, done = 0, tokens, i;
+
+    if (pipe(jobserver) != 0) {
+        ui_error(op, "Unable to create the make jobserver pipe (%s).",
+                 strerror(errno));
+        return;
+    }
 
-    struct {
-        const char *sanity_check_name;
-        const char *conftest_name;
-    } sanity_checks[] = {
-        { "Compiler", "cc_sanity_check" },
-        { "Dom0", "dom0_sanity_check" },
-        { "Xen", "xen_sanity_check" },
-        { "PREEMPT_RT", "preempt_rt_sanity_check" },
-        { "vgpu_kvm", "vgpu_kvm_sanity_check" },
-    };
+    tokens = op->concurrency_level - NV_MIN(num_kernels,
+                                            op->concurrency_level);
+    for (i = 0; i < tokens; i++) {
+        if (write(jobserver[1], "+", 1) != 1) break;
+    }
 
-    /* do not build if there is a kernel configuration conflict (and don't
-     * perform target system checks if we're only building interfaces) */
+    makeflags = nvasprintf("-j --jobserver-fds=%d,%d", jobserver[0],
+                           jobserver[1]);
 
-    if (kernel_configuration_conflict(op, p, fileInfos == NULL)) {
-        return 0;
-    }
+    fds = nvalloc(sizeof(struct pollfd) * num_kernels);
+    running = nvalloc(sizeof(TargetKernel *) * num_kernels);
 
-    if (fileInfos) {
-        *fileInfos = NULL;
+    /* see the comment about SIGWINCH in run_command() */
+
+    if (op->sigwinch_workaround) {
+        act.sa_handler = SIG_IGN;
+        sigemptyset(&act.sa_mask);
+        act.sa_flags = 0;
+
+        if (sigaction(SIGWINCH, &act, &old_act) < 0)
+            old_act.sa_handler = NULL;
     }
 
-    /* create a temporary directory if we will be packing interfaces */
+    ui_status_begin(op, "Building kernel modules:", "Building for %d kernels",
+                    num_kernels);
 
-    if (fileInfos) {
-        tmpdir = make_tmpdir(op);
-        builddir = tmpdir;
+    while (done < num_kernels) {
 
-        if (!tmpdir) {
-            ui_error(op, "Unable to create a temporary build directory.");
-            goto done;
+        /* start builds while there are free job slots */
+
+        while (next < num_kernels && num_running < op->concurrency_level) {
+            TargetKernel *k = &kernels[next++];
+
+            select_target_kernel(op, k);
+
+            if (!start_target_kernel_build(op, p, k, makeflags)) {
+                done++;
+                continue;
+            }
+
+            running[num_running++] = k;
         }
 
-        /* copy the kernel module sources to it */
+        if (num_running == 0) {
+            continue;
+        }
 
-        ui_log(op, "Copying kernel module sources to temporary directory.");
+        for (i = 0; i < num_running; i++) {
+            fds[i].fd = running[i]->fd;
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
 
-        if (!copy_directory_contents
-            (op, p->kernel_module_build_directory, tmpdir)) {
-            ui_error(op, "Unable to copy the kernel module sources to temporary "
-                     "directory '%s'.", tmpdir);
-            goto done;
+        if (poll(fds, num_running, -1) < 0 && errno != EINTR) {
+            ui_error(op, "Error waiting for the kernel module builds (%s).",
+                     strerror(errno));
+            break;
         }
-    } else {
-        builddir = p->kernel_module_build_directory;
-    }
-    
-    /*
-     * touch the contents of the build directory, to avoid make time
-     * skew error messages
-     */
 
-    /* run sanity checks */
-    for (i = 0; i < ARRAY_LEN(sanity_checks); i++) {
-        if (!conftest_sanity_check(op, builddir,
-                                   sanity_checks[i].sanity_check_name,
-                                   sanity_checks[i].conftest_name)) {
-            return FALSE;
+        for (i = num_running - 1; i >= 0; i--) {
+            if (!fds[i].revents || read_target_kernel_output(running[i])) {
+                continue;
+            }
+
+            ui_status_update(op, (float) ++done / num_kernels,
+                             "Built kernel modules for '%s'",
+                             running[i]->name);
+
+            running[i] = running[--num_running];
+
+            /* hand the job slot over to the other builds */
+
+            if (next == num_kernels && write(jobserver[1], "+", 1) != 1) {
+                ui_expert(op, "Unable to return a job slot to the make "
+                          "jobserver.");
+            }
         }
     }
 
-    /* run cc_version_check separately to allow check_cc_version() to set
-     * IGNORE_CC_MISMATCH if needed */
-    if (!check_cc_version(op, p)) {
-        return FALSE;
+    ui_status_end(op, "done.");
+
+    /* reap any builds left running after an error */
+
+    for (i = 0; i < num_running; i++) {
+        while (read_target_kernel_output(running[i]));
     }
 
-    ui_log(op, "Cleaning kernel module build directory.");
-    run_make(op, p, builddir, "clean", NULL, NULL, 0);
-    ret = run_make(op, p, builddir, "", NULL, "Building kernel modules", 25);
+    if (op->sigwinch_workaround) {
+        sigaction(SIGWINCH, &old_act, NULL);
+    }
+
+    close(jobserver[0]);
+    close(jobserver[1]);
+    nvfree(makeflags);
+    nvfree(running);
+    nvfree(fds);
+}
+
+
+/*
+ * pack_target_kernel() - check the results of a target kernel's build, and
+ * store its precompiled files in a new PrecompiledInfo.  Returns NULL if the
+ * build failed.
+ */
+
+static PrecompiledInfo *pack_target_kernel(Options *op, Package *p,
+                                           TargetKernel *k)
+{
+    PrecompiledInfo *info;
+    int i, ret = TRUE;
+
+    ui_log(op, "Output of the kernel module build for the kernel '%s':\n\n%s",
+           k->name, k->output ? k->output : "");
 
-    /* Test to make sure that all kernel modules were built. */
     for (i = 0; i < p->num_kernel_modules; i++) {
-        if (!check_file(op, p, builddir, p->kernel_modules[i].module_name)) {
+        if (!check_file(op, p, k->builddir, p->kernel_modules[i].module_name)) {
             handle_optional_module_failure(op, p->kernel_modules[i], "build");
-            goto done;
+            return NULL;
+        }
+    }
+
+    if (!k->built) {
+        ui_error(op, "An error occurred while building the kernel modules "
+                 "for the kernel '%s'. See " DEFAULT_LOG_FILE_NAME
+                 " for details.", k->name);
+        return NULL;
+    }
+
+    info = nvalloc(sizeof(PrecompiledInfo));
+    info->version = nvstrdup(p->version);
+    info->proc_version_string = nvstrdup(k->proc_version_string);
+    info->description = nvstrdup(k->description);
+    info->files = nvalloc(sizeof(PrecompiledFileInfo) *
+                          (p->num_kernel_modules + 1));
+
+    for (i = 0; ret && i < p->num_kernel_modules; i++) {
+        PrecompiledFileInfo *fileInfo = info->files + i;
+        KernelModuleInfo *module = p->kernel_modules + i;
+
+        if (module->has_separate_interface_file) {
+            ret = pack_kernel_interface(op, p, k->builddir, fileInfo,
+                                        module->interface_filename,
+                                        module->module_filename,
+                                        module->core_object_name);
+        } else {
+            ret = pack_kernel_module(op, k->builddir, fileInfo,
+                                     module->module_filename);
+        }
+
+        if (ret) {
+            info->num_files++;
         }
     }
 
-    /*
-     * Now check the status of the overall build: it may have failed, despite
-     * having produced all expected kernel modules.
-     */
     if (!ret) {
-        goto done;
+        free_precompiled(info);
+        return NULL;
     }
 
-    ui_log(op, "Kernel module compilation complete.");
+    return info;
+}
 
-    /*
-     * If we're not building interfaces, return the number of built modules
-     * instead of the number of packaged interfaces.
-     */
-    if (fileInfos == NULL) {
-        /* If we've made it this far, all the modules were built. */
-        files_packaged = p->num_kernel_modules;
-        goto done;
+
+/*
+ * build_multiple_kernel_interfaces() - build the precompiled kernel
+ * interfaces for each of the kernels in the comma-separated list
+ * 'kernel_list' (see resolve_target_kernel() for the format of its
+ * entries), and return them as a newly allocated multi-kernel bundle, or
+ * NULL if any of the kernels failed.
+ *
+ * Each kernel is built in its own copy of the kernel module sources.  The
+ * kernel sources are checked and the sanity checks are run for one kernel
+ * at a time, but the builds themselves run concurrently.
+ */
+
+PrecompiledInfo *build_multiple_kernel_interfaces(Options *op, Package *p,
+                                                  const char *kernel_list)
+{
+    char *list, *entry, *saveptr = NULL, *tmpdir;
+    char *kernel_source_path = op->kernel_source_path;
+    char *kernel_output_path = op->kernel_output_path;
+    TargetKernel *kernels = NULL;
+    PrecompiledInfo *bundle = NULL;
+    int num_kernels = 0, ret = TRUE, i;
+
+    list = nvstrdup(kernel_list);
+
+    for (entry = strtok_r(list, ",", &saveptr); entry;
+         entry = strtok_r(NULL, ",", &saveptr)) {
+        kernels = nvrealloc(kernels, (num_kernels + 1) * sizeof(TargetKernel));
+        memset(&kernels[num_kernels], 0, sizeof(TargetKernel));
+        kernels[num_kernels++].name = nvstrdup(entry);
     }
 
-    *fileInfos = nvalloc(sizeof(PrecompiledFileInfo) *
-        (p->num_kernel_modules + 1));
+    nvfree(list);
 
-    for (files_packaged = 0;
-         files_packaged < p->num_kernel_modules;
-         files_packaged++) {
-        PrecompiledFileInfo *fileInfo = *fileInfos + files_packaged;
-        KernelModuleInfo *module = p->kernel_modules + files_packaged;
+    if (num_kernels == 0) {
+        ui_error(op, "No kernels were given to build precompiled kernel "
+                 "interfaces for.");
+        return NULL;
+    }
 
-        if (module->has_separate_interface_file) {
-            if (!(run_make(op, p, tmpdir, module->interface_filename,
-                           NULL, NULL, 0) &&
-                pack_kernel_interface(op, p, tmpdir, fileInfo,
-                                      module->interface_filename,
-                                      module->module_filename,
-                                      module->core_object_name))) {
-                goto done;
+    tmpdir = make_tmpdir(op);
+
+    if (!tmpdir) {
+        ui_error(op, "Unable to create a temporary build directory.");
+        ret = FALSE;
+    }
+
+    for (i = 0; ret && i < num_kernels; i++) {
+        char *builddir = nvasprintf("%s/kernel-%d", tmpdir, i);
+
+        ret = resolve_target_kernel(op, &kernels[i]) &&
+              prepare_target_kernel(op, p, &kernels[i], builddir);
+        nvfree(builddir);
+    }
+
+    if (ret) {
+        run_target_kernel_builds(op, p, kernels, num_kernels);
+
+        bundle = nvalloc(sizeof(PrecompiledInfo));
+        bundle->version = nvstrdup(p->version);
+        bundle->proc_version_string = nvstrdup("");
+        bundle->description = nvstrdup("");
+
+        for (i = 0; i < num_kernels; i++) {
+            PrecompiledInfo *info;
+
+            select_target_kernel(op, &kernels[i]);
+            info = pack_target_kernel(op, p, &kernels[i]);
+
+            if (!info) {
+                free_precompiled(bundle);
+                bundle = NULL;
+                break;
             }
-        } else if (!pack_kernel_module(op, tmpdir, fileInfo,
-                                       module->module_filename)) {
-                goto done;
+
+            precompiled_bundle_add(bundle, info);
         }
     }
 
-done:
-
-    if (files_packaged == 0 && fileInfos) {
-        nvfree(*fileInfos);
-        *fileInfos = NULL;
+    for (i = 0; i < num_kernels; i++) {
+        nvfree(kernels[i].name);
+        nvfree(kernels[i].source_path);
+        nvfree(kernels[i].output_path);
+        nvfree(kernels[i].proc_version_string);
+        nvfree(kernels[i].description);
+        nvfree(kernels[i].builddir);
+        nvfree(kernels[i].output);
     }
+    nvfree(kernels);
 
     if (tmpdir) {
         remove_directory(op, tmpdir);
         nvfree(tmpdir);
     }
 
-    return files_packaged;
+    op->kernel_source_path = kernel_source_path;
+    op->kernel_output_path = kernel_output_path;
+
+    return bundle;
 }
 
 
@@ -2034,16 +3611,15 @@ int rmmod_kernel_module(Options *op, const char *module_name)
 
 
 /*
- * check_cc_version() - check if the selected or default system
- * compiler is compatible with the one that was used to build the
- * currently running kernel.
+ * report_cc_version_check() - handle the result of the cc_version_check
+ * conftest: if it failed, ask the user whether to ignore the mismatch.  If
+ * the mismatch is ignored, or the check was skipped, set IGNORE_CC_MISMATCH
+ * for the kernel module build.  Returns FALSE if the installation should be
+ * aborted.
  */
 
-static int check_cc_version(Options *op, Package *p)
+static int report_cc_version_check(Options *op, int ret, const char *result)
 {
-    char *result;
-    int ret;
-
     /* 
      * If we're building/installing for a different kernel, then we
      * can't do the gcc version check (we don't have a /proc/version
@@ -2057,9 +3633,6 @@ static int check_cc_version(Options *op, Package *p)
         return TRUE;
     }
 
-    ret = run_conftest(op, p->kernel_module_build_directory,
-                       "cc_version_check just_msg", &result);
-
     if (!ret) {
         const char *choices[2] = {
             "Ignore CC version check",
@@ -2074,17 +3647,37 @@ static int check_cc_version(Options *op, Package *p)
                                   "kernel, you may wish to abort installation, "
                                   "set the CC environment variable to the name "
                                   "of the compiler used to compile your kernel, "
-                                  "and restart installation.", result) == 0);
+                                  "and restart installation.",
+                                  result ? result : "") == 0);
 
         if (ret) {
             setenv("IGNORE_CC_MISMATCH", "1", 1);
-            ui_warn(op, "Ignoring CC version mismatch:\n\n%s", result);
+            ui_warn(op, "Ignoring CC version mismatch:\n\n%s",
+                    result ? result : "");
         }
     }
 
-    nvfree(result);
     return ret;
-} /* check_cc_version() */
+}
+
+
+/*
+ * report_sanity_check() - log the given sanity check; if the test failed,
+ * print the error message from the test.  Return the status from the test.
+ */
+
+static int report_sanity_check(Options *op, const char *sanity_check_name,
+                               int ret, const char *result)
+{
+    ui_log(op, "Performing %s check.", sanity_check_name);
+
+    if (!ret && result) {
+        ui_error(op, "The %s sanity check failed:\n\n%s",
+                 sanity_check_name, result);
+    }
+
+    return ret;
+}
 
 
 /*
@@ -2100,16 +3693,11 @@ int conftest_sanity_check(Options *op, const char *dir,
     char *result, *conftest_args;
     int ret;
 
-    ui_log(op, "Performing %s check.", sanity_check_name);
-
     conftest_args = nvstrcat(conftest_name, " just_msg", NULL);
     ret = run_conftest(op, dir, conftest_args, &result);
     nvfree(conftest_args);
 
-    if (!ret && result) {
-        ui_error(op, "The %s sanity check failed:\n\n%s",
-                 sanity_check_name, result);
-    }
+    ret = report_sanity_check(op, sanity_check_name, ret, result);
 
     nvfree(result);
     return ret;
@@ -2119,7 +3707,9 @@ int conftest_sanity_check(Options *op, const char *dir,
 
 /*
  * scan_dir() - scan through the specified directory for a matching
- * precompiled kernel interface.
+ * precompiled kernel interface.  If the directory has an up to date
+ * precompiled package index, only the packages it lists as candidates
+ * are read; otherwise, every file in the directory is probed.
  */
 
 static PrecompiledInfo *scan_dir(Options *op, Package *p,
@@ -2130,9 +3720,22 @@ static PrecompiledInfo *scan_dir(Options *op, Package *p,
     DIR *dir;
     struct dirent *ent;
     PrecompiledInfo *info = NULL;
-    char *filename;
+    char *filename, **candidates;
+    int i;
     
     if (!directory_name) return NULL;
+
+    candidates = precompiled_index_lookup(op, directory_name,
+                                          proc_version_string, p->version);
+    if (candidates) {
+        for (i = 0; !info && candidates[i]; i++) {
+            info = get_precompiled_info(op, candidates[i], proc_version_string,
+                                        p->version, search_filelist);
+        }
+        precompiled_free_index_lookup(candidates);
+
+        return info;
+    }
     
     dir = opendir(directory_name);
     if (!dir) return NULL;
@@ -2262,28 +3865,22 @@ char *get_machine_arch(Options *op)
 } /* get_machine_arch() */
 
 /*
- * Run `make` with the specified target and make variables. The variables
- * are given in the form of a NULL-terminated array of alternating key
- * and value strings, e.g. { "KEY1", "value1", "KEY2", "value2", NULL }.
- * If a 'status' string is given, then a ui_status progress bar is shown
- * using 'status' as the initial message, expecting 'lines' lines of output
- * from the make command.
+ * make_command() - build a `make` command line for the given flags, target
+ * and make variables, building against op->kernel_source_path and
+ * op->kernel_output_path.  See run_make() for the format of 'vars'.
  */
-static int run_make(Options *op, Package *p, const char *dir, const char *target,
-                    char **vars, const char *status, int lines) {
-    char *cmd, *concurrency, *data = NULL;
-    int i = 0, ret;
-
-    concurrency = nvasprintf(" -j%d ", op->concurrency_level);
+static char *make_command(Options *op, Package *p, const char *flags,
+                          const char *target, char **vars)
+{
+    char *cmd;
+    int i = 0;
 
-    cmd = nvstrcat("cd ", dir, "; ",
-                   op->utils[MAKE], " -k", concurrency, target,
+    cmd = nvstrcat(op->utils[MAKE], " -k", flags, target,
                    " NV_EXCLUDE_KERNEL_MODULES=\"",
                    p->excluded_kernel_modules, "\"",
                    " SYSSRC=\"", op->kernel_source_path, "\"",
                    " SYSOUT=\"", op->kernel_output_path, "\"",
                    NULL);
-    nvfree(concurrency);
 
     if (vars) {
         while (vars[i] && vars[i+1]) {
@@ -2295,6 +3892,29 @@ static int run_make(Options *op, Package *p, const char *dir, const char *target
         }
     }
 
+    return cmd;
+}
+
+
+/*
+ * Run `make` with the specified target and make variables. The variables
+ * are given in the form of a NULL-terminated array of alternating key
+ * and value strings, e.g. { "KEY1", "value1", "KEY2", "value2", NULL }.
+ * If a 'status' string is given, then a ui_status progress bar is shown
+ * using 'status' as the initial message, expecting 'lines' lines of output
+ * from the make command.
+ */
+static int run_make(Options *op, Package *p, const char *dir, const char *target,
+                    char **vars, const char *status, int lines) {
+    char *cmd, *make, *concurrency, *data = NULL;
+    int ret;
+
+    concurrency = nvasprintf(" -j%d ", op->concurrency_level);
+    make = make_command(op, p, concurrency, target, vars);
+    cmd = nvstrcat("cd ", dir, "; ", make, NULL);
+    nvfree(make);
+    nvfree(concurrency);
+
     if (status) {
         ui_status_begin(op, status, "");
     }
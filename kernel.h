@@ -38,6 +38,8 @@ int unpack_kernel_modules                          (Options*, Package*,
 int build_kernel_modules                           (Options*, Package*);
 int build_kernel_interfaces                        (Options*, Package*,
                                                     PrecompiledFileInfo **);
+PrecompiledInfo *build_multiple_kernel_interfaces  (Options*, Package*,
+                                                    const char *);
 int test_kernel_modules                            (Options*, Package*);
 int load_kernel_module                             (Options*, const char*);
 int check_for_unloaded_kernel_module               (Options*);
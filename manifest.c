@@ -18,6 +18,7 @@
  */
 
 #include <string.h>
+#include <pthread.h>
 
 #include "manifest.h"
 
@@ -130,27 +131,68 @@ static const struct {
 };
 
 /*
- * Scan packageEntryFileTypeTable[] for the given file type. If we find
- * it, return the capabilities for the type.
+ * Lookup tables built from packageEntryFileTypeTable[]: an open-addressed
+ * hash of the type names, used to parse the flag field of every .manifest
+ * entry, and a direct index from file type to table entry.  Both store
+ * table indices plus one, so that zero marks an empty slot.  They are
+ * built once, with pthread_once(), on first use.
+ */
+
+#define FILE_TYPE_NAME_HASH_SIZE 128 /* power of two, >= 2x table length */
+
+static unsigned char fileTypeNameHash[FILE_TYPE_NAME_HASH_SIZE];
+static unsigned char fileTypeIndex[FILE_TYPE_MAX];
+static pthread_once_t fileTypeTablesOnce = PTHREAD_ONCE_INIT;
+
+static unsigned int hash_file_type_name(const char *str)
+{
+    unsigned int h = 2166136261u; /* 32-bit FNV-1a */
+
+    while (*str) {
+        h ^= (unsigned char) *str++;
+        h *= 16777619u;
+    }
+
+    return h & (FILE_TYPE_NAME_HASH_SIZE - 1);
+}
+
+static void init_file_type_tables(void)
+{
+    int i;
+
+    for (i = 0; i < ARRAY_LEN(packageEntryFileTypeTable); i++) {
+        unsigned int h = hash_file_type_name(packageEntryFileTypeTable[i].name);
+
+        while (fileTypeNameHash[h]) {
+            h = (h + 1) & (FILE_TYPE_NAME_HASH_SIZE - 1);
+        }
+        fileTypeNameHash[h] = i + 1;
+
+        fileTypeIndex[packageEntryFileTypeTable[i].type] = i + 1;
+    }
+}
+
+/*
+ * Look up the given file type in packageEntryFileTypeTable[]. If we
+ * find it, return the capabilities for the type.
  */
 PackageEntryFileCapabilities get_file_type_capabilities(
     PackageEntryFileType type
 )
 {
-    int i;
     PackageEntryFileCapabilities nullCaps = { F, F, F, F, F, F, F, F, F };
 
-    for (i = 0; i < ARRAY_LEN(packageEntryFileTypeTable); i++) {
-        if (type == packageEntryFileTypeTable[i].type) {
-            return packageEntryFileTypeTable[i].caps;
-        }
+    pthread_once(&fileTypeTablesOnce, init_file_type_tables);
+
+    if (type >= 0 && type < FILE_TYPE_MAX && fileTypeIndex[type]) {
+        return packageEntryFileTypeTable[fileTypeIndex[type] - 1].caps;
     }
 
     return nullCaps;
 }
 
 /*
- * Scan packageEntryFileTypeTable[] for the given string.  If we find
+ * Look up the given string in packageEntryFileTypeTable[].  If we find
  * it, return the corresponding type and assign the capabilities for
  * the type.
  */
@@ -159,9 +201,14 @@ PackageEntryFileType parse_manifest_file_type(
     PackageEntryFileCapabilities *caps
 )
 {
-    int i;
+    unsigned int h;
+
+    pthread_once(&fileTypeTablesOnce, init_file_type_tables);
+
+    for (h = hash_file_type_name(str); fileTypeNameHash[h];
+         h = (h + 1) & (FILE_TYPE_NAME_HASH_SIZE - 1)) {
+        int i = fileTypeNameHash[h] - 1;
 
-    for (i = 0; i < ARRAY_LEN(packageEntryFileTypeTable); i++) {
         if (strcmp(str, packageEntryFileTypeTable[i].name) == 0) {
             *caps = packageEntryFileTypeTable[i].caps;
             return packageEntryFileTypeTable[i].type;
@@ -21,6 +21,8 @@
  * by the nvidia-installer.
  */
 
+#define _GNU_SOURCE /* needed for pipe2 */
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -30,24 +32,32 @@
 #include <sys/types.h>
 #include <sys/utsname.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <ctype.h>
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <dirent.h>
 #include <libgen.h>
+#include <poll.h>
+#include <spawn.h>
+#include <time.h>
 #include <pciaccess.h>
 #include <elf.h>
+#include <stddef.h>
 #include <link.h>
 
 #include "nvidia-installer.h"
 #include "user-interface.h"
 #include "kernel.h"
 #include "files.h"
+#include "backup.h"
 #include "misc.h"
 #include "crc.h"
 #include "nvLegacy.h"
 #include "manifest.h"
 
+extern char **environ;
+
 static int check_symlink(Options*, const char*, const char*, const char*);
 
 
@@ -221,37 +231,215 @@ char *get_next_line(char *buf, char **end, char *start, int length)
 
 
 /*
- * run_command() - this function runs the given command and assigns
- * the data parameter to a malloced buffer containing the command's
- * output, if any.  The caller of this function should free the data
- * string.  The return value of the command is returned from this
- * function.
- *
- * The output parameter controls whether command output is sent to the
- * ui; if this is TRUE, then everyline of output that is read is sent
- * to the ui.
- *
- * If the status parameter is greater than 0, it is interpreted as a
- * rough estimate of how many lines of output will be generated by the
- * command.  This is used to compute the value that should be passed
- * to ui_status_update() for every line of output that is received.
- *
- * The redirect argument tells run_command() to redirect stderr to
- * stdout so that all output is collected, or just stdout.
- *
- * XXX maybe we should do something to cap the time we allow the
- * command to run?
+ * command_locale_environment - the environment overlay applied to every
+ * command run by the installer: clear LANG and LC_ALL, to make sure
+ * command output that might need to be parsed doesn't vary based on
+ * system locale settings.
  */
 
-int run_command(Options *op, const char *cmd, char **data, int output,
-                int status, int redirect)
+static char *const command_locale_environment[] = { "LANG", "LC_ALL", NULL };
+
+
+/*
+ * environment_overlay_has() - return TRUE if the environment overlay env
+ * sets or removes the variable of the given "NAME=value" string.
+ */
+
+static int environment_overlay_has(char *const env[], const char *var)
+{
+    size_t len = strcspn(var, "=");
+    int i;
+
+    for (i = 0; env && env[i]; i++) {
+        if (strncmp(var, env[i], len) == 0 &&
+            (env[i][len] == '=' || env[i][len] == '\0')) {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+
+/*
+ * build_command_environment() - return the environment for a child
+ * process: the installer's environment, with command_locale_environment
+ * and then the given overlay applied.  Each "NAME=value" entry of env
+ * sets NAME, and each "NAME" entry (with no '=') removes it.  Only the
+ * returned array should be freed; its strings belong to the environment
+ * and the overlay.
+ */
+
+static char **build_command_environment(char *const env[])
+{
+    char **envp;
+    int i, j, n = 0;
+
+    for (i = 0; environ[i]; i++);
+    for (j = 0; env && env[j]; j++);
+
+    envp = nvalloc(sizeof(char *) * (i + j + 1));
+
+    for (i = 0; environ[i]; i++) {
+        if (!environment_overlay_has(command_locale_environment, environ[i]) &&
+            !environment_overlay_has(env, environ[i])) {
+            envp[n++] = environ[i];
+        }
+    }
+
+    for (j = 0; env && env[j]; j++) {
+        if (strchr(env[j], '=')) {
+            envp[n++] = env[j];
+        }
+    }
+
+    return envp;
+}
+
+
+
+/*
+ * spawn_command() - start the command described by argv with
+ * posix_spawnp(3), with its stdout (and its stderr, if redirect is TRUE)
+ * connected to a pipe, whose read end is returned in fd.  The environment
+ * overlay env, which may be NULL, is applied as described for
+ * build_command_environment().  If new_process_group is TRUE, the command
+ * is run in its own process group, so that it can be killed along with its
+ * children.  Returns the pid of the command, or -1 with errno set on
+ * failure.  This does not use the ui, so it may be called from any thread.
+ */
+
+pid_t spawn_command(char *const argv[], char *const env[], int redirect,
+                    int new_process_group, int *fd)
+{
+    posix_spawn_file_actions_t actions;
+    posix_spawnattr_t attr;
+    char **envp;
+    int fds[2], ret;
+    pid_t pid = -1;
+
+    /*
+     * create the pipe close-on-exec atomically, so that commands started
+     * concurrently by other threads do not inherit the write end and hold
+     * it open
+     */
+
+    if (pipe2(fds, O_CLOEXEC) != 0) {
+        return -1;
+    }
+
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    if (redirect) {
+        posix_spawn_file_actions_adddup2(&actions, fds[1], STDERR_FILENO);
+    }
+
+    posix_spawnattr_init(&attr);
+    if (new_process_group) {
+        posix_spawnattr_setpgroup(&attr, 0);
+        posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP);
+    }
+
+    envp = build_command_environment(env);
+
+    ret = posix_spawnp(&pid, argv[0], &actions, &attr, argv, envp);
+
+    nvfree(envp);
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+
+    if (ret != 0) {
+        close(fds[0]);
+        errno = ret;
+        return -1;
+    }
+
+    *fd = fds[0];
+
+    return pid;
+}
+
+
+
+/*
+ * wait_for_child() - wait for the given child process to exit, and
+ * return its wait status, or -1 on failure.
+ */
+
+int wait_for_child(pid_t pid)
+{
+    int status;
+
+    while (waitpid(pid, &status, 0) == -1) {
+        if (errno != EINTR) {
+            return -1;
+        }
+    }
+
+    return status;
+}
+
+
+
+/*
+ * read_command_output() - read the output of a command started with
+ * spawn_command() from fd until EOF, wait for the command to exit, and
+ * return its wait status, or -1 on failure.  The output is assigned to
+ * data, without its final newline; the caller should free it.  This does
+ * not use the ui, so it may be called from any thread.
+ */
+
+int read_command_output(pid_t pid, int fd, char **data)
+{
+    size_t len = 0, buflen = 0;
+    char *buf = NULL;
+    ssize_t n;
+
+    while (1) {
+        if ((buflen - len) < NV_MIN_LINE_LEN) {
+            buflen = buflen ? buflen * 2 : NV_LINE_LEN;
+            buf = nvrealloc(buf, buflen);
+        }
+
+        n = read(fd, buf + len, buflen - len - 1);
+
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+
+        len += n;
+    }
+
+    close(fd);
+
+    buf[len] = '\0';
+    if ((len > 0) && (buf[len-1] == '\n')) buf[len-1] = '\0';
+
+    *data = buf;
+
+    return wait_for_child(pid);
+}
+
+
+
+/*
+ * execute_command() - run the command described by argv, and collect its
+ * output; cmd is the description of the command used in messages.  See
+ * run_command() and run_command_argv() for the other parameters.
+ */
+
+static int execute_command(Options *op, const char *cmd, char *const argv[],
+                           char *const env[], char **data, int output,
+                           int status, int redirect, int timeout)
 {
-    int n, len, buflen, ret;
-    char *cmd2, *buf, *tmpbuf;
-    FILE *stream = NULL;
     struct sigaction act, old_act;
+    struct timespec deadline, now;
+    size_t len, buflen, line;
+    char *buf;
     float percent;
-    
+    int fd, n, ret, timed_out = FALSE;
+    pid_t pid;
+
     if (data) *data = NULL;
 
     /*
@@ -261,14 +449,6 @@ int run_command(Options *op, const char *cmd, char **data, int output,
 
     if (output) ui_command_output (op, "executing: '%s'...", cmd);
 
-    /* redirect stderr to stdout */
-
-    if (redirect) {
-        cmd2 = nvstrcat(cmd, " 2>&1", NULL);
-    } else {
-        cmd2 = nvstrdup(cmd);
-    }
-    
     /*
      * XXX: temporarily ignore SIGWINCH; our child process inherits
      * this disposition and will likewise ignore it (by default).
@@ -285,76 +465,114 @@ int run_command(Options *op, const char *cmd, char **data, int output,
     }
 
     /*
-     * Clear LANG and LC_ALL before running the command, to make sure
-     * command output that might need to be parsed doesn't vary based
-     * on system locale settings.
+     * A command run with a timeout gets its own process group, so that
+     * everything it started can be killed when the timeout expires.
      */
 
-    unsetenv("LANG");
-    unsetenv("LC_ALL");
+    pid = spawn_command(argv, env, redirect, timeout > 0, &fd);
 
+    if (pid == -1) {
+        ui_error(op, "Failure executing command '%s' (%s).", cmd,
+                 strerror(errno));
+        if (op->sigwinch_workaround)
+            sigaction(SIGWINCH, &old_act, NULL);
+        return -1;
+    }
 
-    /*
-     * Open a process by creating a pipe, forking, and invoking the
-     * command.
-     */
-    
-    stream = popen(cmd2, "r");
-    nvfree(cmd2);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
 
-    if (stream == NULL) {
-        ui_error(op, "Failure executing command '%s' (%s).",
-                 cmd, strerror(errno));
-        return errno;
-    }
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout;
 
     /*
-     * read from the stream, filling and growing buf, until we hit
-     * EOF.  Send each line to the ui as it is read.
+     * read from the pipe until we hit EOF, growing buf geometrically.
+     * Send each complete line to the ui as it is read.
      */
-    
+
     len = 0;    /* length of what has actually been read */
     buflen = 0; /* length of destination buffer */
+    line = 0;   /* offset of the first line not yet sent to the ui */
     buf = NULL;
     n = 0;      /* output line counter */
 
     while (1) {
-        
-        if ((buflen - len) < NV_MIN_LINE_LEN) {
-            buflen += NV_LINE_LEN;
-            tmpbuf = (char *) nvalloc(buflen);
-            if (buf) {
-                memcpy(tmpbuf, buf, len);
-                free(buf);
+        struct pollfd pfd;
+        int poll_timeout = -1;
+        ssize_t ret_read;
+        char *newline;
+
+        if (timeout > 0 && !timed_out) {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            poll_timeout = (deadline.tv_sec - now.tv_sec) * 1000 +
+                           (deadline.tv_nsec - now.tv_nsec) / 1000000;
+
+            if (poll_timeout <= 0) {
+                kill(-pid, SIGKILL);
+                timed_out = TRUE;
+                poll_timeout = -1;
             }
-            buf = tmpbuf;
         }
-        
-        if (fgets(buf + len, buflen - len, stream) == NULL) break;
-        
-        if (output) ui_command_output(op, "%s", buf + len);
-        
-        len += strlen(buf + len);
 
-        if (status) {
-            n++;
-            if (n > status) n = status;
-            percent = (float) n / (float) status;
+        if ((buflen - len) < NV_MIN_LINE_LEN) {
+            buflen = buflen ? buflen * 2 : NV_LINE_LEN;
+            buf = nvrealloc(buf, buflen);
+        }
 
-            /*
-             * XXX: manually call the SIGWINCH handler, if set, to
-             * handle window resizes while we ignore the signal.
-             */
-            if (op->sigwinch_workaround)
-                if (old_act.sa_handler) old_act.sa_handler(SIGWINCH);
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+
+        ret = poll(&pfd, 1, poll_timeout);
+
+        if (ret < 0 && errno != EINTR) break;
+        if (ret <= 0) continue;
+
+        ret_read = read(fd, buf + len, buflen - len - 1);
+
+        if (ret_read < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+        if (ret_read <= 0) break;
+
+        len += ret_read;
+        buf[len] = '\0';
+
+        while ((newline = memchr(buf + line, '\n', len - line)) != NULL) {
+            size_t end = (newline - buf) + 1;
+
+            if (output) ui_command_output(op, "%.*s", (int) (end - line),
+                                          buf + line);
+
+            line = end;
+
+            if (status) {
+                n++;
+                if (n > status) n = status;
+                percent = (float) n / (float) status;
+
+                /*
+                 * XXX: manually call the SIGWINCH handler, if set, to
+                 * handle window resizes while we ignore the signal.
+                 */
+                if (op->sigwinch_workaround)
+                    if (old_act.sa_handler) old_act.sa_handler(SIGWINCH);
 
-            ui_status_update(op, percent, NULL);
+                ui_status_update(op, percent, NULL);
+            }
         }
     } /* while (1) */
 
-    /* Close the popen()'ed stream. */
+    /* send a final line without a newline to the ui */
 
-    ret = pclose(stream);
+    if (output && line < len) {
+        ui_command_output(op, "%s", buf + line);
+    }
+
+    close(fd);
+
+    ret = wait_for_child(pid);
+
+    if (timed_out) {
+        ui_error(op, "The command '%s' did not complete within %d seconds, "
+                 "and was terminated.", cmd, timeout);
+    }
 
     /*
      * Restore the SIGWINCH signal disposition and handler, if any,
@@ -364,18 +582,110 @@ int run_command(Options *op, const char *cmd, char **data, int output,
         sigaction(SIGWINCH, &old_act, NULL);
 
     /* if the last character in the buffer is a newline, null it */
-    
+
     if ((len > 0) && (buf[len-1] == '\n')) buf[len-1] = '\0';
-    
+
     if (data) *data = buf;
     else free(buf);
-    
+
     return ret;
-    
+}
+
+
+
+/*
+ * run_command() - this function runs the given command and assigns
+ * the data parameter to a malloced buffer containing the command's
+ * output, if any.  The caller of this function should free the data
+ * string.  The return value of the command is returned from this
+ * function.
+ *
+ * The command is a shell command line, run by /bin/sh with LANG and
+ * LC_ALL cleared from its environment.
+ *
+ * The output parameter controls whether command output is sent to the
+ * ui; if this is TRUE, then everyline of output that is read is sent
+ * to the ui.
+ *
+ * If the status parameter is greater than 0, it is interpreted as a
+ * rough estimate of how many lines of output will be generated by the
+ * command.  This is used to compute the value that should be passed
+ * to ui_status_update() for every line of output that is received.
+ *
+ * The redirect argument tells run_command() to redirect stderr to
+ * stdout so that all output is collected, or just stdout.
+ */
+
+int run_command(Options *op, const char *cmd, char **data, int output,
+                int status, int redirect)
+{
+    char *cmd2;
+    int ret;
+
+    /* redirect stderr to stdout */
+
+    if (redirect) {
+        cmd2 = nvstrcat(cmd, " 2>&1", NULL);
+    } else {
+        cmd2 = nvstrdup(cmd);
+    }
+
+    {
+        char *const argv[] = { "/bin/sh", "-c", cmd2, NULL };
+
+        ret = execute_command(op, cmd, argv, NULL, data, output, status,
+                              FALSE, 0);
+    }
+
+    nvfree(cmd2);
+
+    return ret;
+
 } /* run_command() */
 
 
 
+/*
+ * run_command_argv() - like run_command(), but run the command described
+ * by the NULL-terminated argv directly rather than through the shell;
+ * argv[0] is searched for in PATH if it does not contain a '/'.
+ *
+ * The environment overlay env, which may be NULL, is applied to the
+ * command's environment as described for build_command_environment();
+ * the installer's own environment is not changed.
+ *
+ * If timeout is greater than 0, the command, along with any processes
+ * it started, is killed if it does not complete within that many
+ * seconds; such a command runs in its own process group, and so does
+ * not receive signals from the terminal.
+ */
+
+int run_command_argv(Options *op, char *const argv[], char *const env[],
+                     char **data, int output, int status, int redirect,
+                     int timeout)
+{
+    char *cmd;
+    int i, ret;
+
+    cmd = nvstrdup(argv[0]);
+    for (i = 1; argv[i]; i++) {
+        char *old = cmd;
+
+        cmd = nvstrcat(old, " ", argv[i], NULL);
+        nvfree(old);
+    }
+
+    ret = execute_command(op, cmd, argv, env, data, output, status,
+                          redirect, timeout);
+
+    nvfree(cmd);
+
+    return ret;
+
+} /* run_command_argv() */
+
+
+
 /*
  * read_text_file() - open a text file, read its contents and return
  * them to the caller in a newly allocated buffer.  Returns TRUE on
@@ -873,6 +1183,10 @@ int do_install(Options *op, Package *p, CommandList *c)
     ret = execute_command_list(op, c, msg, "Installing");
     
     free(msg);
+
+    /* commit the log entries for the installed files */
+
+    if (!close_backup_log(op)) ret = FALSE;
     
     if (!ret) return FALSE;
     
@@ -1194,7 +1508,7 @@ void check_installed_files_from_package(Options *op, Package *p)
             }
         } else if (installable_files.types[p->entries[i].type]) {
             if (!check_installed_file(op, p->entries[i].dst,
-                                      p->entries[i].mode, 0, ui_warn)) {
+                                      p->entries[i].mode, 0, NULL, ui_warn)) {
                 ret = FALSE;
             }
         }
@@ -1301,11 +1615,127 @@ int verify_crc(Options *op, const char *filename, unsigned int crc,
 
 
 
+/*
+ * get_file_metadata() - fill in metadata from the given stat buffer.
+ */
+
+void get_file_metadata(const struct stat *stat_buf, FileMetadata *metadata)
+{
+    metadata->valid = TRUE;
+    metadata->size = stat_buf->st_size;
+    metadata->mtime_ns = (uint64_t) stat_buf->st_mtim.tv_sec * 1000000000ULL +
+                         stat_buf->st_mtim.tv_nsec;
+    metadata->ino = stat_buf->st_ino;
+    metadata->dev = stat_buf->st_dev;
+}
+
+
+
+/*
+ * file_metadata_unchanged() - returns TRUE if --fast-validate is in
+ * effect and the file described by stat_buf still has the recorded
+ * metadata, i.e. its checksum does not need to be verified.
+ */
+
+int file_metadata_unchanged(Options *op, const FileMetadata *metadata,
+                            const struct stat *stat_buf)
+{
+    FileMetadata current;
+
+    if (!op->fast_validate || op->paranoid_validate ||
+        !metadata || !metadata->valid) {
+        return FALSE;
+    }
+
+    get_file_metadata(stat_buf, &current);
+
+    return current.size == metadata->size &&
+           current.mtime_ns == metadata->mtime_ns &&
+           current.ino == metadata->ino &&
+           current.dev == metadata->dev;
+}
+
+
+
+/*
+ * init_file_id_set() - initialize a FileIdSet for up to 'num' files.  The
+ * set is freed with nvfree(set->slots).
+ */
+
+void init_file_id_set(FileIdSet *set, int num)
+{
+    unsigned int size = 16;
+
+    /* keep the load factor at or below 1/2 */
+
+    while (size < (unsigned int) num * 2) size <<= 1;
+
+    set->slots = nvalloc(sizeof(FileIdSlot) * size);
+    set->mask = size - 1;
+}
+
+
+static unsigned int file_id_slot(const FileIdSet *set, dev_t device,
+                                 ino_t inode)
+{
+    uint64_t key = ((uint64_t) device * 0x9e3779b97f4a7c15ULL) ^
+                   (uint64_t) inode;
+    unsigned int h;
+
+    key ^= key >> 31;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 29;
+
+    for (h = (unsigned int) key & set->mask; set->slots[h].used;
+         h = (h + 1) & set->mask) {
+        if (set->slots[h].device == device && set->slots[h].inode == inode) {
+            break;
+        }
+    }
+
+    return h;
+}
+
+
+/*
+ * add_file_id() - add (device, inode) to the set; returns FALSE if it
+ * was already present.
+ */
+
+int add_file_id(FileIdSet *set, dev_t device, ino_t inode)
+{
+    unsigned int h = file_id_slot(set, device, inode);
+
+    if (set->slots[h].used) {
+        return FALSE;
+    }
+
+    set->slots[h].device = device;
+    set->slots[h].inode = inode;
+    set->slots[h].used = TRUE;
+
+    return TRUE;
+}
+
+
+/*
+ * find_file_id() - returns TRUE if (device, inode) is in the set.
+ */
+
+int find_file_id(const FileIdSet *set, dev_t device, ino_t inode)
+{
+    return set->slots[file_id_slot(set, device, inode)].used;
+}
+
+
+
 /*
  * check_installed_file() - check that the specified installed file exists,
  * has the correct permissions, and has the correct crc. Takes a function
  * pointer to either ui_log() or ui_warn() depending on how errors should
- * be reported.
+ * be reported.  If metadata recorded at installation time is given, and
+ * the file still matches it, the crc check is skipped in --fast-validate
+ * mode.
  *
  * If anything is incorrect, print a warning and return FALSE,
  * otherwise return TRUE.
@@ -1313,10 +1743,30 @@ int verify_crc(Options *op, const char *filename, unsigned int crc,
 
 int check_installed_file(Options *op, const char *filename,
                          const mode_t mode, const uint32 crc,
+                         const FileMetadata *metadata,
                          ui_message_func *logwarn)
+{
+    return check_installed_file_with_crc(op, filename, mode, crc, metadata,
+                                         NULL, logwarn);
+}
+
+
+
+/*
+ * check_installed_file_with_crc() - same as check_installed_file(), but
+ * if precomputed_crc is non-NULL, it is used as the current CRC of the
+ * file instead of computing it.
+ */
+
+int check_installed_file_with_crc(Options *op, const char *filename,
+                                  const mode_t mode, const uint32 crc,
+                                  const FileMetadata *metadata,
+                                  const uint32 *precomputed_crc,
+                                  ui_message_func *logwarn)
 {
     struct stat stat_buf;
     uint32 actual_crc;
+    int crc_ok;
 
     if (lstat(filename, &stat_buf) == -1) {
         logwarn(op, "Unable to find installed file '%s' (%s).",
@@ -1342,7 +1792,18 @@ int check_installed_file(Options *op, const char *filename,
     }
 
 
-    if (!verify_crc(op, filename, crc, &actual_crc)) {
+    if (crc != 0 && file_metadata_unchanged(op, metadata, &stat_buf)) {
+        return TRUE;
+    }
+
+    if (crc != 0 && precomputed_crc) {
+        actual_crc = *precomputed_crc;
+        crc_ok = (actual_crc == crc);
+    } else {
+        crc_ok = verify_crc(op, filename, crc, &actual_crc);
+    }
+
+    if (!crc_ok) {
         int ret;
 
         /* If this is not an ELF file, we should not try to unprelink it. */
@@ -2876,6 +3337,101 @@ ElfFileType get_elf_architecture(const char *filename)
 
 
 
+/*
+ * clear_executable_stack() - clear the PF_X flag of the PT_GNU_STACK
+ * program header of the given ELF file in place, like `execstack -c`.
+ * Returns FALSE if the file could not be changed in place: if it is not
+ * an ELF file in the host's byte order, or has no PT_GNU_STACK program
+ * header (which `execstack -c` would add).  This does not use the ui, so
+ * it may be called from any thread.
+ */
+
+int clear_executable_stack(const char *filename)
+{
+    static const uint16_t one = 1;
+    unsigned char ident[EI_NIDENT];
+    uint64_t phoff, offset;
+    unsigned int phnum, phentsize, i;
+    int fd, is_64, ret = FALSE;
+
+    fd = open(filename, O_RDWR | O_CLOEXEC);
+    if (fd == -1) return FALSE;
+
+    if (pread(fd, ident, EI_NIDENT, 0) != EI_NIDENT ||
+        memcmp(ident, ELFMAG, SELFMAG) != 0 ||
+        ident[EI_DATA] != (*(const unsigned char *) &one ? ELFDATA2LSB :
+                                                           ELFDATA2MSB)) {
+        goto done;
+    }
+
+    if (ident[EI_CLASS] == ELFCLASS64) {
+        Elf64_Ehdr header;
+
+        if (pread(fd, &header, sizeof(header), 0) != sizeof(header)) goto done;
+        phoff = header.e_phoff;
+        phnum = header.e_phnum;
+        phentsize = header.e_phentsize;
+        is_64 = TRUE;
+    } else if (ident[EI_CLASS] == ELFCLASS32) {
+        Elf32_Ehdr header;
+
+        if (pread(fd, &header, sizeof(header), 0) != sizeof(header)) goto done;
+        phoff = header.e_phoff;
+        phnum = header.e_phnum;
+        phentsize = header.e_phentsize;
+        is_64 = FALSE;
+    } else {
+        goto done;
+    }
+
+    if (phentsize < (is_64 ? sizeof(Elf64_Phdr) : sizeof(Elf32_Phdr)) ||
+        phnum == PN_XNUM) {
+        goto done;
+    }
+
+    for (i = 0; i < phnum; i++) {
+        uint32_t type, flags;
+        off_t flags_offset;
+
+        offset = phoff + (uint64_t) i * phentsize;
+
+        if (is_64) {
+            Elf64_Phdr phdr;
+
+            if (pread(fd, &phdr, sizeof(phdr), offset) != sizeof(phdr)) break;
+            type = phdr.p_type;
+            flags = phdr.p_flags;
+            flags_offset = offset + offsetof(Elf64_Phdr, p_flags);
+        } else {
+            Elf32_Phdr phdr;
+
+            if (pread(fd, &phdr, sizeof(phdr), offset) != sizeof(phdr)) break;
+            type = phdr.p_type;
+            flags = phdr.p_flags;
+            flags_offset = offset + offsetof(Elf32_Phdr, p_flags);
+        }
+
+        if (type != PT_GNU_STACK) continue;
+
+        if (flags & PF_X) {
+            flags &= ~PF_X;
+            ret = (pwrite(fd, &flags, sizeof(flags), flags_offset) ==
+                   sizeof(flags));
+        } else {
+            ret = TRUE;
+        }
+        break;
+    }
+
+ done:
+
+    close(fd);
+
+    return ret;
+}
+
+
+
 /*
  * set_concurrency_level() - automatically determine the concurrency level,
  * if the user has not specified it.
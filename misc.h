@@ -50,6 +50,39 @@ typedef enum {
     ELF_ARCHITECTURE_64,
 } ElfFileType;
 
+
+/*
+ * File metadata recorded in the backup log, used to skip checksumming
+ * files that have not been touched when --fast-validate is given.
+ */
+
+typedef struct {
+    int valid;
+    uint64_t size;
+    uint64_t mtime_ns;
+    uint64_t ino;
+    uint64_t dev;
+} FileMetadata;
+
+
+/*
+ * FileIdSet: open addressing hash set of (device, inode) pairs, used to
+ * identify files in constant time.
+ */
+
+typedef struct {
+    dev_t device;
+    ino_t inode;
+    int used;
+} FileIdSlot;
+
+typedef struct {
+    FileIdSlot *slots;
+    unsigned int mask;
+} FileIdSet;
+
+struct stat;
+
 char *read_next_word (char *buf, char **e);
 
 int check_euid(Options *op);
@@ -57,6 +90,13 @@ int adjust_cwd(Options *op, const char *program_name);
 char *get_next_line(char *buf, char **e, char *start, int length);
 int run_command(Options *op, const char *cmd, char **data,
                 int output, int status, int redirect);
+int run_command_argv(Options *op, char *const argv[], char *const env[],
+                     char **data, int output, int status, int redirect,
+                     int timeout);
+pid_t spawn_command(char *const argv[], char *const env[], int redirect,
+                    int new_process_group, int *fd);
+int wait_for_child(pid_t pid);
+int read_command_output(pid_t pid, int fd, char **data);
 int read_text_file(const char *filename, char **buf);
 char *find_system_util(const char *util);
 int find_system_utils(Options *op);
@@ -74,7 +114,18 @@ void should_install_optional_modules(Options *op, Package *p,
                                      int num_optional_modules);
 void check_installed_files_from_package(Options *op, Package *p);
 int check_installed_file(Options*, const char*, const mode_t, const uint32,
+                         const FileMetadata *metadata,
                          ui_message_func *logwarn);
+int check_installed_file_with_crc(Options*, const char*, const mode_t,
+                                  const uint32, const FileMetadata *metadata,
+                                  const uint32 *precomputed_crc,
+                                  ui_message_func *logwarn);
+void get_file_metadata(const struct stat *stat_buf, FileMetadata *metadata);
+void init_file_id_set(FileIdSet *set, int num);
+int add_file_id(FileIdSet *set, dev_t device, ino_t inode);
+int find_file_id(const FileIdSet *set, dev_t device, ino_t inode);
+int file_metadata_unchanged(Options *op, const FileMetadata *metadata,
+                            const struct stat *stat_buf);
 int check_runtime_configuration(Options *op, Package *p);
 void collapse_multiple_slashes(char *s);
 int is_symbolic_link_to(const char *path, const char *dest);
@@ -92,6 +143,7 @@ int verify_crc(Options *op, const char *filename, unsigned int crc,
                unsigned int *actual_crc);
 int secure_boot_enabled(void);
 ElfFileType get_elf_architecture(const char *filename);
+int clear_executable_stack(const char *filename);
 void set_concurrency_level(Options *op);
 
 #endif /* __NVIDIA_INSTALLER_MISC_H__ */
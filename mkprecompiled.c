@@ -64,6 +64,9 @@ typedef struct {
     char *proc_version_string;
     char *proc_mount_point;
     char *version;
+    int format_version;
+    int num_packages;
+    char **packages;
     int num_files;
     struct __precompiled_file_info *new_files;
     struct __precompiled_info *package;
@@ -131,13 +134,17 @@ static void print_help(void)
            "    -u | --unpack   unpack files from a package\n"
            "    -i | --info     display information about a package\n"
            "    -m | --match    check if a package matches the running kernel\n"
+           "    --pack-multi    create a multi-kernel bundle from packages\n"
+           "    --merge         add the kernels of packages to a bundle\n"
            "    -h | --help     print this help text and exit\n\n"
            "<package-file> is the package file to pack/unpack/test. It must be\n"
            "an existing, valid package file for the --unpack, --info, and\n"
            "--match actions. For the --pack action, if <package-file> does not\n"
            "exist, it is created; if it exists but is not a valid package file,\n"
            "it is overwritten; and if it exists and is a valid package file,\n"
-           "files will be added to the existing package.\n\n"
+           "files will be added to the existing package. For the --pack-multi\n"
+           "action, <package-file> is created or overwritten; for the --merge\n"
+           "action, it is created if it is not a valid package file.\n\n"
            "--pack options:\n"
            "    -v | --driver-version      (REQUIRED for new packages)\n"
            "        The version of the packaged components.\n"
@@ -147,6 +154,12 @@ static void print_help(void)
            "        file on the current system.\n"
            "    -d | --description         (RECOMMENDED for new packages)\n"
            "        A human readable description of the package.\n"
+           "    --format-version <2|3>\n"
+           "        The package format version to write. Version 3 packages\n"
+           "        store files compressed, and can only be read by\n"
+           "        nvidia-installer versions that support the format.\n"
+           "        Default: the format of the existing package, or version 3\n"
+           "        for new packages.\n"
            "    --kernel-interface <file> --linked-module-name <module-name>\\\n"
            "                              --core-object-name <core-name>\\\n"
            "                            [ --linked-module <linked-kmod-file> \\\n"
@@ -190,10 +203,35 @@ static void print_help(void)
            "    package file will be updated with new ones. At least one file\n"
            "    must be given with either --kernel-interface or --kernel-module\n"
            "    when using the --pack option.\n\n"
+           "    After packing, the index of the packages in the directory\n"
+           "    containing <package-file> (the '" PRECOMPILED_INDEX_FILENAME "'\n"
+           "    file) is updated, so that nvidia-installer can find matching\n"
+           "    packages without reading every file in the directory.\n\n"
+           "--pack-multi and --merge options:\n"
+           "    --package <file>\n"
+           "        Add the kernels of the package or bundle <file> to the\n"
+           "        bundle. This option may be given several times, and at\n"
+           "        least once. All packages must have the same driver\n"
+           "        version. A kernel already in the bundle is replaced by a\n"
+           "        kernel with the same proc version string; with --merge,\n"
+           "        an existing single kernel package is converted into a\n"
+           "        bundle first.\n"
+           "    -d | --description\n"
+           "        A human readable description of the bundle.\n\n"
+           "    A bundle holds the files of several kernels in a single file,\n"
+           "    with a table of its kernels which nvidia-installer searches\n"
+           "    for the running kernel. Files which are identical for several\n"
+           "    kernels are stored only once. Files cannot be added to a\n"
+           "    bundle with --pack; pack them into a package of their own and\n"
+           "    --merge it into the bundle instead. The index of the\n"
+           "    directory containing the bundle is updated as for --pack.\n\n"
            "--unpack options:\n"
            "    -o | --output-directory\n"
            "        The target directory where files will be unpacked. Default:\n"
-           "        unpack files in the current directory.\n\n"
+           "        unpack files in the current directory.\n"
+           "    -P | --proc-version-string\n"
+           "        For bundles (REQUIRED), the proc version string of the\n"
+           "        kernel whose files will be unpacked.\n\n"
            "Additional options:\n"
            "    --proc-mount-point\n"
            "        The procfs mount point on the current system, where the \n"
@@ -214,7 +252,11 @@ enum {
     LINKED_AND_SIGNED_MODULE_OPTION,
     LINKED_MODULE_NAME_OPTION,
     CORE_OBJECT_NAME_OPTION,
-    TARGET_DIRECTORY_OPTION
+    TARGET_DIRECTORY_OPTION,
+    FORMAT_VERSION_OPTION,
+    PACK_MULTI_OPTION,
+    MERGE_OPTION,
+    PACKAGE_OPTION
 };
 
 
@@ -326,14 +368,14 @@ static void pack_a_file(Options *op, PrecompiledFileInfo *file,
         }
 
         if (!precompiled_read_interface(file, name, *linked_name, *core_name,
-                                        *target_directory)) {
+                                        *target_directory, FALSE)) {
             fprintf(stderr, "Failed to read kernel interface '%s'.\n", name);
         exit(1);
         }
         break;
 
     case PRECOMPILED_FILE_TYPE_MODULE:
-        if (!precompiled_read_module(file, name, *target_directory)) {
+        if (!precompiled_read_module(file, name, *target_directory, FALSE)) {
             fprintf(stderr, "Failed to read kernel module '%s'.\n", name);
         }
         break;
@@ -403,6 +445,14 @@ static Options *parse_commandline(int argc, char *argv[])
                                          NVGETOPT_STRING_ARGUMENT, NULL, NULL },
         { "target-directory",    TARGET_DIRECTORY_OPTION,
                                          NVGETOPT_STRING_ARGUMENT, NULL, NULL },
+        { "format-version",      FORMAT_VERSION_OPTION,
+                                         NVGETOPT_STRING_ARGUMENT, NULL, NULL },
+        { "pack-multi",          PACK_MULTI_OPTION,
+                                         NVGETOPT_STRING_ARGUMENT, NULL, NULL },
+        { "merge",               MERGE_OPTION,
+                                         NVGETOPT_STRING_ARGUMENT, NULL, NULL },
+        { "package",             PACKAGE_OPTION,
+                                         NVGETOPT_STRING_ARGUMENT, NULL, NULL },
         { NULL,                  0,   0,                        NULL, NULL }
     };
 
@@ -428,10 +478,17 @@ static Options *parse_commandline(int argc, char *argv[])
 
         switch(c) {
         case PACK: case UNPACK: case INFO: case MATCH:
+        case PACK_MULTI_OPTION: case MERGE_OPTION:
             set_action(op, c);
             op->package_file = strval;
             break;
 
+        case PACKAGE_OPTION:
+            op->packages = nvrealloc(op->packages, (op->num_packages + 1) *
+                                     sizeof(char *));
+            op->packages[op->num_packages++] = strval;
+            break;
+
         case 'h': print_help(); exit(0); break;
         case 'f': op->package_file = strval; break;
         case 'd': op->description = strval; break;
@@ -440,6 +497,16 @@ static Options *parse_commandline(int argc, char *argv[])
         case 'P': op->proc_version_string = strval; break;
         case PROC_MOUNT_POINT_OPTION: op->proc_mount_point = strval; break;
 
+        case FORMAT_VERSION_OPTION:
+            op->format_version = atoi(strval);
+            if (op->format_version != PRECOMPILED_PKG_VERSION_2 &&
+                op->format_version != PRECOMPILED_PKG_VERSION_3) {
+                fprintf(stderr, "Invalid package format version '%s'; %s",
+                        strval, see_help);
+                exit(1);
+            }
+            break;
+
         case KERNEL_INTERFACE_OPTION: case KERNEL_MODULE_OPTION:
 
             grow_file_array(op, &file_array_size);
@@ -517,7 +584,8 @@ static Options *parse_commandline(int argc, char *argv[])
 
     if (!op->action) {
         fprintf(stderr, "No action specified; one of --pack, --unpack, --info, "
-                "or --match options must be given. %s", see_help);
+                "--match, --pack-multi, or --merge options must be given. %s",
+                see_help);
         exit(1);
     }
 
@@ -535,6 +603,15 @@ static Options *parse_commandline(int argc, char *argv[])
         }
         break;
 
+    case PACK_MULTI_OPTION: case MERGE_OPTION:
+        if (op->num_packages < 1) {
+            fprintf(stderr, "At least one package must be specified with the "
+                    "--package option when creating or merging a bundle; %s",
+                    see_help);
+            exit(1);
+        }
+        break;
+
     case UNPACK:
         if (!op->output_directory) {
             op->output_directory = ".";
@@ -545,9 +622,13 @@ static Options *parse_commandline(int argc, char *argv[])
         break;
     }
 
+    if (op->action == PACK_MULTI_OPTION) {
+        return op;
+    }
+
     op->package = get_precompiled_info(op, op->package_file, NULL, NULL, NULL);
 
-    if (!op->package && op->action != PACK) {
+    if (!op->package && op->action != PACK && op->action != MERGE_OPTION) {
         fprintf(stderr, "Unable to read package file '%s'.\n",
                 op->package_file);
         exit(1);
@@ -561,14 +642,25 @@ static Options *parse_commandline(int argc, char *argv[])
 
 
 /*
- * check_match() - read /proc/version, and do a strcmp with str.
+ * check_match() - read /proc/version, and do a strcmp with the proc version
+ * string of the package, or those of the kernels of a bundle.
  * Returns 1 if the strings match, 0 if they don't match.
  */
 
-static int check_match(Options *op, char *str)
+static int check_match(Options *op, const PrecompiledInfo *package)
 {
-    int ret = 0;
+    int ret = 0, i;
     char *version = read_proc_version(op, op->proc_mount_point);
+    const char *str = package->proc_version_string;
+
+    /* a bundle matches if any of its kernels does */
+
+    for (i = 0; i < package->num_kernels; i++) {
+        if (strcmp(version, package->kernels[i].proc_version_string) == 0) {
+            str = package->kernels[i].proc_version_string;
+            break;
+        }
+    }
     
     if (strcmp(version, str) == 0) {
         ret = 1;
@@ -586,6 +678,150 @@ static int check_match(Options *op, char *str)
 
 
 
+/*
+ * update_index() - update the index of the directory containing the
+ * package file.
+ */
+
+static void update_index(Options *op)
+{
+    char *dir = nvstrdup(op->package_file), *slash;
+
+    slash = strrchr(dir, '/');
+    if (slash) {
+        *(slash == dir ? slash + 1 : slash) = '\0';
+    } else {
+        strcpy(dir, ".");
+    }
+
+    if (!precompiled_update_index(op, dir)) {
+        fprintf(stderr, "Unable to update the precompiled package "
+                "index in '%s'.\n", dir);
+    }
+    nvfree(dir);
+}
+
+
+
+/*
+ * pack_bundle() - create a bundle from the packages given with --package,
+ * or for --merge, add their kernels to the existing package file.
+ */
+
+static int pack_bundle(Options *op)
+{
+    PrecompiledInfo *bundle;
+    int i;
+
+    if (op->package && op->package->num_kernels > 0) {
+        bundle = op->package;
+    } else {
+        bundle = nvalloc(sizeof(PrecompiledInfo));
+        bundle->description = nvstrdup("");
+        bundle->proc_version_string = nvstrdup("");
+
+        /* convert an existing single kernel package into a bundle */
+
+        if (op->package) {
+            bundle->version = nvstrdup(op->package->version);
+            precompiled_bundle_add(bundle, op->package);
+        }
+        op->package = bundle;
+    }
+
+    if (op->description) {
+        nvfree(bundle->description);
+        bundle->description = nvstrdup(op->description);
+    }
+
+    for (i = 0; i < op->num_packages; i++) {
+        PrecompiledInfo *info = get_precompiled_info(op, op->packages[i],
+                                                     NULL, NULL, NULL);
+        if (!info) {
+            fprintf(stderr, "Unable to read package file '%s'.\n",
+                    op->packages[i]);
+            return FALSE;
+        }
+
+        if (!bundle->version) {
+            bundle->version = nvstrdup(info->version);
+        } else if (strcmp(bundle->version, info->version) != 0) {
+            fprintf(stderr, "The driver version '%s' of package '%s' does not "
+                    "match the driver version '%s' of the bundle.\n",
+                    info->version, op->packages[i], bundle->version);
+            free_precompiled(info);
+            return FALSE;
+        }
+
+        precompiled_bundle_add(bundle, info);
+    }
+
+    if (!precompiled_pack(bundle, op->package_file)) {
+        fprintf(stderr, "An error occurred while writing the bundle file "
+                "'%s'.\n", op->package_file);
+        return FALSE;
+    }
+
+    update_index(op);
+
+    return TRUE;
+}
+
+
+
+/*
+ * print_file_info() - print the metadata of a packaged file.
+ */
+
+static void print_file_info(const PrecompiledFileInfo *file, int index)
+{
+    const char **attrs, **attr;
+
+    attrs = precompiled_file_attribute_names(file->attributes);
+
+    printf("file %d:\n", index + 1);
+    printf("  name: '%s'\n", file->name);
+    printf("  type: %s\n",
+           precompiled_file_type_name(file->type));
+    printf("  attributes: ");
+
+    for(attr = attrs; *attr; attr++) {
+        if (attr > attrs) {
+            printf(", ");
+        }
+        printf("%s", *attr);
+    }
+
+    printf("\n");
+
+    printf("  size: %d bytes\n", file->size);
+    printf("  compression: %s",
+           precompiled_compression_name(file->compression));
+    if (file->compression != PRECOMPILED_COMPRESSION_NONE) {
+        printf(" (%" PRIu32 " bytes stored, ratio %.2f:1)",
+               file->stored_size,
+               file->stored_size ?
+                   (double) file->size / file->stored_size : 1.0);
+    }
+    printf("\n");
+    printf("  crc: %" PRIu32 "\n", file->crc);
+    printf("  target directory: %s\n", file->target_directory);
+
+    if (file->type == PRECOMPILED_FILE_TYPE_INTERFACE) {
+        printf("  core object name: %s\n", file->core_object_name);
+        printf("  linked module name: %s\n", file->linked_module_name);
+        if (file->signature_size) {
+            printf("  linked module crc: %" PRIu32 "\n",
+                   file->linked_module_crc);
+            printf("  signature size: %d\n", file->signature_size);
+        }
+    }
+
+    printf("\n");
+}
+
+
+
 /*
  * program entry point
  */
@@ -602,6 +838,14 @@ int main(int argc, char *argv[])
     int i;
 
     case PACK:
+        if (op->package && op->package->num_kernels > 0) {
+            fprintf(stderr, "'%s' is a multi-kernel bundle; files cannot be "
+                    "added to it with --pack. Pack them into a separate "
+                    "package, and add it to the bundle with --merge.\n",
+                    op->package_file);
+            break;
+        }
+
         if (!op->package) {
             if (!op->version) {
                 fprintf (stderr, "The --driver-version option must be specified "
@@ -622,9 +866,14 @@ int main(int argc, char *argv[])
             op->package->version = op->version;
         }
 
+        if (op->format_version) {
+            op->package->format_version = op->format_version;
+        }
+
         precompiled_append_files(op->package, op->new_files, op->num_files);
 
         if (precompiled_pack(op->package, op->package_file)) {
+            update_index(op);
             ret = 0;
         } else {
             fprintf(stderr, "An error occurred while writing the package "
@@ -633,7 +882,37 @@ int main(int argc, char *argv[])
 
         break;
 
+    case PACK_MULTI_OPTION: case MERGE_OPTION:
+        if (pack_bundle(op)) {
+            ret = 0;
+        }
+        break;
+
     case UNPACK:
+
+        /* unpack only the files of the selected kernel of a bundle */
+
+        if (op->package->num_kernels > 0) {
+            PrecompiledInfo *kernel = NULL;
+
+            if (op->proc_version_string) {
+                kernel = get_precompiled_info(op, op->package_file,
+                                              op->proc_version_string, NULL,
+                                              NULL);
+            }
+
+            if (!kernel) {
+                fprintf(stderr, "'%s' is a multi-kernel bundle; the "
+                        "--proc-version-string option must be given with the "
+                        "proc version string of one of its kernels.\n",
+                        op->package_file);
+                break;
+            }
+
+            free_precompiled(op->package);
+            op->package = kernel;
+        }
+
         if (precompiled_unpack(op, op->package, op->output_directory)) {
             ret = 0;
         } else {
@@ -644,57 +923,71 @@ int main(int argc, char *argv[])
         break;
 
     case INFO:
-
-        printf("description: %s\n", op->package->description);
-        printf("version: %s\n", op->package->version);
-        printf("proc version: %s\n", op->package->proc_version_string);
-        printf("number of files: %d\n\n", op->package->num_files);
+    {
+        uint64_t total_size = 0, total_stored = 0;
 
         for (i = 0; i < op->package->num_files; i++) {
-            PrecompiledFileInfo *file = op->package->files + i;
-            const char **attrs, **attr;
+            const PrecompiledFileInfo *file = op->package->files + i;
+            int j;
 
-            attrs = precompiled_file_attribute_names(file->attributes);
+            total_size += file->size;
 
-            printf("file %d:\n", i + 1);
-            printf("  name: '%s'\n", file->name);
-            printf("  type: %s\n",
-                   precompiled_file_type_name(file->type));
-            printf("  attributes: ");
+            /* files of a bundle may share a single stored payload */
 
-            for(attr = attrs; *attr; attr++) {
-                if (attr > attrs) {
-                    printf(", ");
+            for (j = 0; j < i; j++) {
+                if (op->package->files[j].data == file->data) {
+                    break;
                 }
-                printf("%s", *attr);
             }
+            if (j == i) {
+                total_stored += file->stored_size;
+            }
+        }
 
-            printf("\n");
-
-            printf("  size: %d bytes\n", file->size);
-            printf("  crc: %" PRIu32 "\n", file->crc);
-            printf("  target directory: %s\n", file->target_directory);
-
-            if (file->type == PRECOMPILED_FILE_TYPE_INTERFACE) {
-                printf("  core object name: %s\n", file->core_object_name);
-                printf("  linked module name: %s\n", file->linked_module_name);
-                if (file->signature_size) {
-                    printf("  linked module crc: %" PRIu32 "\n",
-                           file->linked_module_crc);
-                    printf("  signature size: %d\n", file->signature_size);
-                }
+        printf("description: %s\n", op->package->description);
+        printf("version: %s\n", op->package->version);
+        if (op->package->num_kernels == 0) {
+            printf("proc version: %s\n", op->package->proc_version_string);
+        }
+        printf("format version: %d\n", op->package->format_version);
+        if (op->package->num_kernels > 0) {
+            printf("number of kernels: %d\n", op->package->num_kernels);
+        }
+        printf("number of files: %d\n", op->package->num_files);
+        printf("package size: %" PRIu64 " bytes\n",
+               op->package->package_size);
+        printf("stored file data: %" PRIu64 " of %" PRIu64 " bytes "
+               "(ratio %.2f:1)\n\n", total_stored, total_size,
+               total_stored ? (double) total_size / total_stored : 1.0);
+
+        if (op->package->num_kernels == 0) {
+            for (i = 0; i < op->package->num_files; i++) {
+                print_file_info(op->package->files + i, i);
             }
+        }
 
-            printf("\n");
+        for (i = 0; i < op->package->num_kernels; i++) {
+            const PrecompiledKernelInfo *kernel = op->package->kernels + i;
+            int j;
 
+            printf("kernel %d:\n", i + 1);
+            printf("  description: %s\n", kernel->description);
+            printf("  proc version: %s\n", kernel->proc_version_string);
+            printf("  number of files: %d\n\n", kernel->num_files);
+
+            for (j = 0; j < kernel->num_files; j++) {
+                print_file_info(op->package->files + kernel->first_file + j,
+                                j);
+            }
         }
 
         ret = 0;
         break;
+    }
 
     case MATCH:
 
-        ret = check_match(op, op->package->proc_version_string);
+        ret = check_match(op, op->package);
         break;
 
     default: /* XXX should never get here */ break;
@@ -338,6 +338,10 @@ static void parse_commandline(int argc, char *argv[], Options *op)
         case ADD_THIS_KERNEL_OPTION:
             op->add_this_kernel = TRUE;
             break;
+        case ADD_KERNELS_OPTION:
+            op->add_kernels = strval;
+            op->add_this_kernel = TRUE;
+            break;
         case ADVANCED_OPTIONS_ARGS_ONLY_OPTION:
             print_help_args_only_after = TRUE;
             print_advanced_help = TRUE;
@@ -491,6 +495,25 @@ static void parse_commandline(int argc, char *argv[], Options *op)
         case SKIP_DEPMOD_OPTION:
             op->skip_depmod = TRUE;
             break;
+        case COPY_STRATEGY_OPTION:
+            if (!parse_copy_strategy(strval, &op->copy_strategy) ||
+                op->copy_strategy == COPY_STRATEGY_AUTO) {
+                nv_error_msg("Invalid copy strategy '%s'.", strval);
+                goto fail;
+            }
+            break;
+        case FAST_VALIDATE_OPTION:
+            op->fast_validate = TRUE;
+            break;
+        case PARANOID_VALIDATE_OPTION:
+            op->paranoid_validate = TRUE;
+            break;
+        case CONFLICT_SEARCH_CACHE_OPTION:
+            op->conflict_search_cache = boolval;
+            break;
+        case CONFTEST_CACHE_OPTION:
+            op->conftest_cache = boolval;
+            break;
         default:
             goto fail;
         }
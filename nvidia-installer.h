@@ -164,6 +164,19 @@ typedef uint16_t uint16;
 typedef uint8_t uint8;
 
 
+/*
+ * Strategies for copying file contents; see copy_file_with_crc().
+ * Keep in sync with files.c:copy_strategy_names[]
+ */
+typedef enum {
+    COPY_STRATEGY_AUTO = 0,
+    COPY_STRATEGY_REFLINK,
+    COPY_STRATEGY_COPY_FILE_RANGE,
+    COPY_STRATEGY_SENDFILE,
+    COPY_STRATEGY_MMAP,
+} CopyStrategy;
+
+
 
 /*
  * Options structure; malloced by and initialized by
@@ -213,6 +226,12 @@ typedef struct __options {
     int concurrency_level;
     int skip_module_load;
     int skip_depmod;
+    int fast_validate;
+    int paranoid_validate;
+    int conflict_search_cache;
+    int conftest_cache;
+
+    CopyStrategy copy_strategy;
 
     NVOptionalBool install_libglx_indirect;
     NVOptionalBool install_libglvnd_libraries;
@@ -264,6 +283,7 @@ typedef struct __options {
 
     char *tmpdir;
     char *kernel_name;
+    char *add_kernels;
     char *rpm_file_list;
     char *precompiled_kernel_interfaces_path;
     const char *selinux_chcon_type;
@@ -409,6 +429,14 @@ typedef struct __package {
 
     PackageEntry *entries; /* array of filename/checksum/bytesize entries */
     int num_entries;
+    int max_entries;       /* allocated length of the entries array */
+
+    /*
+     * string arena holding the tokenized contents of the .manifest file;
+     * the header strings and most entry strings point into it
+     */
+    char *manifest_strings;
+    size_t manifest_strings_size;
 
     KernelModuleInfo *kernel_modules;
     int num_kernel_modules;
@@ -480,6 +508,12 @@ typedef struct __package {
 
 #define DEFAULT_GLVND_EGL_JSON_PATH     "/usr/share/glvnd/egl_vendor.d"
 
+/*
+ * Directory for data that nvidia-installer caches between runs, to
+ * speed up later runs; it may be deleted at any time.
+ */
+#define NVIDIA_INSTALLER_CACHE_DIRECTORY "/var/cache/nvidia-installer"
+
 #define DEFAULT_EGL_EXTERNAL_PLATFORM_JSON_PATH "/usr/share/egl/egl_external_platform.d"
 
 /*
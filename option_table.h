@@ -106,6 +106,12 @@ enum {
     EGL_EXTERNAL_PLATFORM_CONFIG_FILE_PATH_OPTION,
     OVERRIDE_FILE_TYPE_DESTINATION_OPTION,
     SKIP_DEPMOD_OPTION,
+    COPY_STRATEGY_OPTION,
+    FAST_VALIDATE_OPTION,
+    PARANOID_VALIDATE_OPTION,
+    CONFLICT_SEARCH_CACHE_OPTION,
+    ADD_KERNELS_OPTION,
+    CONFTEST_CACHE_OPTION,
 };
 
 static const NVGetoptOption __options[] = {
@@ -372,6 +378,27 @@ static const NVGetoptOption __options[] = {
       "'/lib/modules/&KERNEL-NAME&/kernel/drivers/video/' and "
       "'/lib/modules/&KERNEL-NAME&/build/', respectively." },
 
+    { "add-kernels", ADD_KERNELS_OPTION, NVGETOPT_STRING_ARGUMENT, NULL,
+      "Build precompiled kernel interfaces for each of the kernels in the "
+      "comma-separated list &ADD-KERNELS&, and add them to the driver "
+      "package as a single multi-kernel precompiled kernel interface "
+      "package.  Each kernel is given either by its name (the output of "
+      "`uname -r` when the kernel is running), in which case its kernel "
+      "source and output paths are inferred as for '--kernel-name', or by "
+      "the path to its kernel source tree, optionally followed by ':' and "
+      "the path to its kernel output tree.  The kernels are built "
+      "concurrently, each in its own copy of the kernel module sources, "
+      "sharing the number of jobs set with '--concurrency-level'.  A "
+      "precompiled kernel interface is only used with a kernel whose "
+      "/proc/version matches exactly; for a kernel other than the running "
+      "one, this string is read from the version banner in its "
+      "uncompressed 'vmlinux' image, looked for in the kernel output tree, "
+      "in '/boot' and in '/usr/lib/debug'.  If no "
+      "vmlinux is found, the string is reconstructed from the kernel's "
+      "generated headers, which only works if the kernel output tree "
+      "provides 'include/generated/compile.h' (or 'utsversion.h'); recent "
+      "kernels do not install these." },
+
     { "no-precompiled-interface", 'n', 0, NULL,
       "Disable use of precompiled kernel interfaces." },
 
@@ -639,6 +666,51 @@ static const NVGetoptOption __options[] = {
       "running nvidia-installer."
     },
 
+    { "copy-strategy", COPY_STRATEGY_OPTION, NVGETOPT_STRING_ARGUMENT, NULL,
+      "Force the method used to copy file contents when installing files. "
+      "Valid values are 'reflink' (share the data blocks with the source "
+      "file, on filesystems that support it), 'copy-file-range' (let the "
+      "kernel copy the data with copy_file_range(2)), 'sendfile', and "
+      "'mmap' (copy through memory mappings of both files). By default, "
+      "nvidia-installer tries these methods in that order, falling back to "
+      "the next one when a method is not supported. When a method is "
+      "forced, failure to use it is reported as an error; this is mostly "
+      "useful for benchmarking." },
+
+    { "fast-validate",
+      FAST_VALIDATE_OPTION, NVGETOPT_OPTION_APPLIES_TO_NVIDIA_UNINSTALL, NULL,
+      "When validating a previous installation (e.g., before uninstalling "
+      "it) or checking the current one with '--sanity', skip computing the "
+      "checksum of an installed or backed up file if its size, "
+      "modification time, inode and device still match the values recorded "
+      "when it was installed.  Files whose metadata has changed, or which "
+      "were logged by an older nvidia-installer without this metadata, are "
+      "still fully checksummed." },
+
+    { "paranoid-validate",
+      PARANOID_VALIDATE_OPTION, NVGETOPT_OPTION_APPLIES_TO_NVIDIA_UNINSTALL,
+      NULL,
+      "Always compute the checksum of every installed and backed up file when "
+      "validating an installation, even if '--fast-validate' is also given." },
+
+    { "conflict-search-cache", CONFLICT_SEARCH_CACHE_OPTION,
+      NVGETOPT_IS_BOOLEAN, NULL,
+      "When searching for conflicting files and kernel modules, reuse the "
+      "directory listings saved by a previous nvidia-installer run in "
+      NVIDIA_INSTALLER_CACHE_DIRECTORY " for any directory whose "
+      "modification time has not changed, and save the listings for the "
+      "next run.  This speeds up repeated installations on systems with "
+      "large library directories.  The cache is not used by default." },
+
+    { "conftest-cache", CONFTEST_CACHE_OPTION, NVGETOPT_IS_BOOLEAN, NULL,
+      "When building the NVIDIA kernel module, reuse the results of the "
+      "kernel configuration tests saved by a previous nvidia-installer run "
+      "in " NVIDIA_INSTALLER_CACHE_DIRECTORY " for the same kernel source "
+      "and output trees, kernel configuration, compiler and driver, and save "
+      "the results of any new tests for the next run.  This speeds up "
+      "repeated installations and '--add-this-kernel' runs.  The cache is "
+      "not used by default." },
+
     /* Orphaned options: These options were in the long_options table in
      * nvidia-installer.c but not in the help. */
     { "debug",                    'd', 0, NULL,NULL },
@@ -31,6 +31,8 @@
 #include <sys/mman.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <dirent.h>
 
 #include "nvidia-installer.h"
 #include "user-interface.h"
@@ -42,6 +44,11 @@
 
 static int precompiled_read_fileinfo(Options *op, PrecompiledFileInfo *fileInfos,
                                      int index, char *buf, int offset, int size);
+static int precompiled_read_file_entry(Options *op,
+                                       PrecompiledFileInfo *fileInfos,
+                                       int index, char *buf, int offset,
+                                       int size, uint64_t package_size);
+static void encode_uint32(uint32 val, uint8 *data, int *offset);
 
 /*
  * read_uint32() - given a buffer and an offset, read the next 4 bytes from
@@ -143,10 +150,483 @@ char *read_proc_version(Options *op, const char *proc_mount_point)
 
 
 
+/*
+ * hash_proc_version() - 32-bit FNV-1a hash of a proc version string.
+ */
+
+static uint32 hash_proc_version(const char *str)
+{
+    uint32 h = 2166136261u;
+
+    while (*str) {
+        h ^= (unsigned char) *str++;
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+
+/*
+ * Packages are first probed by reading just their header with pread(); see
+ * probe_precompiled_header().  PRECOMPILED_PROBE_SIZE bytes are read up
+ * front, which is normally enough to hold the version, description and proc
+ * version strings; any string extending past that is read in chunks.
+ */
+
+#define PRECOMPILED_PROBE_SIZE 4096
+#define PRECOMPILED_PROBE_CHUNK_SIZE 256
+
+/*
+ * PrecompiledKernelRecord: an entry of the kernel table of a bundle.
+ */
+
+typedef struct {
+    uint32 proc_version_hash;
+    uint32 proc_version_offset;
+    uint32 proc_version_len;
+    uint32 description_offset;
+    uint32 description_len;
+    uint32 entries_offset;
+    uint32 num_files;
+} PrecompiledKernelRecord;
+
+typedef struct {
+    int fd;
+    uint64_t size;                      /* size of the package file */
+    uint32 head_len;                    /* bytes of the package in head[] */
+    char head[PRECOMPILED_PROBE_SIZE];
+
+    /* bundles only: the metadata, and the kernel matched by the probe */
+    uint32 metadata_offset;
+    uint32 metadata_len;
+    uint32 num_kernels;
+    int kernel_found;
+    PrecompiledKernelRecord kernel;
+} PrecompiledProbe;
+
+
+/*
+ * probe_read_uint32() - read a uint32 at the given offset of the package,
+ * and advance the offset.  Returns FALSE if the package is too short.
+ */
+
+static int probe_read_uint32(const PrecompiledProbe *probe, uint32 *offset,
+                             uint32 *val)
+{
+    char buf[4];
+    int o = 0;
+
+    if (probe->size < 4 || *offset > probe->size - 4) {
+        return FALSE;
+    }
+
+    if (*offset + 4 <= probe->head_len) {
+        memcpy(buf, probe->head + *offset, 4);
+    } else if (pread(probe->fd, buf, 4, *offset) != 4) {
+        return FALSE;
+    }
+
+    *val = read_uint32(buf, &o);
+    *offset += 4;
+
+    return TRUE;
+}
+
+
+/*
+ * probe_string_equals() - compare the 'len' bytes at the given offset of the
+ * package with the NUL terminated string 'str', without allocating.
+ */
+
+static int probe_string_equals(const PrecompiledProbe *probe, uint32 offset,
+                               uint32 len, const char *str)
+{
+    char chunk[PRECOMPILED_PROBE_CHUNK_SIZE];
+
+    if (strlen(str) != len) {
+        return FALSE;
+    }
+
+    if (offset < probe->head_len) {
+        uint32 n = NV_MIN(len, probe->head_len - offset);
+
+        if (memcmp(probe->head + offset, str, n) != 0) {
+            return FALSE;
+        }
+        offset += n;
+        str += n;
+        len -= n;
+    }
+
+    while (len > 0) {
+        uint32 n = NV_MIN(len, sizeof(chunk));
+
+        if (pread(probe->fd, chunk, n, offset) != n ||
+            memcmp(chunk, str, n) != 0) {
+            return FALSE;
+        }
+        offset += n;
+        str += n;
+        len -= n;
+    }
+
+    return TRUE;
+}
+
+
+/*
+ * probe_read_kernel_record() - read entry 'index' of the kernel table of a
+ * bundle, and check that the strings and file table entries it refers to
+ * lie within the bundle metadata.
+ */
+
+static int probe_read_kernel_record(const PrecompiledProbe *probe,
+                                    uint32 index, PrecompiledKernelRecord *rec)
+{
+    char buf[PRECOMPILED_KERNEL_RECORD_LENGTH];
+    uint32 offset, end = probe->metadata_offset + probe->metadata_len;
+    int o = 0;
+
+    offset = probe->metadata_offset + 4 +
+             index * PRECOMPILED_KERNEL_RECORD_LENGTH;
+
+    if (offset + sizeof(buf) <= probe->head_len) {
+        memcpy(buf, probe->head + offset, sizeof(buf));
+    } else if (pread(probe->fd, buf, sizeof(buf), offset) != sizeof(buf)) {
+        return FALSE;
+    }
+
+    rec->proc_version_hash = read_uint32(buf, &o);
+    rec->proc_version_offset = read_uint32(buf, &o);
+    rec->proc_version_len = read_uint32(buf, &o);
+    rec->description_offset = read_uint32(buf, &o);
+    rec->description_len = read_uint32(buf, &o);
+    rec->entries_offset = read_uint32(buf, &o);
+    rec->num_files = read_uint32(buf, &o);
+
+    return rec->proc_version_offset >= probe->metadata_offset &&
+           rec->proc_version_offset <= end &&
+           rec->proc_version_len <= end - rec->proc_version_offset &&
+           rec->description_offset >= probe->metadata_offset &&
+           rec->description_offset <= end &&
+           rec->description_len <= end - rec->description_offset &&
+           rec->entries_offset >= probe->metadata_offset &&
+           rec->entries_offset <= end &&
+           rec->num_files <= (end - rec->entries_offset) /
+                             PRECOMPILED_FILE_ENTRY_CONSTANT_LENGTH;
+}
+
+
+/*
+ * probe_find_kernel() - binary search the kernel table of a bundle for the
+ * given proc version string.  Records with the same hash are compared
+ * with the string in place.  On success, the kernel's record is stored in
+ * probe->kernel and TRUE is returned.
+ */
+
+static int probe_find_kernel(PrecompiledProbe *probe,
+                             const char *proc_version_string)
+{
+    PrecompiledKernelRecord rec;
+    uint32 hash = hash_proc_version(proc_version_string);
+    uint32 lo = 0, hi = probe->num_kernels;
+
+    while (lo < hi) {
+        uint32 mid = lo + (hi - lo) / 2;
+
+        if (!probe_read_kernel_record(probe, mid, &rec)) {
+            return FALSE;
+        }
+
+        if (rec.proc_version_hash < hash) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (; lo < probe->num_kernels; lo++) {
+        if (!probe_read_kernel_record(probe, lo, &rec) ||
+            rec.proc_version_hash != hash) {
+            break;
+        }
+
+        if (probe_string_equals(probe, rec.proc_version_offset,
+                                rec.proc_version_len, proc_version_string)) {
+            probe->kernel = rec;
+            probe->kernel_found = TRUE;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+
+/*
+ * probe_precompiled_header() - check the header of the package open on
+ * probe->fd, and whether its version and proc version strings match the
+ * given strings; either may be NULL to accept any value.  The strings are
+ * compared in place, so that rejecting a package costs a few small reads
+ * and no allocations.  On success, the package format version is returned
+ * in format_version, the offsets and lengths of the version, description
+ * and proc version strings are returned in strs[] and lens[], and TRUE is
+ * returned.
+ *
+ * For a bundle, the kernel table is searched for the proc version string,
+ * and the description and proc version string of the matching kernel are
+ * returned.  If no proc version string is given, the bundle's description
+ * and an empty proc version string are returned.
+ */
+
+static int probe_precompiled_header(Options *op, PrecompiledProbe *probe,
+                                    const char *filename,
+                                    const char *real_proc_version_string,
+                                    const char *package_version,
+                                    uint32 *format_version,
+                                    uint32 strs[3], uint32 lens[3])
+{
+    static const char * const names[3] = {
+        "version string", "description string", "proc version string"
+    };
+    uint32 offset, val;
+    ssize_t ret;
+    int i;
+
+    ret = pread(probe->fd, probe->head, NV_MIN(probe->size, sizeof(probe->head)),
+                0);
+    if (ret < PRECOMPILED_PKG_CONSTANT_LENGTH) {
+        ui_expert(op, "Unable to read file '%s' (%s).", filename,
+                  ret < 0 ? strerror(errno) : "short read");
+        return FALSE;
+    }
+    probe->head_len = ret;
+
+    /* check for the header */
+
+    if (strncmp(probe->head, PRECOMPILED_PKG_HEADER, 8) != 0) {
+        ui_expert(op, "File '%s': unrecognized file format.", filename);
+        return FALSE;
+    }
+    offset = 8;
+
+    /* check the package format version */
+
+    probe_read_uint32(probe, &offset, &val);
+    if (val != PRECOMPILED_PKG_VERSION_2 && val != PRECOMPILED_PKG_VERSION_3 &&
+        val != PRECOMPILED_PKG_VERSION_4) {
+        ui_expert(op, "Incompatible package format version %d: expected %d "
+                  "to %d.", val, PRECOMPILED_PKG_VERSION_2,
+                  PRECOMPILED_PKG_VERSION_4);
+        return FALSE;
+    }
+    *format_version = val;
+
+    /*
+     * find the version, description and proc version strings; bundles have
+     * no proc version string in their header
+     */
+
+    for (i = 0; i < (val == PRECOMPILED_PKG_VERSION_4 ? 2 : 3); i++) {
+        if (!probe_read_uint32(probe, &offset, &lens[i]) ||
+            lens[i] > probe->size - PRECOMPILED_PKG_CONSTANT_LENGTH ||
+            lens[i] > probe->size - offset ||
+            lens[i] > INT32_MAX - offset) {
+            ui_expert(op, "Invalid file '%s' (bad %s length %d).",
+                      filename, names[i], lens[i]);
+            return FALSE;
+        }
+        strs[i] = offset;
+        offset += lens[i];
+
+        /*
+         * fail if the version is empty, or if a package version was
+         * specified and the version does not match it
+         */
+
+        if (i == 0 &&
+            (lens[0] == 0 ||
+             (package_version &&
+              !probe_string_equals(probe, strs[0], lens[0],
+                                   package_version)))) {
+            return FALSE;
+        }
+    }
+
+    if (val == PRECOMPILED_PKG_VERSION_4) {
+
+        /* find the bundle metadata, and the kernel which matches */
+
+        probe->metadata_offset = offset + 4;
+        if (!probe_read_uint32(probe, &offset, &probe->metadata_len) ||
+            probe->metadata_len < 4 ||
+            probe->metadata_len > probe->size - offset ||
+            probe->metadata_len > INT32_MAX - 4 - offset ||
+            probe->size - offset - probe->metadata_len < 4 ||
+            !probe_read_uint32(probe, &offset, &probe->num_kernels) ||
+            probe->num_kernels > (probe->metadata_len - 4) /
+                                 PRECOMPILED_KERNEL_RECORD_LENGTH) {
+            ui_expert(op, "Invalid file '%s' (bad bundle metadata).",
+                      filename);
+            return FALSE;
+        }
+
+        probe->kernel_found = FALSE;
+        strs[2] = lens[2] = 0;
+
+        if (real_proc_version_string) {
+            if (!probe_find_kernel(probe, real_proc_version_string)) {
+                return FALSE;
+            }
+            strs[1] = probe->kernel.description_offset;
+            lens[1] = probe->kernel.description_len;
+            strs[2] = probe->kernel.proc_version_offset;
+            lens[2] = probe->kernel.proc_version_len;
+        }
+
+        return TRUE;
+    }
+
+    /* check if the running kernel matches */
+
+    if (real_proc_version_string &&
+        !probe_string_equals(probe, strs[2], lens[2],
+                             real_proc_version_string)) {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+
+/*
+ * read_bundle_entries() - read the file table entries of the bundle mapped
+ * at 'buf', after checking the CRC of its metadata: those of the kernel
+ * matched by the probe, if any, or otherwise those of every kernel, which
+ * are then returned in 'kernels'.  Returns FALSE if the bundle is corrupt.
+ */
+
+static int read_bundle_entries(Options *op, const PrecompiledProbe *probe,
+                               const char *filename, char *buf, uint64_t size,
+                               PrecompiledFileInfo **files, int *num_files,
+                               PrecompiledKernelInfo **kernels,
+                               int *num_kernels)
+{
+    PrecompiledKernelRecord *records;
+    PrecompiledFileInfo *fileInfos = NULL;
+    PrecompiledKernelInfo *kernelInfos = NULL;
+    uint32 n, i, j, total = 0;
+    int offset, index = 0, ret = FALSE;
+
+    offset = probe->metadata_offset + probe->metadata_len;
+    if (read_uint32(buf, &offset) !=
+        compute_crc_from_buffer((uint8 *) buf + probe->metadata_offset,
+                                probe->metadata_len)) {
+        ui_log(op, "The CRC of the metadata of '%s' does not match; the file "
+               "may be corrupted.", filename);
+        return FALSE;
+    }
+
+    n = probe->kernel_found ? 1 : probe->num_kernels;
+    records = nvalloc((n + 1) * sizeof(PrecompiledKernelRecord));
+
+    if (probe->kernel_found) {
+        records[0] = probe->kernel;
+    }
+
+    /*
+     * each file has its own table entry in the metadata, which bounds the
+     * total number of files
+     */
+
+    for (i = 0; i < n; i++) {
+        if ((!probe->kernel_found &&
+             !probe_read_kernel_record(probe, i, &records[i])) ||
+            records[i].num_files > probe->metadata_len /
+                                   PRECOMPILED_FILE_ENTRY_CONSTANT_LENGTH -
+                                   total) {
+            ui_log(op, "Invalid kernel table entry %d in '%s'.", i, filename);
+            goto done;
+        }
+        total += records[i].num_files;
+    }
+
+    fileInfos = nvalloc((total + 1) * sizeof(PrecompiledFileInfo));
+    if (!probe->kernel_found) {
+        kernelInfos = nvalloc((n + 1) * sizeof(PrecompiledKernelInfo));
+    }
+
+    for (i = 0; i < n; i++) {
+        if (kernelInfos) {
+            kernelInfos[i].proc_version_string =
+                nvstrndup(buf + records[i].proc_version_offset,
+                          records[i].proc_version_len);
+            kernelInfos[i].description =
+                nvstrndup(buf + records[i].description_offset,
+                          records[i].description_len);
+            kernelInfos[i].first_file = index;
+            kernelInfos[i].num_files = records[i].num_files;
+        }
+
+        offset = records[i].entries_offset;
+
+        for (j = 0; j < records[i].num_files; j++) {
+            int len = precompiled_read_file_entry(op, fileInfos, index++, buf,
+                                                  offset,
+                                                  NV_MIN(size, INT32_MAX),
+                                                  size);
+            if (len <= 0) {
+                ui_log(op, "An error occurred while trying to parse '%s'.",
+                       filename);
+                goto done;
+            }
+            offset += len;
+        }
+    }
+
+    *files = fileInfos;
+    *num_files = total;
+    *kernels = kernelInfos;
+    *num_kernels = kernelInfos ? n : 0;
+    fileInfos = NULL;
+    kernelInfos = NULL;
+    ret = TRUE;
+
+done:
+    if (fileInfos) {
+        for (i = 0; i < total; i++) {
+            free_precompiled_file_data(fileInfos[i]);
+        }
+        nvfree(fileInfos);
+    }
+    if (kernelInfos) {
+        for (i = 0; i < n; i++) {
+            nvfree(kernelInfos[i].proc_version_string);
+            nvfree(kernelInfos[i].description);
+        }
+        nvfree(kernelInfos);
+    }
+    nvfree(records);
+
+    return ret;
+}
+
+
 /*
  * get_precompiled_info() - load the the specified package into a
  * PrecompiledInfo record.  It's not really an error if we can't open the file
  * or if it's not the right format, so just throw an expert-only log message.
+ *
+ * The package header is probed with pread() first, so that packages for
+ * other kernels or driver versions are rejected without being mapped.  The
+ * matching package is then mapped, and the PrecompiledFileInfo data pointers
+ * point into the mapping, which is owned by the PrecompiledInfo; the file
+ * payloads are only paged in when they are used.
+ *
+ * If the package is a bundle, the kernel matching the proc version string
+ * is found in the bundle's kernel table, and only its files are loaded;
+ * if real_proc_version_string is NULL, the whole bundle is loaded.
  */
 
 PrecompiledInfo *get_precompiled_info(Options *op,
@@ -155,20 +635,23 @@ PrecompiledInfo *get_precompiled_info(Options *op,
                                       const char *package_version,
                                       char *const *search_filelist)
 {
-    int fd, offset, num_files, i;
+    int offset, table_offset, table_size, num_files, num_kernels = 0, i;
     char *buf;
-    uint32 val, size;
+    uint32 format_version, strs[3], lens[3], val;
+    uint64_t size;
     char *version, *description, *proc_version_string;
     struct stat stat_buf;
     PrecompiledInfo *info = NULL;
     PrecompiledFileInfo *fileInfos = NULL;
+    PrecompiledKernelInfo *kernels = NULL;
+    PrecompiledProbe probe;
 
-    fd = size = 0;
+    size = num_files = 0;
     buf = description = proc_version_string = version = NULL;
 
     /* open the file to be unpacked */
     
-    if ((fd = open(filename, O_RDONLY)) == -1) {
+    if ((probe.fd = open(filename, O_RDONLY)) == -1) {
         ui_expert(op, "Unable to open precompiled kernel interface file "
                   "'%s' (%s)", filename, strerror(errno));
         goto done;
@@ -176,12 +659,12 @@ PrecompiledInfo *get_precompiled_info(Options *op,
     
     /* get the file length */
     
-    if (fstat(fd, &stat_buf) == -1) {
+    if (fstat(probe.fd, &stat_buf) == -1) {
         ui_expert(op, "Unable to determine '%s' file length (%s).",
                   filename, strerror(errno));
         goto done;
     }
-    size = stat_buf.st_size;
+    size = probe.size = stat_buf.st_size;
 
     /* check for a minimum length */
 
@@ -189,101 +672,81 @@ PrecompiledInfo *get_precompiled_info(Options *op,
         ui_expert(op, "File '%s' appears to be too short.", filename);
         goto done;
     }
-    
-    /* mmap(2) the input file */
-
-    buf = mmap(0, size, PROT_READ, MAP_FILE|MAP_SHARED, fd, 0);
-    if (buf == (void *) -1) {
-        ui_expert(op, "Unable to mmap file %s (%s).",
-                  filename, strerror(errno));
-        goto done;
-    }
-    offset = 0;
-
-    /* check for the header */
 
-    if (strncmp(buf + offset, PRECOMPILED_PKG_HEADER, 8) != 0) {
-        ui_expert(op, "File '%s': unrecognized file format.", filename);
+    if (size > SIZE_MAX) {
+        ui_expert(op, "File '%s' is too large to be mapped.", filename);
         goto done;
     }
-    offset += 8;
 
-    /* check the package format version */
+    /* check the header before mapping the package */
 
-    val = read_uint32(buf, &offset);
-    if (val != PRECOMPILED_PKG_VERSION) {
-        ui_expert(op, "Incompatible package format version %d: expected %d.",
-                  val, PRECOMPILED_PKG_VERSION);
+    if (!probe_precompiled_header(op, &probe, filename,
+                                  real_proc_version_string, package_version,
+                                  &format_version, strs, lens)) {
         goto done;
     }
     
-    /* read the version */
+    /*
+     * the file tables are parsed with 32-bit offsets; only version 3 and 4
+     * payloads may lie past the first 2 GB of the package
+     */
 
-    val = read_uint32(buf, &offset);
-    if ((val + PRECOMPILED_PKG_CONSTANT_LENGTH) > size) {
-        ui_expert(op, "Invalid file '%s' (bad version string length %d).",
-                  filename, val);
+    if (format_version == PRECOMPILED_PKG_VERSION_2 && size > INT32_MAX) {
+        ui_expert(op, "File '%s' is too large for package format version %d.",
+                  filename, format_version);
         goto done;
     }
-    if (val > 0) {
-        version = nvalloc(val+1);
-        memcpy(version, buf + offset, val);
-        version[val] = '\0';
-    } else {
-        version = NULL;
-    }
-    offset += val;
+    table_size = NV_MIN(size, INT32_MAX);
 
-    /* fail if the version could not be read, or if a package version was
-       specified and the read version does not match it */
+    /* mmap(2) the input file */
 
-    if (!version ||
-        (package_version && strcmp(version, package_version) != 0)) {
+    buf = mmap(0, size, PROT_READ, MAP_FILE|MAP_SHARED, probe.fd, 0);
+    if (buf == (void *) -1) {
+        ui_expert(op, "Unable to mmap file %s (%s).",
+                  filename, strerror(errno));
+        buf = NULL;
         goto done;
     }
 
-
-    /* read the description */
-
-    val = read_uint32(buf, &offset);
-    if ((val + PRECOMPILED_PKG_CONSTANT_LENGTH) > size) {
-        ui_expert(op, "Invalid file '%s' (bad description string length %d).",
-                  filename, val);
-        goto done;
-    }
-    description = nvalloc(val+1);
-    memcpy(description, buf + offset, val);
-    description[val] = '\0';
-    offset += val;
+    version = nvstrndup(buf + strs[0], lens[0]);
+    description = nvstrndup(buf + strs[1], lens[1]);
+    proc_version_string = nvstrndup(buf + strs[2], lens[2]);
+    offset = strs[2] + lens[2];
     
-    /* read the proc version string */
+    ui_log(op, "A precompiled kernel interface for kernel '%s' has been "
+           "found here: %s.", description, filename);
 
-    val = read_uint32(buf, &offset);
-    if ((val + PRECOMPILED_PKG_CONSTANT_LENGTH) > size) {
-        ui_expert(op, "Invalid file '%s' (bad version string length %d).",
-                  filename, val);
-        goto done;
+    if (format_version == PRECOMPILED_PKG_VERSION_4) {
+        if (!read_bundle_entries(op, &probe, filename, buf, size, &fileInfos,
+                                 &num_files, &kernels, &num_kernels)) {
+            num_files = 0;
+            goto done;
+        }
+        goto check_files;
     }
-    proc_version_string = nvalloc(val+1);
-    memcpy(proc_version_string, buf + offset, val);
-    offset += val;
-    proc_version_string[val] = '\0';
-
-    /* check if the running kernel matches */
 
-    if (real_proc_version_string &&
-        (strcmp(real_proc_version_string, proc_version_string) != 0)) {
+    num_files = read_uint32(buf, &offset);
+    if (num_files < 0 ||
+        num_files > (table_size - offset) /
+                    (format_version == PRECOMPILED_PKG_VERSION_2 ?
+                     PRECOMPILED_FILE_CONSTANT_LENGTH :
+                     PRECOMPILED_FILE_ENTRY_CONSTANT_LENGTH)) {
+        ui_log(op, "Invalid number of files %d in '%s'.", num_files, filename);
+        num_files = 0;
         goto done;
     }
-    
-    ui_log(op, "A precompiled kernel interface for kernel '%s' has been "
-           "found here: %s.", description, filename);
-
-    num_files = read_uint32(buf, &offset);
     fileInfos = nvalloc(num_files * sizeof(PrecompiledFileInfo));
+    table_offset = offset;
     for (i = 0; i < num_files; i++) {
         int ret;
-        ret = precompiled_read_fileinfo(op, fileInfos, i, buf, offset, size);
+
+        if (format_version == PRECOMPILED_PKG_VERSION_2) {
+            ret = precompiled_read_fileinfo(op, fileInfos, i, buf, offset,
+                                            table_size);
+        } else {
+            ret = precompiled_read_file_entry(op, fileInfos, i, buf, offset,
+                                              table_size, size);
+        }
 
         if (ret > 0) {
             offset += ret;
@@ -294,6 +757,25 @@ PrecompiledInfo *get_precompiled_info(Options *op,
         }
     }
 
+    /* the version 3 file table is followed by its CRC */
+
+    if (format_version == PRECOMPILED_PKG_VERSION_3) {
+        if (table_size - offset < 4) {
+            ui_log(op, "The file table of '%s' is truncated.", filename);
+            goto done;
+        }
+
+        val = compute_crc_from_buffer((uint8 *) buf + table_offset,
+                                      offset - table_offset);
+        if (read_uint32(buf, &offset) != val) {
+            ui_log(op, "The CRC of the file table of '%s' does not match; the "
+                   "file may be corrupted.", filename);
+            goto done;
+        }
+    }
+
+check_files:
+
     /* 
      * Check for the package validity.
      * 
@@ -330,302 +812,1278 @@ PrecompiledInfo *get_precompiled_info(Options *op,
 
     info = (PrecompiledInfo *) nvalloc(sizeof(PrecompiledInfo));
     info->package_size = size;
+    info->package_data = buf;
+    info->format_version = format_version;
     info->version = version;
     info->proc_version_string = proc_version_string;
     info->description = description;
     info->num_files = num_files;
     info->files = fileInfos;
+    info->num_kernels = num_kernels;
+    info->kernels = kernels;
 
     /*
-     * XXX so that the proc version, description, and version strings, and the
-     * PrecompiledFileInfo array aren't freed below
+     * XXX so that the proc version, description, and version strings, the
+     * PrecompiledFileInfo and PrecompiledKernelInfo arrays and the package
+     * mapping aren't freed below
      */
 
     proc_version_string = description = version = NULL;
     fileInfos = NULL;
+    kernels = NULL;
+    buf = NULL;
+
+done:
+
+    /* cleanup whatever needs cleaning up */
+
+    if (buf) munmap(buf, size);
+    if (probe.fd >= 0) close(probe.fd);
+    nvfree(description);
+    nvfree(proc_version_string);
+    if (fileInfos) {
+        for (i = 0; i < num_files; i++) {
+            free_precompiled_file_data(fileInfos[i]);
+        }
+        nvfree(fileInfos);
+    }
+    if (kernels) {
+        for (i = 0; i < num_kernels; i++) {
+            nvfree(kernels[i].proc_version_string);
+            nvfree(kernels[i].description);
+        }
+        nvfree(kernels);
+    }
+    nvfree(version);
+
+    return info;
+
+}
+
+
+/*
+ * Compressed file payloads (package format version 3) are a sequence of
+ * blocks, each compressed independently in the LZ4 block format; see
+ * precompiled.h.  The compressor is a simple greedy one, with a single hash
+ * table probe per position: it favours speed and small code over the best
+ * compression ratio.
+ */
+
+#define LZ4_MIN_MATCH     4
+#define LZ4_LAST_LITERALS 5  /* the last 5 bytes of a block are literals */
+#define LZ4_MF_LIMIT      12 /* no match starts in the last 12 bytes */
+#define LZ4_MAX_OFFSET    65535
+#define LZ4_HASH_BITS     14
+
+static uint32 lz4_read32(const uint8 *p)
+{
+    uint32 val;
+
+    memcpy(&val, p, sizeof(val));
+
+    return val;
+}
+
+static uint32 lz4_hash(uint32 val)
+{
+    return (val * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+
+/*
+ * lz4_put_sequence() - write a sequence of 'literal_len' literals followed
+ * by a match of 'match_len' + LZ4_MIN_MATCH bytes at 'offset'; an offset of
+ * 0 ends the block with the literals only.  Returns the new output position.
+ */
+
+static uint8 *lz4_put_sequence(uint8 *op, const uint8 *literals,
+                               uint32 literal_len, uint32 offset,
+                               uint32 match_len)
+{
+    uint8 *token = op++;
+    uint32 len;
+
+    *token = NV_MIN(literal_len, 15) << 4;
+    if (literal_len >= 15) {
+        for (len = literal_len - 15; len >= 255; len -= 255) *op++ = 255;
+        *op++ = len;
+    }
+
+    memcpy(op, literals, literal_len);
+    op += literal_len;
+
+    if (offset) {
+        *op++ = offset & 0xff;
+        *op++ = offset >> 8;
+
+        *token |= NV_MIN(match_len, 15);
+        if (match_len >= 15) {
+            for (len = match_len - 15; len >= 255; len -= 255) *op++ = 255;
+            *op++ = len;
+        }
+    }
+
+    return op;
+}
+
+
+/*
+ * lz4_compress_block() - compress the 'len' bytes at 'src' into 'dst', which
+ * has room for 'dst_len' bytes.  'table' is scratch space for 1 <<
+ * LZ4_HASH_BITS entries.  Returns the compressed length, or 0 if the
+ * compressed block does not fit in 'dst_len' bytes.
+ */
+
+static uint32 lz4_compress_block(const uint8 *src, uint32 len, uint8 *dst,
+                                 uint32 dst_len, uint32 *table)
+{
+    const uint8 *ip = src, *anchor = src, *end = src + len;
+    uint8 *op = dst, *oend = dst + dst_len;
+    uint32 literal_len;
+
+    memset(table, 0, sizeof(uint32) << LZ4_HASH_BITS);
+
+    if (len > LZ4_MF_LIMIT) {
+        const uint8 *mf_limit = end - LZ4_MF_LIMIT;
+        const uint8 *match_limit = end - LZ4_LAST_LITERALS;
+
+        while (ip < mf_limit) {
+            uint32 seq = lz4_read32(ip);
+            uint32 h = lz4_hash(seq);
+            const uint8 *ref = src + table[h], *m, *r;
+
+            table[h] = ip - src;
+
+            if (ref >= ip || ip - ref > LZ4_MAX_OFFSET ||
+                lz4_read32(ref) != seq) {
+                ip++;
+                continue;
+            }
+
+            m = ip + LZ4_MIN_MATCH;
+            r = ref + LZ4_MIN_MATCH;
+            while (m < match_limit && *m == *r) {
+                m++;
+                r++;
+            }
+
+            literal_len = ip - anchor;
+            if (oend - op < 1 + literal_len / 255 + 1 + literal_len + 2 +
+                            (m - ip) / 255 + 1) {
+                return 0;
+            }
+
+            op = lz4_put_sequence(op, anchor, literal_len, ip - ref,
+                                  m - ip - LZ4_MIN_MATCH);
+            ip = anchor = m;
+        }
+    }
+
+    literal_len = end - anchor;
+    if (oend - op < 1 + literal_len / 255 + 1 + literal_len) {
+        return 0;
+    }
+    op = lz4_put_sequence(op, anchor, literal_len, 0, 0);
+
+    return op - dst;
+}
+
+
+/*
+ * lz4_get_length() - add the extra length bytes of a literal or match
+ * length to 'len', if its 4-bit field in the token was saturated.
+ */
+
+static int lz4_get_length(const uint8 **ip, const uint8 *iend, uint32 *len)
+{
+    uint8 b;
+
+    if (*len != 15) {
+        return TRUE;
+    }
+
+    do {
+        if (*ip >= iend) {
+            return FALSE;
+        }
+        b = *(*ip)++;
+        *len += b;
+    } while (b == 255);
+
+    return TRUE;
+}
+
+
+/*
+ * lz4_decompress_block() - decompress the 'src_len' bytes at 'src' into
+ * 'dst'.  Returns TRUE if the block is well formed and decompresses to
+ * exactly 'dst_len' bytes.
+ */
+
+static int lz4_decompress_block(const uint8 *src, uint32 src_len, uint8 *dst,
+                                uint32 dst_len)
+{
+    const uint8 *ip = src, *iend = src + src_len;
+    uint8 *op = dst, *oend = dst + dst_len;
+
+    while (ip < iend) {
+        uint32 token = *ip++, len, offset;
+        const uint8 *match;
+
+        /* literals */
+
+        len = token >> 4;
+        if (!lz4_get_length(&ip, iend, &len) ||
+            len > iend - ip || len > oend - op) {
+            return FALSE;
+        }
+        memcpy(op, ip, len);
+        ip += len;
+        op += len;
+
+        /* the last sequence of the block has no match */
+
+        if (ip == iend) {
+            break;
+        }
+
+        if (iend - ip < 2) {
+            return FALSE;
+        }
+        offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op - dst) {
+            return FALSE;
+        }
+
+        len = token & 15;
+        if (!lz4_get_length(&ip, iend, &len)) {
+            return FALSE;
+        }
+        len += LZ4_MIN_MATCH;
+        if (len > oend - op) {
+            return FALSE;
+        }
+
+        /* matches may overlap the bytes they produce */
+
+        match = op - offset;
+        if (offset >= len) {
+            memcpy(op, match, len);
+            op += len;
+        } else {
+            while (len--) *op++ = *match++;
+        }
+    }
+
+    return op == oend;
+}
+
+
+/*
+ * next_payload_block() - decompress the next block of a compressed file
+ * payload into 'block', which must hold PRECOMPILED_BLOCK_SIZE bytes.
+ * '*pos' is the offset of the block in the payload, and is advanced past
+ * it.  Returns the length of the decompressed block, 0 at the end of the
+ * payload, or -1 if the payload is corrupt.
+ */
+
+static int next_payload_block(const PrecompiledFileInfo *fileInfo,
+                              uint32 *pos, uint8 *block)
+{
+    const char *data = (const char *) fileInfo->data;
+    uint32 raw_len, stored_len;
+    int offset = *pos;
+
+    if (*pos == fileInfo->stored_size) {
+        return 0;
+    }
+
+    if (fileInfo->stored_size - *pos < 8) {
+        return -1;
+    }
+
+    raw_len = read_uint32(data, &offset);
+    stored_len = read_uint32(data, &offset);
+
+    if (raw_len == 0 || raw_len > PRECOMPILED_BLOCK_SIZE) {
+        return -1;
+    }
+
+    if (stored_len & PRECOMPILED_BLOCK_UNCOMPRESSED) {
+        stored_len &= ~PRECOMPILED_BLOCK_UNCOMPRESSED;
+        if (stored_len != raw_len ||
+            stored_len > fileInfo->stored_size - offset) {
+            return -1;
+        }
+        memcpy(block, data + offset, raw_len);
+    } else if (stored_len > fileInfo->stored_size - offset ||
+               !lz4_decompress_block(fileInfo->data + offset, stored_len,
+                                     block, raw_len)) {
+        return -1;
+    }
+
+    *pos = offset + stored_len;
+
+    return raw_len;
+}
+
+
+/*
+ * FileReader: reads the contents of a packaged file one block of up to
+ * PRECOMPILED_BLOCK_SIZE bytes at a time, whether the file is held in
+ * memory, possibly compressed, or is read from its source file.
+ */
+
+typedef struct {
+    const PrecompiledFileInfo *file;
+    uint32 pos;             /* position in file->data */
+    uint32 total;           /* bytes of the file read so far */
+    int fd;                 /* file->source_path, or -1 */
+} FileReader;
+
+
+static int file_reader_open(FileReader *reader,
+                            const PrecompiledFileInfo *file)
+{
+    reader->file = file;
+    reader->pos = reader->total = 0;
+    reader->fd = -1;
+
+    if (!file->data && file->source_path) {
+        reader->fd = open(file->source_path, O_RDONLY);
+        return reader->fd != -1;
+    }
+
+    return TRUE;
+}
+
+
+static void file_reader_close(FileReader *reader)
+{
+    if (reader->fd != -1) {
+        close(reader->fd);
+        reader->fd = -1;
+    }
+}
+
+
+/*
+ * file_reader_next() - read the next block of the file.  'block' must hold
+ * PRECOMPILED_BLOCK_SIZE bytes.  '*data' is set to the block, which is read
+ * into 'block' unless the file is held uncompressed in memory.  Returns the
+ * length of the block, 0 at the end of the file, or -1 on error, including
+ * if the file is not of the expected size.
+ */
+
+static int file_reader_next(FileReader *reader, uint8 *block,
+                            const uint8 **data)
+{
+    const PrecompiledFileInfo *file = reader->file;
+    uint32 len = NV_MIN(file->size - reader->total, PRECOMPILED_BLOCK_SIZE);
+    int ret;
+
+    if (reader->fd != -1) {
+        for (ret = 0; ret < len; ) {
+            ssize_t n = read(reader->fd, block + ret, len - ret);
+
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return -1;
+            ret += n;
+        }
+        *data = block;
+    } else if (file->compression == PRECOMPILED_COMPRESSION_NONE) {
+        ret = len;
+        *data = file->data + reader->total;
+    } else {
+        ret = next_payload_block(file, &reader->pos, block);
+        *data = block;
+
+        if (ret > (int) len || (ret == 0 && len > 0)) {
+            return -1;
+        }
+    }
+
+    reader->total += ret;
+
+    return ret;
+}
+
+
+/*
+ * write_all() - write 'len' bytes to 'fd', retrying short writes.
+ */
+
+static int write_all(int fd, const uint8 *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t ret = write(fd, buf, len);
+
+        if (ret < 0) {
+            if (errno == EINTR) continue;
+            return FALSE;
+        }
+        buf += ret;
+        len -= ret;
+    }
+
+    return TRUE;
+}
+
+
+/*
+ * precompiled_file_unpack() - Unpack an individual precompiled file to the
+ * specified output directory.  Files are read, and compressed files are
+ * decompressed, one block at a time, so that only a single block is held in
+ * memory.
+ */
+
+int precompiled_file_unpack(Options *op, const PrecompiledFileInfo *fileInfo,
+                            const char *output_directory)
+{
+    int ret = FALSE, dst_fd = -1, len;
+    char *dst_path;
+    uint8 *block = NULL;
+    const uint8 *data;
+    uint32 crc = ~0;
+    FileReader reader;
+
+    reader.fd = -1;
+
+    dst_path = nvstrcat(output_directory, "/", fileInfo->target_directory, "/",
+                        fileInfo->name, NULL);
+
+    /* extract file */
+
+    if ((dst_fd = open(dst_path, O_CREAT | O_WRONLY | O_TRUNC,
+                       S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)) == -1) {
+        ui_error(op, "Unable to open output file '%s' (%s).", dst_path,
+                 strerror(errno));
+        goto done;
+    }
+
+    if (!file_reader_open(&reader, fileInfo)) {
+        ui_error(op, "Unable to open '%s' (%s).", fileInfo->source_path,
+                 strerror(errno));
+        goto done;
+    }
+
+    block = nvalloc(PRECOMPILED_BLOCK_SIZE);
+
+    while ((len = file_reader_next(&reader, block, &data)) > 0) {
+        crc = compute_crc_update(crc, data, len);
+
+        if (!write_all(dst_fd, data, len)) {
+            goto write_error;
+        }
+    }
+
+    if (len < 0) {
+        ui_error(op, "The data for the file '%s' is corrupt or could not be "
+                 "read.", fileInfo->name);
+        goto done;
+    }
+
+    if (crc != fileInfo->crc) {
+        ui_log(op, "The CRC for the file '%s' (%" PRIu32 ") does not match the "
+               "expected value (%" PRIu32 ").", fileInfo->name, crc,
+               fileInfo->crc);
+    }
+
+    ret = TRUE;
+    goto done;
+
+write_error:
+    ui_error(op, "Unable to write output file '%s' (%s).", dst_path,
+             strerror(errno));
+
+done:
+
+    /* cleanup whatever needs cleaning up */
+
+    nvfree(dst_path);
+    nvfree(block);
+    file_reader_close(&reader);
+    if (dst_fd >= 0) close(dst_fd);
+
+    return ret;
+}
+
+
+/* precompiled_unpack() - unpack all of the files in a PrecompiledInfo into
+ * the given destination directory */
+int precompiled_unpack(Options *op, const PrecompiledInfo *info,
+                       const char *output_directory)
+{
+    int i;
+
+    if (!info) {
+        return FALSE;
+    }
+
+    for (i = 0; i < info->num_files; i++) {
+        if (!precompiled_file_unpack(op, &(info->files[i]), output_directory)) {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+
+
+
+/*
+ * encode_uint32() - given a uint32, a data buffer, and an offset into the data
+ * buffer, write the integer to the data buffer and advance the offset by the
+ * number of bytes written.
+ */
+
+static void encode_uint32(uint32 val, uint8 *data, int *offset)
+{
+    data[*offset + 0] = ((val >> 0)  & 0xff);
+    data[*offset + 1] = ((val >> 8)  & 0xff);
+    data[*offset + 2] = ((val >> 16) & 0xff);
+    data[*offset + 3] = ((val >> 24) & 0xff);
+
+    *offset += sizeof(uint32);
+}
+
+
+/*
+ * PackWriter: the output of precompiled_pack(), which is buffered and
+ * written with pwrite(), and the scratch buffers used to read, compress and
+ * compare the packaged files; a package of any size is written with this
+ * fixed amount of memory.
+ */
+
+#define PRECOMPILED_WRITE_BUFFER_SIZE (4 * PRECOMPILED_BLOCK_SIZE)
+
+typedef struct {
+    int fd;
+    int failed;
+    uint64_t offset;        /* offset in the package of buf[0] */
+    uint32 len;             /* bytes buffered in buf[] */
+    int crc_enabled;
+    uint32 crc;             /* CRC of the data put while crc_enabled */
+    uint8 buf[PRECOMPILED_WRITE_BUFFER_SIZE];
+    uint8 block[PRECOMPILED_BLOCK_SIZE];
+    uint8 packed[PRECOMPILED_BLOCK_SIZE];
+    uint32 table[1 << LZ4_HASH_BITS];
+} PackWriter;
+
+
+/*
+ * StoredPayload: where precompiled_pack() stored a packaged file, and how
+ * it is compressed.
+ */
+
+typedef struct {
+    uint64_t offset;
+    uint32 size;
+    uint32 compression;
+} StoredPayload;
+
+
+static int pwrite_all(int fd, const uint8 *buf, size_t len, uint64_t offset)
+{
+    while (len > 0) {
+        ssize_t ret = pwrite(fd, buf, len, offset);
+
+        if (ret < 0) {
+            if (errno == EINTR) continue;
+            return FALSE;
+        }
+        buf += ret;
+        len -= ret;
+        offset += ret;
+    }
+
+    return TRUE;
+}
+
+
+static void writer_flush(PackWriter *w)
+{
+    if (w->len > 0 && !w->failed &&
+        !pwrite_all(w->fd, w->buf, w->len, w->offset)) {
+        w->failed = TRUE;
+    }
+
+    w->offset += w->len;
+    w->len = 0;
+}
+
+
+static uint64_t writer_tell(const PackWriter *w)
+{
+    return w->offset + w->len;
+}
+
+
+/*
+ * writer_seek() - continue writing at the given offset of the package.  If
+ * the offset lies within the buffered data, the data after it is
+ * discarded.
+ */
+
+static void writer_seek(PackWriter *w, uint64_t offset)
+{
+    if (offset >= w->offset && offset <= writer_tell(w)) {
+        w->len = offset - w->offset;
+        return;
+    }
+
+    writer_flush(w);
+    w->offset = offset;
+}
+
+
+static void writer_put(PackWriter *w, const void *data, size_t len)
+{
+    if (w->crc_enabled) {
+        w->crc = compute_crc_update(w->crc, data, len);
+    }
+
+    if (w->len + len > sizeof(w->buf)) {
+        writer_flush(w);
+
+        /* write large buffers directly */
+
+        if (len > sizeof(w->buf)) {
+            if (!w->failed && !pwrite_all(w->fd, data, len, w->offset)) {
+                w->failed = TRUE;
+            }
+            w->offset += len;
+            return;
+        }
+    }
+
+    memcpy(w->buf + w->len, data, len);
+    w->len += len;
+}
+
+
+static void writer_put_uint32(PackWriter *w, uint32 val)
+{
+    uint8 data[4];
+    int offset = 0;
+
+    encode_uint32(val, data, &offset);
+    writer_put(w, data, sizeof(data));
+}
+
+
+/*
+ * writer_put_string() - write a length-prefixed string.
+ */
+
+static void writer_put_string(PackWriter *w, const char *str)
+{
+    uint32 len = strlen(str);
+
+    writer_put_uint32(w, len);
+    writer_put(w, str, len);
+}
+
+
+static void writer_begin_crc(PackWriter *w)
+{
+    w->crc = ~0;
+    w->crc_enabled = TRUE;
+}
+
+
+static void writer_put_crc(PackWriter *w)
+{
+    w->crc_enabled = FALSE;
+    writer_put_uint32(w, w->crc);
+}
+
+
+/*
+ * write_payload() - write the payload of a file at the current position of
+ * the package.  For version 3 and 4 packages, files are compressed one
+ * block at a time, unless compression does not make them any smaller, and
+ * files which are already compressed are copied as they are; version 2
+ * packages store files uncompressed.
+ */
+
+static int write_payload(PackWriter *w, const PrecompiledFileInfo *file,
+                         uint32 format_version, StoredPayload *payload)
+{
+    FileReader reader;
+    const uint8 *data;
+    uint64_t stored = 0;
+    int compress, len;
+
+    payload->offset = writer_tell(w);
+
+    if (format_version != PRECOMPILED_PKG_VERSION_2 && file->data &&
+        file->compression != PRECOMPILED_COMPRESSION_NONE) {
+        writer_put(w, file->data, file->stored_size);
+        payload->size = file->stored_size;
+        payload->compression = file->compression;
+        return TRUE;
+    }
+
+    compress = (format_version != PRECOMPILED_PKG_VERSION_2 && file->size > 0);
+
+ restart:
+
+    if (!file_reader_open(&reader, file)) {
+        return FALSE;
+    }
+
+    while ((len = file_reader_next(&reader, w->block, &data)) > 0) {
+        uint32 packed_len = 0;
+        uint8 header[8];
+        int offset = 0;
+
+        if (!compress) {
+            writer_put(w, data, len);
+            continue;
+        }
+
+        packed_len = lz4_compress_block(data, len, w->packed, len - 1,
+                                        w->table);
+
+        encode_uint32(len, header, &offset);
+        encode_uint32(packed_len ? packed_len :
+                                   (len | PRECOMPILED_BLOCK_UNCOMPRESSED),
+                      header, &offset);
+        writer_put(w, header, sizeof(header));
+        writer_put(w, packed_len ? w->packed : data,
+                   packed_len ? packed_len : len);
+
+        stored += sizeof(header) + (packed_len ? packed_len : len);
+
+        /* store the file uncompressed if compression does not help */
+
+        if (stored >= file->size) {
+            file_reader_close(&reader);
+            writer_seek(w, payload->offset);
+            compress = FALSE;
+            goto restart;
+        }
+    }
+
+    file_reader_close(&reader);
+
+    if (len < 0) {
+        return FALSE;
+    }
+
+    payload->size = compress ? stored : file->size;
+    payload->compression = compress ? PRECOMPILED_COMPRESSION_LZ4 :
+                                      PRECOMPILED_COMPRESSION_NONE;
+
+    return TRUE;
+}
+
+
+/*
+ * encode_files_v2() - write the files of a version 2 package, each with its
+ * metadata followed by its data.
+ */
+
+static int encode_files_v2(PackWriter *w, const PrecompiledInfo *info)
+{
+    StoredPayload payload;
+    int i;
+
+    for (i = 0; i < info->num_files; i++) {
+        PrecompiledFileInfo *file = &(info->files[i]);
+
+        /* file header */
+        writer_put(w, PRECOMPILED_FILE_HEADER, 4);
+
+        /* file sequence number */
+        writer_put_uint32(w, i);
+
+        /* file type and attributes*/
+        writer_put_uint32(w, file->type);
+        writer_put_uint32(w, file->attributes);
+
+        /* file name, linked module name, core object name, target dir */
+        writer_put_string(w, file->name);
+        writer_put_string(w, file->linked_module_name);
+        writer_put_string(w, file->core_object_name);
+        writer_put_string(w, file->target_directory);
+
+        /* crc */
+        writer_put_uint32(w, file->crc);
+
+        /* file */
+        writer_put_uint32(w, file->size);
+        if (!write_payload(w, file, PRECOMPILED_PKG_VERSION_2, &payload)) {
+            return FALSE;
+        }
+
+        /* redundant crc */
+        writer_put_uint32(w, file->crc);
 
-done:
+        /* linked module crc */
+        writer_put_uint32(w, file->linked_module_crc);
 
-    /* cleanup whatever needs cleaning up */
+        /* detached signature */
+        writer_put_uint32(w, file->signature_size);
+        if (file->signature_size) {
+            writer_put(w, file->signature, file->signature_size);
+        }
 
-    if (buf) munmap(buf, size);
-    if (fd >= 0) close(fd);
-    nvfree(description);
-    nvfree(proc_version_string);
-    nvfree(fileInfos);
-    nvfree(version);
+        /* redundant file sequence number */
+        writer_put_uint32(w, i);
 
-    return info;
+        /* file footer */
+        writer_put(w, PRECOMPILED_FILE_FOOTER, 4);
+    }
 
+    return TRUE;
 }
 
 
 /*
- * precompiled_file_unpack() - Unpack an individual precompiled file to the
- * specified output directory.
+ * file_entry_length() - the length of the file table entry of the given file
+ * in a version 3 or 4 package.
  */
 
-int precompiled_file_unpack(Options *op, const PrecompiledFileInfo *fileInfo,
-                            const char *output_directory)
+static int file_entry_length(const PrecompiledFileInfo *file)
 {
-    int ret = FALSE, dst_fd = 0;
-    char *dst_path, *dst = NULL;
+    return PRECOMPILED_FILE_ENTRY_CONSTANT_LENGTH +
+           strlen(file->name) +
+           strlen(file->linked_module_name) +
+           strlen(file->core_object_name) +
+           strlen(file->target_directory) +
+           file->signature_size;
+}
 
-    dst_path = nvstrcat(output_directory, "/", fileInfo->target_directory, "/",
-                        fileInfo->name, NULL);
 
-    /* extract file */
+/*
+ * encode_file_entry() - write the file table entry of a file with the given
+ * stored payload, in a version 3 or 4 package.
+ */
 
-    if ((dst_fd = open(dst_path, O_CREAT | O_RDWR | O_TRUNC,
-                       S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)) == -1) {
-        ui_error(op, "Unable to open output file '%s' (%s).", dst_path,
-                 strerror(errno));
-        goto done;
+static void encode_file_entry(PackWriter *w, const PrecompiledFileInfo *file,
+                              const StoredPayload *payload)
+{
+    writer_put_uint32(w, file->type);
+    writer_put_uint32(w, file->attributes);
+    writer_put_string(w, file->name);
+    writer_put_string(w, file->linked_module_name);
+    writer_put_string(w, file->core_object_name);
+    writer_put_string(w, file->target_directory);
+    writer_put_uint32(w, file->crc);
+    writer_put_uint32(w, file->size);
+    writer_put_uint32(w, payload->compression);
+    writer_put_uint32(w, payload->size);
+    writer_put_uint32(w, payload->offset & 0xffffffff);
+    writer_put_uint32(w, payload->offset >> 32);
+    writer_put_uint32(w, file->linked_module_crc);
+    writer_put_uint32(w, file->signature_size);
+    if (file->signature_size) {
+        writer_put(w, file->signature, file->signature_size);
     }
+}
 
-    /* set the output file length */
 
-    if ((lseek(dst_fd, fileInfo->size - 1, SEEK_SET) == -1) ||
-        (write(dst_fd, "", 1) == -1)) {
-        ui_error(op, "Unable to set output file '%s' length %d (%s).\n",
-                 dst_path, fileInfo->size, strerror(errno));
-        goto done;
-    }
+/*
+ * files_equal() - compare the contents of two files to be packed.
+ */
 
-    /* mmap the dst */
+static int files_equal(PackWriter *w, const PrecompiledFileInfo *a,
+                       const PrecompiledFileInfo *b)
+{
+    FileReader ra, rb;
+    const uint8 *da, *db;
+    int la, lb;
 
-    dst = mmap(0, fileInfo->size, PROT_READ|PROT_WRITE, MAP_FILE|MAP_SHARED, dst_fd, 0);
-    if (dst == (void *) -1) {
-        ui_error(op, "Unable to mmap output file %s (%s).\n",
-                 dst_path, strerror(errno));
-        goto done;
+    if (a->crc != b->crc || a->size != b->size) {
+        return FALSE;
     }
 
-    /* copy */
+    /* files loaded from the same payload of a package */
 
-    memcpy(dst, fileInfo->data, fileInfo->size);
-
-    ret = TRUE;
+    if (a->data && a->data == b->data && a->compression == b->compression &&
+        a->stored_size == b->stored_size) {
+        return TRUE;
+    }
 
-done:
+    if (!file_reader_open(&ra, a)) {
+        return FALSE;
+    }
+    if (!file_reader_open(&rb, b)) {
+        file_reader_close(&ra);
+        return FALSE;
+    }
 
-    /* cleanup whatever needs cleaning up */
+    do {
+        la = file_reader_next(&ra, w->block, &da);
+        lb = file_reader_next(&rb, w->packed, &db);
+    } while (la > 0 && la == lb && memcmp(da, db, la) == 0);
 
-    nvfree(dst_path);
-    if (dst) munmap(dst, fileInfo->size);
-    if (dst_fd > 0) close(dst_fd);
+    file_reader_close(&ra);
+    file_reader_close(&rb);
 
-    return ret;
+    return la == 0 && lb == 0;
 }
 
 
-/* precompiled_unpack() - unpack all of the files in a PrecompiledInfo into
- * the given destination directory */
-int precompiled_unpack(Options *op, const PrecompiledInfo *info,
-                       const char *output_directory)
+/*
+ * dedup_payloads() - find the files of a bundle which are identical to an
+ * earlier file, typically the same object built for several kernels, so
+ * that their payload is stored once.  On return, shared[i] is the index of
+ * the first file with the contents of file i.  Candidates are found with an
+ * open addressing hash table keyed by the files' CRCs, and compared in full.
+ */
+
+static void dedup_payloads(PackWriter *w, const PrecompiledInfo *info,
+                           int *shared)
 {
-    int i;
+    int table_size = 64, mask, i;
+    int *table;     /* file index + 1, or 0 for an empty slot */
 
-    if (!info) {
-        return FALSE;
+    while (table_size < info->num_files * 2) {
+        table_size *= 2;
     }
+    mask = table_size - 1;
+    table = nvalloc(table_size * sizeof(int));
 
     for (i = 0; i < info->num_files; i++) {
-        if (!precompiled_file_unpack(op, &(info->files[i]), output_directory)) {
-            return FALSE;
+        const PrecompiledFileInfo *file = &(info->files[i]);
+        int slot = file->crc & mask;
+
+        shared[i] = i;
+
+        while (table[slot]) {
+            int j = table[slot] - 1;
+
+            if (files_equal(w, &(info->files[j]), file)) {
+                shared[i] = j;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        if (shared[i] == i) {
+            table[slot] = i + 1;
         }
     }
 
-    return TRUE;
+    nvfree(table);
 }
 
 
-
-
 /*
- * encode_uint32() - given a uint32, a data buffer, and an offset into the data
- * buffer, write the integer to the data buffer and advance the offset by the
- * number of bytes written.
+ * KernelOrder: a kernel of a bundle, for sorting the kernel table.
  */
 
-static void encode_uint32(uint32 val, uint8 *data, int *offset)
+typedef struct {
+    uint32 hash;
+    const PrecompiledKernelInfo *kernel;
+} KernelOrder;
+
+
+static int compare_kernel_order(const void *a, const void *b)
 {
-    data[*offset + 0] = ((val >> 0)  & 0xff);
-    data[*offset + 1] = ((val >> 8)  & 0xff);
-    data[*offset + 2] = ((val >> 16) & 0xff);
-    data[*offset + 3] = ((val >> 24) & 0xff);
+    const KernelOrder *ka = a, *kb = b;
 
-    *offset += sizeof(uint32);
+    if (ka->hash != kb->hash) {
+        return ka->hash < kb->hash ? -1 : 1;
+    }
+
+    return strcmp(ka->kernel->proc_version_string,
+                  kb->kernel->proc_version_string);
 }
 
 
 /*
- * precompiled_pack() - pack the specified precompiled kernel interface
- * file, prepended with a header, the CRC the driver version, a description
- * string, and the proc version string.
+ * bundle_metadata_length() - sort the kernels of a bundle for its kernel
+ * table, and return the length of the bundle metadata.
  */
 
-int precompiled_pack(const PrecompiledInfo *info, const char *package_filename)
+static uint64_t bundle_metadata_length(const PrecompiledInfo *info,
+                                       KernelOrder *order)
 {
-    int fd, offset;
-    uint8 *out;
-    int version_len, description_len, proc_version_len;
-    int total_len, files_len, i;
+    uint64_t len = 4;
+    int i, j;
 
-    /*
-     * get the lengths of the description, the proc version string,
-     * and the files to be packaged along with the associated metadata.
-     */
+    for (i = 0; i < info->num_kernels; i++) {
+        const PrecompiledKernelInfo *kernel = &(info->kernels[i]);
 
-    version_len = strlen(info->version);
-    description_len = strlen(info->description);
-    proc_version_len = strlen(info->proc_version_string);
+        order[i].hash = hash_proc_version(kernel->proc_version_string);
+        order[i].kernel = kernel;
 
-    for (files_len = i = 0; i < info->num_files; i++) {
-        files_len += PRECOMPILED_FILE_CONSTANT_LENGTH +
-                     strlen(info->files[i].name) +
-                     strlen(info->files[i].linked_module_name) +
-                     strlen(info->files[i].core_object_name) +
-                     strlen(info->files[i].target_directory) +
-                     info->files[i].size +
-                     info->files[i].signature_size;
+        len += PRECOMPILED_KERNEL_RECORD_LENGTH +
+               strlen(kernel->proc_version_string) +
+               strlen(kernel->description);
+
+        for (j = 0; j < kernel->num_files; j++) {
+            len += file_entry_length(&(info->files[kernel->first_file + j]));
+        }
     }
 
-    total_len = PRECOMPILED_PKG_CONSTANT_LENGTH +
-        version_len + description_len + proc_version_len + files_len;
+    qsort(order, info->num_kernels, sizeof(KernelOrder), compare_kernel_order);
 
-    /* open the output file for writing */
+    return len;
+}
+
+
+/*
+ * encode_bundle_metadata() - write the metadata of a bundle, which starts
+ * at metadata_offset, and its CRC.
+ */
 
-    fd = nv_open(package_filename, O_CREAT|O_RDWR|O_TRUNC,
-                 S_IRUSR|S_IWUSR|S_IRGRP|S_IROTH);
+static void encode_bundle_metadata(PackWriter *w, const PrecompiledInfo *info,
+                                   const KernelOrder *order,
+                                   const StoredPayload *payloads,
+                                   const int *shared, uint32 metadata_offset)
+{
+    uint32 strings_offset, entries_offset;
+    int i, j;
+
+    strings_offset = metadata_offset + 4 +
+                     info->num_kernels * PRECOMPILED_KERNEL_RECORD_LENGTH;
+    entries_offset = strings_offset;
+    for (i = 0; i < info->num_kernels; i++) {
+        entries_offset += strlen(info->kernels[i].proc_version_string) +
+                          strlen(info->kernels[i].description);
+    }
 
-    /* set the output file length */
+    writer_begin_crc(w);
 
-    nv_set_file_length(package_filename, fd, total_len);
+    /* the kernel table */
 
-    /* map the output file */
+    writer_put_uint32(w, info->num_kernels);
 
-    out = nv_mmap(package_filename, total_len, PROT_READ|PROT_WRITE,
-                  MAP_FILE|MAP_SHARED, fd);
-    offset = 0;
+    for (i = 0; i < info->num_kernels; i++) {
+        const PrecompiledKernelInfo *kernel = order[i].kernel;
+        uint32 proc_version_len = strlen(kernel->proc_version_string);
+        uint32 description_len = strlen(kernel->description);
 
-    /* write the header */
+        writer_put_uint32(w, order[i].hash);
+        writer_put_uint32(w, strings_offset);
+        writer_put_uint32(w, proc_version_len);
+        writer_put_uint32(w, strings_offset + proc_version_len);
+        writer_put_uint32(w, description_len);
+        writer_put_uint32(w, entries_offset);
+        writer_put_uint32(w, kernel->num_files);
 
-    memcpy(&(out[0]), PRECOMPILED_PKG_HEADER, 8);
-    offset += 8;
+        strings_offset += proc_version_len + description_len;
+        for (j = 0; j < kernel->num_files; j++) {
+            entries_offset +=
+                file_entry_length(&(info->files[kernel->first_file + j]));
+        }
+    }
 
-    /* write the package version */
+    /* the kernel strings */
 
-    encode_uint32(PRECOMPILED_PKG_VERSION, out, &offset);
+    for (i = 0; i < info->num_kernels; i++) {
+        writer_put(w, order[i].kernel->proc_version_string,
+                   strlen(order[i].kernel->proc_version_string));
+        writer_put(w, order[i].kernel->description,
+                   strlen(order[i].kernel->description));
+    }
 
-    /* write the version */
+    /* the file table entries of each kernel */
 
-    encode_uint32(version_len, out, &offset);
+    for (i = 0; i < info->num_kernels; i++) {
+        const PrecompiledKernelInfo *kernel = order[i].kernel;
 
-    if (version_len) {
-        memcpy(&(out[offset]), info->version, version_len);
-        offset += version_len;
+        for (j = kernel->first_file;
+             j < kernel->first_file + kernel->num_files; j++) {
+            encode_file_entry(w, &(info->files[j]), &payloads[shared[j]]);
+        }
     }
 
-    /* write the description */
+    writer_put_crc(w);
+}
+
 
-    encode_uint32(description_len, out, &offset);
+/*
+ * precompiled_pack() - pack the specified precompiled kernel interface
+ * file, prepended with a header, the CRC the driver version, a description
+ * string, and the proc version string.  The package is written in the
+ * format version given by info->format_version, or PRECOMPILED_PKG_VERSION
+ * if that is 0.  Bundles are always written in format version 4; a single
+ * kernel loaded from a bundle is written as a package of its own.
+ *
+ * The package is streamed to the output with a fixed size buffer: for
+ * version 3 and 4 packages, the payloads are written first, after the space
+ * reserved for the file table or bundle metadata, which is written last,
+ * once the payload offsets and sizes are known.  Files are read one block
+ * at a time from memory or from their source files, so that packing does
+ * not need memory for the files or the package; payload offsets are 64-bit.
+ *
+ * The package is written to a temporary file which is then renamed over
+ * package_filename: the file data of 'info' may point into a mapping of
+ * the existing package, which must not be truncated while it is read.
+ */
 
-    if (description_len) {
-        memcpy(&(out[offset]), info->description, description_len);
-        offset += description_len;
+int precompiled_pack(const PrecompiledInfo *info, const char *package_filename)
+{
+    int fd, ret = FALSE, i;
+    char *tmp_filename;
+    uint32 format_version;
+    uint64_t table_offset, table_len, end;
+    StoredPayload *payloads;
+    PackWriter *w;
+    KernelOrder *order = NULL;
+    int *shared = NULL;
+
+    if (info->num_kernels > 0) {
+        format_version = PRECOMPILED_PKG_VERSION_4;
+    } else if (info->format_version &&
+               info->format_version != PRECOMPILED_PKG_VERSION_4) {
+        format_version = info->format_version;
+    } else {
+        format_version = PRECOMPILED_PKG_VERSION;
     }
 
-    /* write the proc version string */
+    /* open the output file for writing */
 
-    encode_uint32(proc_version_len, out, &offset);
+    tmp_filename = nvstrcat(package_filename, ".tmp", NULL);
 
-    memcpy(&(out[offset]), info->proc_version_string, proc_version_len);
-    offset += proc_version_len;
+    fd = open(tmp_filename, O_CREAT|O_WRONLY|O_TRUNC,
+              S_IRUSR|S_IWUSR|S_IRGRP|S_IROTH);
+    if (fd == -1) {
+        nvfree(tmp_filename);
+        return FALSE;
+    }
 
-    /* write the number of files */
+    w = nvalloc(sizeof(PackWriter));
+    w->fd = fd;
 
-    encode_uint32(info->num_files, out, &offset);
+    payloads = nvalloc((info->num_files + 1) * sizeof(StoredPayload));
 
-    /* write the files */
-    for (i = 0; i < info->num_files; i++) {
-        PrecompiledFileInfo *file = &(info->files[i]);
-        uint32 name_len = strlen(file->name);
-        uint32 linked_module_name_len = strlen(file->linked_module_name);
-        uint32 core_object_name_len = strlen(file->core_object_name);
-        uint32 target_directory_len = strlen(file->target_directory);
+    /* write the header, the package version, the version and description */
 
-        /* file header */
-        memcpy(&(out[offset]), PRECOMPILED_FILE_HEADER, 4);
-        offset += 4;
+    writer_put(w, PRECOMPILED_PKG_HEADER, 8);
+    writer_put_uint32(w, format_version);
+    writer_put_string(w, info->version);
+    writer_put_string(w, info->description);
 
-        /* file sequence number */
-        encode_uint32(i, out, &offset);
+    if (format_version == PRECOMPILED_PKG_VERSION_4) {
 
-        /* file type and attributes*/
-        encode_uint32(file->type, out, &offset);
-        encode_uint32(file->attributes, out, &offset);
+        /*
+         * write the payloads of the bundle, each only once, after the
+         * bundle metadata and its CRC
+         */
 
-        /* file name */
-        encode_uint32(name_len, out, &offset);
-        memcpy(&(out[offset]), file->name, name_len);
-        offset += name_len;
+        shared = nvalloc((info->num_files + 1) * sizeof(int));
+        dedup_payloads(w, info, shared);
 
-        /* linked module name */
-        encode_uint32(linked_module_name_len, out, &offset);
-        memcpy(&(out[offset]), file->linked_module_name, linked_module_name_len);
-        offset += linked_module_name_len;
+        order = nvalloc((info->num_kernels + 1) * sizeof(KernelOrder));
+        table_len = bundle_metadata_length(info, order);
 
-        /* core object name */
-        encode_uint32(core_object_name_len, out, &offset);
-        memcpy(&(out[offset]), file->core_object_name, core_object_name_len);
-        offset += core_object_name_len;
+        writer_put_uint32(w, table_len);
+        table_offset = writer_tell(w);
 
-        /* target directory name */
-        encode_uint32(target_directory_len, out, &offset);
-        memcpy(&(out[offset]), file->target_directory, target_directory_len);
-        offset += target_directory_len;
+        if (table_offset + table_len > UINT32_MAX) {
+            goto done;
+        }
 
-        /* crc */
-        encode_uint32(file->crc, out, &offset);
+        writer_seek(w, table_offset + table_len + 4);
 
-        /* file */
-        encode_uint32(file->size, out, &offset);
-        memcpy(&(out[offset]), file->data, file->size);
-        offset += file->size;
+        for (i = 0; i < info->num_files; i++) {
+            if (shared[i] == i &&
+                !write_payload(w, &(info->files[i]), format_version,
+                               &payloads[i])) {
+                goto done;
+            }
+        }
 
-        /* redundant crc */
-        encode_uint32(file->crc, out, &offset);
+        end = writer_tell(w);
 
-        /* linked module crc */
-        encode_uint32(file->linked_module_crc, out, &offset);
+        writer_seek(w, table_offset);
+        encode_bundle_metadata(w, info, order, payloads, shared, table_offset);
 
-        /* detached signature */
-        encode_uint32(file->signature_size, out, &offset);
-        if (file->signature_size) {
-            memcpy(&(out[offset]), file->signature, file->signature_size);
-            offset += file->signature_size;
+    } else {
+
+        /* write the proc version string and the number of files */
+
+        writer_put_string(w, info->proc_version_string);
+        writer_put_uint32(w, info->num_files);
+
+        if (format_version == PRECOMPILED_PKG_VERSION_2) {
+            if (!encode_files_v2(w, info)) {
+                goto done;
+            }
+            end = writer_tell(w);
+
+            /* version 2 packages are read with 32-bit offsets */
+
+            if (end > INT32_MAX) {
+                goto done;
+            }
+        } else {
+
+            /*
+             * write the payloads after the space for the file table and
+             * its CRC, then go back and write the file table
+             */
+
+            table_offset = writer_tell(w);
+            for (table_len = i = 0; i < info->num_files; i++) {
+                table_len += file_entry_length(&(info->files[i]));
+            }
+
+            writer_seek(w, table_offset + table_len + 4);
+
+            for (i = 0; i < info->num_files; i++) {
+                if (!write_payload(w, &(info->files[i]), format_version,
+                                   &payloads[i])) {
+                    goto done;
+                }
+            }
+
+            end = writer_tell(w);
+
+            writer_seek(w, table_offset);
+            writer_begin_crc(w);
+            for (i = 0; i < info->num_files; i++) {
+                encode_file_entry(w, &(info->files[i]), &payloads[i]);
+            }
+            writer_put_crc(w);
         }
+    }
 
-        /* redundant file sequence number */
-        encode_uint32(i, out, &offset);
+    writer_flush(w);
 
-        /* file footer */
-        memcpy(&(out[offset]), PRECOMPILED_FILE_FOOTER, 4);
-        offset += 4;
+    /*
+     * discard anything written past the end of the package while trying to
+     * compress its last payload
+     */
+
+    if (w->failed || ftruncate(fd, end) != 0) {
+        goto done;
     }
 
-    /* unmap package */
+    if (close(fd) != 0) {
+        fd = -1;
+        goto done;
+    }
+    fd = -1;
 
-    munmap(out, total_len);
+    /* move the package into place */
 
-    close(fd);
+    ret = (rename(tmp_filename, package_filename) == 0);
 
-    return TRUE;
+done:
+    if (fd >= 0) close(fd);
+    if (!ret) unlink(tmp_filename);
+    nvfree(tmp_filename);
+    nvfree(payloads);
+    nvfree(shared);
+    nvfree(order);
+    nvfree(w);
+
+    return ret;
 
 }
 
 
+
   
 /*
  * free_precompiled() - free any malloced strings stored in a PrecompiledInfo,
@@ -648,6 +2106,21 @@ void free_precompiled(PrecompiledInfo *info)
     }
     nvfree(info->files);
 
+    for (i = 0; i < info->num_kernels; i++) {
+        nvfree(info->kernels[i].proc_version_string);
+        nvfree(info->kernels[i].description);
+    }
+    nvfree(info->kernels);
+
+    for (i = 0; i < info->num_sources; i++) {
+        free_precompiled(info->sources[i]);
+    }
+    nvfree(info->sources);
+
+    if (info->package_data) {
+        munmap(info->package_data, info->package_size);
+    }
+
     nvfree(info);
 }
 
@@ -657,9 +2130,12 @@ void free_precompiled_file_data(PrecompiledFileInfo fileInfo)
 {
     nvfree(fileInfo.name);
     nvfree(fileInfo.linked_module_name);
-    nvfree(fileInfo.data);
+    if (!fileInfo.data_is_mapped) {
+        nvfree(fileInfo.data);
+    }
     nvfree(fileInfo.signature);
     nvfree(fileInfo.target_directory);
+    nvfree(fileInfo.source_path);
 }
 
 
@@ -669,6 +2145,10 @@ void free_precompiled_file_data(PrecompiledFileInfo fileInfo)
  * populate a PrecompiledFileInfo record with its contents and the appropriate
  * metadata. Return a pointer to a newly allocated PrecompiledFile record on
  * success, or NULL on failure.
+ *
+ * If load_data is FALSE, the contents are not kept in memory: only the CRC
+ * is computed, and precompiled_pack() reads the file again from 'filename'
+ * when writing the package.
  */
 
 static int precompiled_read_file(PrecompiledFileInfo *fileInfo,
@@ -676,7 +2156,7 @@ static int precompiled_read_file(PrecompiledFileInfo *fileInfo,
                                  const char *linked_module_name,
                                  const char *core_object_name,
                                  const char *target_directory,
-                                 uint32 type)
+                                 uint32 type, int load_data)
 {
     int fd;
     struct stat st;
@@ -687,17 +2167,46 @@ static int precompiled_read_file(PrecompiledFileInfo *fileInfo,
         goto done;
     }
 
-    if (fstat(fd, &st) != 0) {
+    if (fstat(fd, &st) != 0 || st.st_size > 0xffffffff) {
         goto done;
     }
 
     fileInfo->size = st.st_size;
-    fileInfo->data = nvalloc(fileInfo->size);
+    fileInfo->data = NULL;
+    fileInfo->source_path = NULL;
+    fileInfo->data_is_mapped = FALSE;
+    fileInfo->compression = PRECOMPILED_COMPRESSION_NONE;
+    fileInfo->stored_size = fileInfo->size;
 
-    ret = read(fd, fileInfo->data, fileInfo->size);
+    if (load_data) {
+        fileInfo->data = nvalloc(fileInfo->size);
 
-    if (ret != fileInfo->size) {
-        goto done;
+        ret = read(fd, fileInfo->data, fileInfo->size);
+
+        if (ret != fileInfo->size) {
+            goto done;
+        }
+
+        fileInfo->crc = compute_crc(NULL, filename);
+    } else {
+        uint8 block[PRECOMPILED_BLOCK_SIZE];
+        uint32 crc = ~0, total = 0;
+
+        while ((ret = read(fd, block, sizeof(block))) != 0) {
+            if (ret < 0) {
+                if (errno == EINTR) continue;
+                goto done;
+            }
+            crc = compute_crc_update(crc, block, ret);
+            total += ret;
+        }
+
+        if (total != fileInfo->size) {
+            goto done;
+        }
+
+        fileInfo->crc = total ? crc : 0;
+        fileInfo->source_path = nvstrdup(filename);
     }
 
     fileInfo->type = type;
@@ -705,7 +2214,6 @@ static int precompiled_read_file(PrecompiledFileInfo *fileInfo,
     fileInfo->linked_module_name = nvstrdup(linked_module_name);
     fileInfo->core_object_name = nvstrdup(core_object_name);
     fileInfo->target_directory = nvstrdup(target_directory);
-    fileInfo->crc = compute_crc(NULL, filename);
 
     success = TRUE;
 
@@ -719,18 +2227,18 @@ int precompiled_read_interface(PrecompiledFileInfo *fileInfo,
                                const char *filename,
                                const char *linked_module_name,
                                const char *core_object_name,
-                               const char *target_directory)
+                               const char *target_directory, int load_data)
 {
     return precompiled_read_file(fileInfo, filename, linked_module_name,
                                  core_object_name, target_directory,
-                                 PRECOMPILED_FILE_TYPE_INTERFACE);
+                                 PRECOMPILED_FILE_TYPE_INTERFACE, load_data);
 }
 
 int precompiled_read_module(PrecompiledFileInfo *fileInfo, const char *filename,
-                            const char *target_directory)
+                            const char *target_directory, int load_data)
 {
     return precompiled_read_file(fileInfo, filename, "", "", target_directory,
-                                 PRECOMPILED_FILE_TYPE_MODULE);
+                                 PRECOMPILED_FILE_TYPE_MODULE, load_data);
 }
 
 
@@ -831,8 +2339,15 @@ static int precompiled_read_fileinfo(Options *op, PrecompiledFileInfo *fileInfos
         return -1;
     }
 
-    fileInfo->data = nvalloc(fileInfo->size);
-    memcpy(fileInfo->data, buf + offset, fileInfo->size);
+    /*
+     * point into the package mapping rather than copying the file; its CRC
+     * is checked when it is unpacked
+     */
+
+    fileInfo->data = (uint8 *) buf + offset;
+    fileInfo->data_is_mapped = TRUE;
+    fileInfo->compression = PRECOMPILED_COMPRESSION_NONE;
+    fileInfo->stored_size = fileInfo->size;
     offset += fileInfo->size;
 
     val = read_uint32(buf, &offset);
@@ -843,13 +2358,6 @@ static int precompiled_read_fileinfo(Options *op, PrecompiledFileInfo *fileInfos
         return -1;
     }
 
-    val = compute_crc_from_buffer(fileInfo->data, fileInfo->size);
-    if (val != fileInfo->crc) {
-        ui_log(op, "The CRC for the file '%s' (%" PRIu32 ") does not match the "
-               "expected value (%" PRIu32 ").", fileInfo->name, val,
-               fileInfo->crc);
-    }
-
     fileInfo->linked_module_crc = read_uint32(buf, &offset);
 
     fileInfo->signature_size = read_uint32(buf, &offset);
@@ -873,7 +2381,110 @@ static int precompiled_read_fileinfo(Options *op, PrecompiledFileInfo *fileInfos
         ui_log(op, "Unrecognized footer for packaged file.");
         return -1;
     }
-    offset += 4;
+    offset += 4;
+
+    return offset - oldoffset;
+}
+
+
+/*
+ * read_entry_string() - read a length-prefixed string from a version 3 file
+ * table entry into a newly allocated, NUL terminated string.  Returns NULL
+ * if the string would extend past the end of the package.
+ */
+
+static char *read_entry_string(const char *buf, int *offset, int size)
+{
+    uint32 len;
+
+    if (size - *offset < 4) {
+        return NULL;
+    }
+
+    len = read_uint32(buf, offset);
+    if (len > size - *offset) {
+        return NULL;
+    }
+
+    *offset += len;
+
+    return nvstrndup(buf + *offset - len, len);
+}
+
+
+/*
+ * precompiled_read_file_entry() - Read a PrecompiledFileInfo record from the
+ * file table of a version 3 package.  The parameters and return value are
+ * the same as for precompiled_read_fileinfo(); the file data is not read,
+ * but the data pointer is set to the file's stored payload in the package.
+ */
+
+static int precompiled_read_file_entry(Options *op,
+                                       PrecompiledFileInfo *fileInfos,
+                                       int index, char *buf, int offset,
+                                       int size, uint64_t package_size)
+{
+    PrecompiledFileInfo *fileInfo = fileInfos + index;
+    uint64_t data_offset;
+    int oldoffset = offset;
+
+    if (size - offset < PRECOMPILED_FILE_ENTRY_CONSTANT_LENGTH) {
+        return -1;
+    }
+
+    fileInfo->type = read_uint32(buf, &offset);
+    fileInfo->attributes = read_uint32(buf, &offset);
+
+    if (!(fileInfo->name = read_entry_string(buf, &offset, size)) ||
+        !(fileInfo->linked_module_name =
+              read_entry_string(buf, &offset, size)) ||
+        !(fileInfo->core_object_name = read_entry_string(buf, &offset, size)) ||
+        !(fileInfo->target_directory = read_entry_string(buf, &offset, size))) {
+        ui_log(op, "Bad string length in file table entry %d.", index);
+        return -1;
+    }
+
+    if (size - offset < 32) {
+        ui_log(op, "Truncated file table entry %d.", index);
+        return -1;
+    }
+
+    fileInfo->crc = read_uint32(buf, &offset);
+    fileInfo->size = read_uint32(buf, &offset);
+    fileInfo->compression = read_uint32(buf, &offset);
+    fileInfo->stored_size = read_uint32(buf, &offset);
+    data_offset = read_uint32(buf, &offset);
+    data_offset |= (uint64_t) read_uint32(buf, &offset) << 32;
+    fileInfo->linked_module_crc = read_uint32(buf, &offset);
+    fileInfo->signature_size = read_uint32(buf, &offset);
+
+    if (fileInfo->compression != PRECOMPILED_COMPRESSION_NONE &&
+        fileInfo->compression != PRECOMPILED_COMPRESSION_LZ4) {
+        ui_log(op, "Unknown compression method %d for file '%s'.",
+               fileInfo->compression, fileInfo->name);
+        return -1;
+    }
+
+    if ((fileInfo->compression == PRECOMPILED_COMPRESSION_NONE &&
+         fileInfo->stored_size != fileInfo->size) ||
+        data_offset > package_size ||
+        fileInfo->stored_size > package_size - data_offset) {
+        ui_log(op, "Bad data location for file '%s'.", fileInfo->name);
+        return -1;
+    }
+
+    fileInfo->data = (uint8 *) buf + data_offset;
+    fileInfo->data_is_mapped = TRUE;
+
+    if (fileInfo->signature_size) {
+        if (fileInfo->signature_size > size - offset) {
+            ui_log(op, "Bad signature size");
+            return -1;
+        }
+        fileInfo->signature = nvalloc(fileInfo->signature_size);
+        memcpy(fileInfo->signature, buf + offset, fileInfo->signature_size);
+        offset += fileInfo->signature_size;
+    }
 
     return offset - oldoffset;
 }
@@ -914,6 +2525,107 @@ void precompiled_append_files(PrecompiledInfo *info, PrecompiledFileInfo *files,
     info->num_files += num_files;
 }
 
+
+/*
+ * bundle_remove_kernel() - remove the kernel with the given proc version
+ * string, and its files, from the bundle.
+ */
+
+static void bundle_remove_kernel(PrecompiledInfo *bundle,
+                                 const char *proc_version_string)
+{
+    PrecompiledKernelInfo kernel;
+    int i, j;
+
+    for (i = 0; i < bundle->num_kernels; i++) {
+        if (strcmp(bundle->kernels[i].proc_version_string,
+                   proc_version_string) == 0) {
+            break;
+        }
+    }
+
+    if (i == bundle->num_kernels) {
+        return;
+    }
+
+    kernel = bundle->kernels[i];
+
+    for (j = 0; j < kernel.num_files; j++) {
+        free_precompiled_file_data(bundle->files[kernel.first_file + j]);
+    }
+    memmove(bundle->files + kernel.first_file,
+            bundle->files + kernel.first_file + kernel.num_files,
+            (bundle->num_files - kernel.first_file - kernel.num_files) *
+            sizeof(PrecompiledFileInfo));
+    bundle->num_files -= kernel.num_files;
+
+    nvfree(kernel.proc_version_string);
+    nvfree(kernel.description);
+    memmove(bundle->kernels + i, bundle->kernels + i + 1,
+            (bundle->num_kernels - i - 1) * sizeof(PrecompiledKernelInfo));
+    bundle->num_kernels--;
+
+    for (j = 0; j < bundle->num_kernels; j++) {
+        if (bundle->kernels[j].first_file > kernel.first_file) {
+            bundle->kernels[j].first_file -= kernel.num_files;
+        }
+    }
+}
+
+
+/*
+ * precompiled_bundle_add() - add the kernels of the package 'info', which
+ * may itself be a bundle, to the given bundle, replacing any kernels of the
+ * bundle with the same proc version strings.  The files of 'info' are moved
+ * into the bundle, and since their data may point into the mapping of the
+ * package, the bundle takes ownership of 'info': it is freed along with the
+ * bundle, and must not be used or freed by the caller.
+ */
+
+void precompiled_bundle_add(PrecompiledInfo *bundle, PrecompiledInfo *info)
+{
+    PrecompiledKernelInfo single, *kernels = info->kernels;
+    int num_kernels = info->num_kernels, i;
+
+    if (num_kernels == 0) {
+        single.proc_version_string = info->proc_version_string;
+        single.description = info->description;
+        single.first_file = 0;
+        single.num_files = info->num_files;
+        kernels = &single;
+        num_kernels = 1;
+    }
+
+    for (i = 0; i < num_kernels; i++) {
+        PrecompiledKernelInfo *kernel;
+
+        bundle_remove_kernel(bundle, kernels[i].proc_version_string);
+
+        bundle->kernels = nvrealloc(bundle->kernels,
+                                    (bundle->num_kernels + 1) *
+                                    sizeof(PrecompiledKernelInfo));
+        kernel = &(bundle->kernels[bundle->num_kernels++]);
+
+        kernel->proc_version_string = nvstrdup(kernels[i].proc_version_string);
+        kernel->description = nvstrdup(kernels[i].description);
+        kernel->first_file = bundle->num_files;
+        kernel->num_files = kernels[i].num_files;
+
+        precompiled_append_files(bundle, info->files + kernels[i].first_file,
+                                 kernels[i].num_files);
+    }
+
+    /* the files now belong to the bundle */
+
+    nvfree(info->files);
+    info->files = NULL;
+    info->num_files = 0;
+
+    bundle->sources = nvrealloc(bundle->sources, (bundle->num_sources + 1) *
+                                sizeof(PrecompiledInfo *));
+    bundle->sources[bundle->num_sources++] = info;
+}
+
 /*
  * precompiled_file_type_name() - return a pointer to a human-readable string
  * naming a file type. The string should not be freed.
@@ -932,6 +2644,24 @@ const char *precompiled_file_type_name(uint32 file_type)
     return file_type_names[file_type];
 }
 
+/*
+ * precompiled_compression_name() - return a pointer to a human-readable
+ * string naming a compression method. The string should not be freed.
+ */
+const char *precompiled_compression_name(uint32 compression)
+{
+    static const char *compression_names[] = {
+                                                 "none",
+                                                 "lz4",
+                                             };
+
+    if (compression >= ARRAY_LEN(compression_names)) {
+        return "unknown compression method";
+    }
+
+    return compression_names[compression];
+}
+
 /*
  * precompiled_file_attribute_names() - return a NULL-terminated list of
  * human-readable strings naming the attributes in the given file attribute
@@ -1016,3 +2746,510 @@ done:
     }
     return size;
 }
+
+
+
+/*
+ * Precompiled package directory index; see precompiled.h for a description
+ * of the file format.
+ */
+
+typedef struct {
+    uint32 flags;
+    uint32 num_hashes;
+    uint32 *proc_version_hashes;
+    uint64_t size;
+    uint64_t mtime_ns;
+    char *name;
+    char *version;
+    int seen;
+} PrecompiledIndexEntry;
+
+
+static uint64_t stat_mtime_ns(const struct stat *st)
+{
+    return (uint64_t) st->st_mtim.tv_sec * 1000000000ull + st->st_mtim.tv_nsec;
+}
+
+
+/*
+ * is_index_file() - return TRUE if the directory entry 'name' is the index
+ * itself, or a temporary file left behind while writing it.
+ */
+
+static int is_index_file(const char *name)
+{
+    return strncmp(name, PRECOMPILED_INDEX_FILENAME,
+                   strlen(PRECOMPILED_INDEX_FILENAME)) == 0;
+}
+
+
+static int compare_index_entries(const void *a, const void *b)
+{
+    return strcmp(((const PrecompiledIndexEntry *) a)->name,
+                  ((const PrecompiledIndexEntry *) b)->name);
+}
+
+
+static PrecompiledIndexEntry *find_index_entry(PrecompiledIndexEntry *entries,
+                                               int num_entries,
+                                               const char *name)
+{
+    PrecompiledIndexEntry key;
+
+    if (num_entries == 0) {
+        return NULL;
+    }
+
+    key.name = (char *) name;
+
+    return bsearch(&key, entries, num_entries, sizeof(PrecompiledIndexEntry),
+                   compare_index_entries);
+}
+
+
+static void free_index_entries(PrecompiledIndexEntry *entries, int num_entries)
+{
+    int i;
+
+    for (i = 0; i < num_entries; i++) {
+        nvfree(entries[i].proc_version_hashes);
+        nvfree(entries[i].name);
+        nvfree(entries[i].version);
+    }
+    nvfree(entries);
+}
+
+
+/*
+ * read_index_string() - read a length-prefixed string from the index buffer
+ * into a newly allocated, NUL terminated string.  Returns NULL if the string
+ * would extend past the end of the buffer.
+ */
+
+static char *read_index_string(const char *buf, int *offset, int size)
+{
+    uint32 len;
+    char *str;
+
+    if (size - *offset < 4) {
+        return NULL;
+    }
+
+    len = read_uint32(buf, offset);
+    if (len > size - *offset) {
+        return NULL;
+    }
+
+    str = nvalloc(len + 1);
+    memcpy(str, buf + *offset, len);
+    *offset += len;
+
+    return str;
+}
+
+
+/*
+ * read_precompiled_index() - load the index of the given directory, sorted
+ * by file name.  Returns FALSE if there is no index, or if it is not valid.
+ */
+
+static int read_precompiled_index(Options *op, const char *directory,
+                                  PrecompiledIndexEntry **entries,
+                                  int *num_entries)
+{
+    int fd, offset, size, i, n = 0, ret = FALSE;
+    char *filename, *buf = MAP_FAILED;
+    PrecompiledIndexEntry *e = NULL;
+    struct stat stat_buf;
+
+    *entries = NULL;
+    *num_entries = 0;
+
+    filename = nvstrcat(directory, "/", PRECOMPILED_INDEX_FILENAME, NULL);
+
+    fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+        goto done;
+    }
+
+    if (fstat(fd, &stat_buf) == -1 ||
+        stat_buf.st_size < PRECOMPILED_INDEX_CONSTANT_LENGTH ||
+        stat_buf.st_size > INT32_MAX) {
+        goto invalid;
+    }
+    size = stat_buf.st_size;
+
+    buf = mmap(0, size, PROT_READ, MAP_FILE|MAP_SHARED, fd, 0);
+    if (buf == MAP_FAILED) {
+        goto invalid;
+    }
+
+    if (memcmp(buf, PRECOMPILED_INDEX_HEADER, 8) != 0) {
+        goto invalid;
+    }
+    offset = 8;
+
+    if (read_uint32(buf, &offset) != PRECOMPILED_INDEX_VERSION) {
+        goto invalid;
+    }
+
+    n = read_uint32(buf, &offset);
+    if (n < 0 || n > (size - offset) / PRECOMPILED_INDEX_ENTRY_CONSTANT_LENGTH) {
+        n = 0;
+        goto invalid;
+    }
+
+    e = nvalloc((n + 1) * sizeof(PrecompiledIndexEntry));
+
+    for (i = 0; i < n; i++) {
+        uint64_t lo, hi;
+        uint32 j;
+
+        if (size - offset < PRECOMPILED_INDEX_ENTRY_CONSTANT_LENGTH) {
+            goto invalid;
+        }
+
+        e[i].flags = read_uint32(buf, &offset);
+        e[i].num_hashes = read_uint32(buf, &offset);
+
+        if (e[i].num_hashes > (size - offset -
+                               PRECOMPILED_INDEX_ENTRY_CONSTANT_LENGTH + 8) /
+                              4) {
+            goto invalid;
+        }
+        e[i].proc_version_hashes = nvalloc((e[i].num_hashes + 1) *
+                                           sizeof(uint32));
+        for (j = 0; j < e[i].num_hashes; j++) {
+            e[i].proc_version_hashes[j] = read_uint32(buf, &offset);
+        }
+
+        lo = read_uint32(buf, &offset);
+        hi = read_uint32(buf, &offset);
+        e[i].size = lo | (hi << 32);
+        lo = read_uint32(buf, &offset);
+        hi = read_uint32(buf, &offset);
+        e[i].mtime_ns = lo | (hi << 32);
+
+        e[i].name = read_index_string(buf, &offset, size);
+        if (!e[i].name) {
+            goto invalid;
+        }
+        e[i].version = read_index_string(buf, &offset, size);
+        if (!e[i].version) {
+            goto invalid;
+        }
+    }
+
+    qsort(e, n, sizeof(PrecompiledIndexEntry), compare_index_entries);
+
+    *entries = e;
+    *num_entries = n;
+    e = NULL;
+    ret = TRUE;
+    goto done;
+
+ invalid:
+    ui_log(op, "Ignoring invalid precompiled package index '%s'.", filename);
+
+ done:
+    if (e) free_index_entries(e, n);
+    if (buf != MAP_FAILED) munmap(buf, size);
+    if (fd != -1) close(fd);
+    nvfree(filename);
+
+    return ret;
+}
+
+
+static void write_index_uint32(FILE *fp, uint32 val)
+{
+    uint8 data[4];
+    int offset = 0;
+
+    encode_uint32(val, data, &offset);
+    fwrite(data, 1, sizeof(data), fp);
+}
+
+
+static void write_index_string(FILE *fp, const char *str)
+{
+    uint32 len = strlen(str);
+
+    write_index_uint32(fp, len);
+    fwrite(str, 1, len, fp);
+}
+
+
+/*
+ * precompiled_update_index() - rebuild the index of the precompiled packages
+ * in the given directory.  Entries of the existing index are reused for
+ * files whose size and modification time have not changed, so that only new
+ * or modified files need to be read.  The index is written to a temporary
+ * file, then renamed into place.
+ */
+
+int precompiled_update_index(Options *op, const char *directory)
+{
+    PrecompiledIndexEntry *old_entries, *entries = NULL;
+    int num_old_entries, num_entries = 0, max_entries = 0, i, ret = FALSE;
+    int write_failed;
+    char *filename, *tmpfile;
+    struct dirent *ent;
+    DIR *dir;
+    FILE *fp;
+
+    read_precompiled_index(op, directory, &old_entries, &num_old_entries);
+
+    filename = nvstrcat(directory, "/", PRECOMPILED_INDEX_FILENAME, NULL);
+    tmpfile = nvstrcat(filename, ".tmp", NULL);
+
+    dir = opendir(directory);
+    if (!dir) {
+        ui_warn(op, "Unable to open directory '%s' (%s).", directory,
+                strerror(errno));
+        goto done;
+    }
+
+    while ((ent = readdir(dir)) != NULL) {
+        PrecompiledIndexEntry *e, *old;
+        struct stat stat_buf;
+        char *path;
+
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0 ||
+            is_index_file(ent->d_name)) {
+            continue;
+        }
+
+        path = nvstrcat(directory, "/", ent->d_name, NULL);
+
+        if (stat(path, &stat_buf) == -1) {
+            nvfree(path);
+            continue;
+        }
+
+        if (num_entries >= max_entries) {
+            max_entries = max_entries ? max_entries * 2 : 64;
+            entries = nvrealloc(entries,
+                                max_entries * sizeof(PrecompiledIndexEntry));
+        }
+        e = &entries[num_entries++];
+        memset(e, 0, sizeof(*e));
+
+        e->name = nvstrdup(ent->d_name);
+        e->size = stat_buf.st_size;
+        e->mtime_ns = stat_mtime_ns(&stat_buf);
+
+        old = find_index_entry(old_entries, num_old_entries, ent->d_name);
+
+        if (old && old->size == e->size && old->mtime_ns == e->mtime_ns) {
+            e->flags = old->flags;
+            e->num_hashes = old->num_hashes;
+            e->proc_version_hashes = nvalloc((old->num_hashes + 1) *
+                                             sizeof(uint32));
+            memcpy(e->proc_version_hashes, old->proc_version_hashes,
+                   old->num_hashes * sizeof(uint32));
+            e->version = nvstrdup(old->version);
+        } else if (S_ISREG(stat_buf.st_mode)) {
+            PrecompiledInfo *info = get_precompiled_info(op, path, NULL, NULL,
+                                                         NULL);
+            if (info) {
+                int j;
+
+                e->flags = PRECOMPILED_INDEX_IS_PACKAGE;
+                e->num_hashes = info->num_kernels ? info->num_kernels : 1;
+                e->proc_version_hashes = nvalloc(e->num_hashes *
+                                                 sizeof(uint32));
+                if (info->num_kernels) {
+                    for (j = 0; j < info->num_kernels; j++) {
+                        e->proc_version_hashes[j] = hash_proc_version(
+                            info->kernels[j].proc_version_string);
+                    }
+                } else {
+                    e->proc_version_hashes[0] =
+                        hash_proc_version(info->proc_version_string);
+                }
+                e->version = nvstrdup(info->version);
+                free_precompiled(info);
+            }
+        }
+
+        if (!e->version) {
+            e->version = nvstrdup("");
+        }
+
+        nvfree(path);
+    }
+
+    closedir(dir);
+
+    fp = fopen(tmpfile, "w");
+    if (!fp) {
+        ui_warn(op, "Unable to create the precompiled package index '%s' (%s).",
+                tmpfile, strerror(errno));
+        goto done;
+    }
+
+    fwrite(PRECOMPILED_INDEX_HEADER, 1, 8, fp);
+    write_index_uint32(fp, PRECOMPILED_INDEX_VERSION);
+    write_index_uint32(fp, num_entries);
+
+    for (i = 0; i < num_entries; i++) {
+        uint32 j;
+
+        write_index_uint32(fp, entries[i].flags);
+        write_index_uint32(fp, entries[i].num_hashes);
+        for (j = 0; j < entries[i].num_hashes; j++) {
+            write_index_uint32(fp, entries[i].proc_version_hashes[j]);
+        }
+        write_index_uint32(fp, entries[i].size & 0xffffffff);
+        write_index_uint32(fp, entries[i].size >> 32);
+        write_index_uint32(fp, entries[i].mtime_ns & 0xffffffff);
+        write_index_uint32(fp, entries[i].mtime_ns >> 32);
+        write_index_string(fp, entries[i].name);
+        write_index_string(fp, entries[i].version);
+    }
+
+    write_failed = ferror(fp);
+    if (fclose(fp) != 0) {
+        write_failed = TRUE;
+    }
+
+    if (write_failed || rename(tmpfile, filename) != 0) {
+        ui_warn(op, "Unable to write the precompiled package index '%s' (%s).",
+                filename, strerror(errno));
+        unlink(tmpfile);
+        goto done;
+    }
+
+    ret = TRUE;
+
+ done:
+    free_index_entries(old_entries, num_old_entries);
+    free_index_entries(entries, num_entries);
+    nvfree(tmpfile);
+    nvfree(filename);
+
+    return ret;
+}
+
+
+/*
+ * precompiled_index_lookup() - use the index of the given directory to find
+ * the packages which may match the given proc version string and package
+ * version; either may be NULL to match any value.  A bundle matches if any
+ * of its kernels does.  The candidates still need to be validated with
+ * get_precompiled_info(), since the index only records hashes of the proc
+ * version strings.
+ *
+ * The index is only trusted if every file in the directory is listed in it
+ * with an unchanged size and modification time, and every file it lists
+ * still exists.  Returns a NULL-terminated list of paths, which should be
+ * freed with precompiled_free_index_lookup(), or NULL if there is no index
+ * or it is out of date; the caller should then scan the directory.
+ */
+
+char **precompiled_index_lookup(Options *op, const char *directory,
+                                const char *proc_version_string,
+                                const char *package_version)
+{
+    PrecompiledIndexEntry *entries;
+    int num_entries, num_seen = 0, num_candidates = 0, i, stale = FALSE;
+    uint32 proc_version_hash = 0;
+    struct dirent *ent;
+    char **candidates = NULL;
+    DIR *dir;
+
+    if (!read_precompiled_index(op, directory, &entries, &num_entries)) {
+        return NULL;
+    }
+
+    dir = opendir(directory);
+    if (!dir) {
+        goto done;
+    }
+
+    while (!stale && (ent = readdir(dir)) != NULL) {
+        PrecompiledIndexEntry *e;
+        struct stat stat_buf;
+        char *path;
+
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0 ||
+            is_index_file(ent->d_name)) {
+            continue;
+        }
+
+        e = find_index_entry(entries, num_entries, ent->d_name);
+        if (!e || e->seen) {
+            stale = TRUE;
+            break;
+        }
+
+        path = nvstrcat(directory, "/", ent->d_name, NULL);
+
+        if (stat(path, &stat_buf) == -1 ||
+            (uint64_t) stat_buf.st_size != e->size ||
+            stat_mtime_ns(&stat_buf) != e->mtime_ns) {
+            stale = TRUE;
+        }
+
+        nvfree(path);
+
+        e->seen = TRUE;
+        num_seen++;
+    }
+
+    closedir(dir);
+
+    if (stale || num_seen != num_entries) {
+        ui_log(op, "The precompiled package index in '%s' is out of date.",
+               directory);
+        goto done;
+    }
+
+    if (proc_version_string) {
+        proc_version_hash = hash_proc_version(proc_version_string);
+    }
+
+    candidates = nvalloc((num_entries + 1) * sizeof(char *));
+
+    for (i = 0; i < num_entries; i++) {
+        uint32 j;
+
+        for (j = 0; proc_version_string && j < entries[i].num_hashes; j++) {
+            if (entries[i].proc_version_hashes[j] == proc_version_hash) {
+                break;
+            }
+        }
+
+        if (!(entries[i].flags & PRECOMPILED_INDEX_IS_PACKAGE) ||
+            (proc_version_string && j == entries[i].num_hashes) ||
+            (package_version &&
+             strcmp(entries[i].version, package_version) != 0)) {
+            continue;
+        }
+
+        candidates[num_candidates++] =
+            nvstrcat(directory, "/", entries[i].name, NULL);
+    }
+
+ done:
+    free_index_entries(entries, num_entries);
+
+    return candidates;
+}
+
+
+void precompiled_free_index_lookup(char **candidates)
+{
+    int i;
+
+    if (!candidates) {
+        return;
+    }
+
+    for (i = 0; candidates[i]; i++) {
+        nvfree(candidates[i]);
+    }
+    nvfree(candidates);
+}
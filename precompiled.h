@@ -19,7 +19,18 @@
  * precompiled.h: common definitions for mkprecompiled and nvidia-installer's
  *                precompiled kernel interface/module package format
  *
- * The format of a precompiled kernel interface package is:
+ * There are three versions of the precompiled package format.  Version 2
+ * stores each file uncompressed, together with its metadata.  Version 3
+ * stores a table of the files' metadata at the front of the package,
+ * followed by the files' payloads, which may be compressed; a single file
+ * can then be found and extracted without reading the others.  Version 4
+ * packages, or bundles, hold the files of several kernels, with a table of
+ * the kernels sorted by a hash of their proc version strings; files which
+ * are identical for several kernels are stored once.  All versions can be
+ * read and written; new packages use version 3 by default, and bundles use
+ * version 4.
+ *
+ * The format of a version 2 precompiled kernel interface package is:
  *
  * the first 8 bytes are: "\aNVIDIA\a"
  *
@@ -85,6 +96,163 @@
  *   the next 4 bytes (unsigned) are: the 0-indexed sequence number of this file
  *
  *   the next 4 bytes are: "END."
+ *
+ *
+ * The format of a version 3 package is the same as version 2 up to and
+ * including the number of files (f).  It continues with a file table:
+ *
+ * for each of the f packaged files:
+ *
+ *   the first 4 bytes (unsigned) are the file type, as in version 2
+ *
+ *   the next 4 bytes are an attribute mask, as in version 2
+ *
+ *   the next 4 bytes (unsigned) are: length of the file name (n)
+ *
+ *   the next n bytes are the file name
+ *
+ *   the next 4 bytes (unsigned) are: length of the linked module name (m)
+ *
+ *   the next m bytes are the linked module name (for kernel interfaces only)
+ *
+ *   the next 4 bytes (unsigned) are: length of the core object file name (o)
+ *
+ *   the next o bytes are the core object file name (for kernel interfaces only)
+ *
+ *   the next 4 bytes (unsigned) are: length of the target directory name (t)
+ *
+ *   the next t bytes are the target directory name
+ *
+ *   the next 4 bytes (unsigned) are: CRC of the uncompressed file
+ *
+ *   the next 4 bytes (unsigned) are: size of the uncompressed file
+ *
+ *   the next 4 bytes (unsigned) are the compression method:
+ *     0: none; the payload is the file itself
+ *     1: the payload is a sequence of blocks, described below
+ *
+ *   the next 4 bytes (unsigned) are: size of the stored payload (l)
+ *
+ *   the next 8 bytes (unsigned) are: offset of the payload from the start
+ *   of the package, stored as the low 4 bytes followed by the high 4 bytes
+ *
+ *   the next 4 bytes (unsigned) are: CRC of linked module, when appropriate
+ *
+ *   the next 4 bytes (unsigned) are: length of detached signature (s)
+ *
+ *   the next (s) bytes are: detached signature
+ *
+ * the next 4 bytes (unsigned) are: CRC of the file table
+ *
+ * the rest of the package holds the f payloads, at the offsets given in the
+ * file table.  The file table and the payload offsets' high 4 bytes allow
+ * payloads to be stored past 4 GB, as long as the file table itself lies
+ * within the first 2 GB of the package.
+ *
+ * The format of a version 4 package (a bundle) is:
+ *
+ * the first 8 bytes are: "\aNVIDIA\a"
+ *
+ * the next 4 bytes (unsigned) are: version number of the package format
+ *
+ * the next 4 bytes (unsigned) are: the length of the version string (v)
+ *
+ * the next v bytes are the version string, shared by all kernels
+ *
+ * the next 4 bytes (unsigned) are: the length of the description (d)
+ *
+ * the next d bytes are the description of the bundle
+ *
+ * the next 4 bytes (unsigned) are: the length of the bundle metadata (m)
+ *
+ * the next m bytes are the bundle metadata:
+ *
+ *   the first 4 bytes (unsigned) are: the number of kernels (k)
+ *
+ *   the next k * PRECOMPILED_KERNEL_RECORD_LENGTH bytes are the kernel
+ *   table, sorted by proc version hash and then by proc version string;
+ *   for each kernel:
+ *
+ *     the first 4 bytes (unsigned) are: 32-bit FNV-1a hash of the kernel's
+ *     proc version string
+ *
+ *     the next 4 bytes (unsigned) are: offset of the proc version string
+ *
+ *     the next 4 bytes (unsigned) are: length of the proc version string
+ *
+ *     the next 4 bytes (unsigned) are: offset of the kernel's description
+ *
+ *     the next 4 bytes (unsigned) are: length of the kernel's description
+ *
+ *     the next 4 bytes (unsigned) are: offset of the kernel's first file
+ *     table entry
+ *
+ *     the next 4 bytes (unsigned) are: the number of the kernel's files
+ *
+ *   the kernels' proc version and description strings
+ *
+ *   the file table entries of each kernel, in the version 3 format
+ *
+ * the next 4 bytes (unsigned) are: CRC of the bundle metadata
+ *
+ * the rest of the package holds the payloads.  File table entries with the
+ * same payload, including entries of different kernels, share its offset.
+ * All offsets are from the start of the package; the metadata must lie
+ * within the first 2 GB of the package, but, as for version 3, payloads
+ * may be stored past 4 GB.
+ *
+ * A compressed payload is a sequence of blocks, each holding up to
+ * PRECOMPILED_BLOCK_SIZE bytes of the file:
+ *
+ *   the first 4 bytes (unsigned) are: size of the uncompressed block (u)
+ *
+ *   the next 4 bytes (unsigned) are: size of the stored block (c); if the
+ *   PRECOMPILED_BLOCK_UNCOMPRESSED bit is set, the block is stored
+ *   uncompressed and the remaining bits are equal to u
+ *
+ *   the next c bytes are the block, compressed in the LZ4 block format
+ *   unless stored uncompressed
+ *
+ *
+ * A directory of precompiled packages may contain an index file named
+ * PRECOMPILED_INDEX_FILENAME, which is maintained by `mkprecompiled --pack`
+ * and lets nvidia-installer find the packages matching the running kernel
+ * without opening every file in the directory.  The format of the index is:
+ *
+ * the first 8 bytes are: "\aNVINDX\a"
+ *
+ * the next 4 bytes (unsigned) are: version number of the index format
+ *
+ * the next 4 bytes (unsigned) are: the number of entries in the index (e)
+ *
+ * for each of the e files in the directory, other than the index itself:
+ *
+ *   the first 4 bytes are a flag mask:
+ *     1: the file is a valid precompiled package
+ *
+ *   the next 4 bytes (unsigned) are: the number of proc version hashes (h);
+ *   1 for packages, the number of kernels for bundles, 0 for other files
+ *
+ *   the next h * 4 bytes (unsigned) are: 32-bit FNV-1a hashes of the
+ *   package's proc version strings
+ *
+ *   the next 8 bytes (unsigned) are: the size of the file
+ *
+ *   the next 8 bytes (unsigned) are: the modification time of the file, in
+ *   nanoseconds since the epoch
+ *
+ *   the next 4 bytes (unsigned) are: length of the file name (n)
+ *
+ *   the next n bytes are the file name
+ *
+ *   the next 4 bytes (unsigned) are: length of the driver version string (v)
+ *
+ *   the next v bytes are the driver version string
+ *
+ * Like the package format, all integers are stored little-endian; 8 byte
+ * integers are stored as their low 4 bytes followed by their high 4 bytes.
+ * The index is only used if it lists every file in the directory, with an
+ * unchanged size and modification time.
  */
 
 #ifndef __NVIDIA_INSTALLER_PRECOMPILED_H__
@@ -99,7 +267,12 @@
 
 #define PRECOMPILED_PKG_HEADER "\aNVIDIA\a"
 
-#define PRECOMPILED_PKG_VERSION 2
+#define PRECOMPILED_PKG_VERSION_2 2
+#define PRECOMPILED_PKG_VERSION_3 3
+#define PRECOMPILED_PKG_VERSION_4 4
+
+/* the format version used for new packages */
+#define PRECOMPILED_PKG_VERSION PRECOMPILED_PKG_VERSION_3
 
 #define PRECOMPILED_FILE_CONSTANT_LENGTH (4 + /* precompiled file header */ \
                                           4 + /* file serial number */ \
@@ -120,11 +293,58 @@
 #define PRECOMPILED_FILE_HEADER "FILE"
 #define PRECOMPILED_FILE_FOOTER "END."
 
+#define PRECOMPILED_FILE_ENTRY_CONSTANT_LENGTH (4 + /* file type */ \
+                                                4 + /* attributes mask */ \
+                                                4 + /* file name length */ \
+                                                4 + /* linked module name length */ \
+                                                4 + /* core object name length */ \
+                                                4 + /* target dir name length */ \
+                                                4 + /* file crc */ \
+                                                4 + /* file size */ \
+                                                4 + /* compression method */ \
+                                                4 + /* stored size */ \
+                                                8 + /* payload offset */ \
+                                                4 + /* linked module crc */ \
+                                                4)  /* detached signature length */
+
+#define PRECOMPILED_KERNEL_RECORD_LENGTH (4 + /* proc version hash */ \
+                                          4 + /* proc version offset */ \
+                                          4 + /* proc version length */ \
+                                          4 + /* description offset */ \
+                                          4 + /* description length */ \
+                                          4 + /* file table entries offset */ \
+                                          4)  /* number of files */
+
+#define PRECOMPILED_BLOCK_SIZE 65536
+#define PRECOMPILED_BLOCK_UNCOMPRESSED 0x80000000
+
+#define PRECOMPILED_INDEX_FILENAME ".nvidia-precompiled-index"
+#define PRECOMPILED_INDEX_HEADER "\aNVINDX\a"
+#define PRECOMPILED_INDEX_VERSION 2
+
+#define PRECOMPILED_INDEX_CONSTANT_LENGTH (8 + /* index header */ \
+                                           4 + /* index format version */ \
+                                           4)  /* number of entries */
+
+#define PRECOMPILED_INDEX_ENTRY_CONSTANT_LENGTH (4 + /* flags */ \
+                                                 4 + /* number of hashes */ \
+                                                 8 + /* file size */ \
+                                                 8 + /* file mtime */ \
+                                                 4 + /* file name length */ \
+                                                 4)  /* version length */
+
+#define PRECOMPILED_INDEX_IS_PACKAGE 0x1
+
 enum {
     PRECOMPILED_FILE_TYPE_INTERFACE = 0,
     PRECOMPILED_FILE_TYPE_MODULE,
 };
 
+enum {
+    PRECOMPILED_COMPRESSION_NONE = 0,
+    PRECOMPILED_COMPRESSION_LZ4,
+};
+
 enum {
     PRECOMPILED_FILE_HAS_DETACHED_SIGNATURE = 0,
     PRECOMPILED_FILE_HAS_LINKED_MODULE_CRC,
@@ -142,20 +362,46 @@ typedef struct __precompiled_file_info {
     char *target_directory;
     uint32 crc;
     uint32 size;
-    uint8 *data;
+    uint8 *data;            /* the stored payload; see 'compression' */
+    int data_is_mapped;     /* data points into PrecompiledInfo.package_data */
+    uint32 compression;     /* PRECOMPILED_COMPRESSION_* */
+    uint32 stored_size;     /* size of the stored payload */
     uint32 linked_module_crc;
     uint32 signature_size;
     char *signature;
+    char *source_path;      /* file to read the data from when packing, if
+                             * data is NULL */
 } PrecompiledFileInfo;
 
+typedef struct __precompiled_kernel_info {
+    char *proc_version_string;
+    char *description;
+    int first_file;         /* index of the kernel's first file in 'files' */
+    int num_files;
+} PrecompiledKernelInfo;
+
+/*
+ * A PrecompiledInfo with num_kernels > 0 is a bundle: its files are those of
+ * all of its kernels, and its proc version string is empty.  Bundles are
+ * loaded as such by get_precompiled_info() when no proc version string is
+ * given; otherwise, only the files of the matching kernel are loaded, as
+ * for a single kernel package.
+ */
+
 typedef struct __precompiled_info {
 
-    uint32 package_size;
+    uint64_t package_size;
+    void *package_data;     /* mapping of the package file, if loaded */
+    uint32 format_version;  /* 0 for the default format version */
     char *version;
     char *proc_version_string;
     char *description;
     int num_files;
     PrecompiledFileInfo *files;
+    int num_kernels;
+    PrecompiledKernelInfo *kernels;
+    int num_sources;        /* packages added with precompiled_bundle_add() */
+    struct __precompiled_info **sources;
 
 } PrecompiledInfo;
 
@@ -184,15 +430,23 @@ int precompiled_read_interface(PrecompiledFileInfo *fileInfo,
                                const char *filename,
                                const char *linked_module_name,
                                const char *core_object_name,
-                               const char *target_directory);
+                               const char *target_directory, int load_data);
 int precompiled_read_module(PrecompiledFileInfo *fileInfo, const char *filename,
-                            const char *target_directory);
+                            const char *target_directory, int load_data);
 void precompiled_append_files(PrecompiledInfo *info, PrecompiledFileInfo *files,
                               int num_files);
+void precompiled_bundle_add(PrecompiledInfo *bundle, PrecompiledInfo *info);
 
 const char *precompiled_file_type_name(uint32 file_type);
+const char *precompiled_compression_name(uint32 compression);
 const char **precompiled_file_attribute_names(uint32 attribute_mask);
 
 int byte_tail(const char *infile, int start, char **buf);
 
+int precompiled_update_index(Options *op, const char *directory);
+char **precompiled_index_lookup(Options *op, const char *directory,
+                                const char *proc_version_string,
+                                const char *package_version);
+void precompiled_free_index_lookup(char **candidates);
+
 #endif /* __NVIDIA_INSTALLER_PRECOMPILED_H__ */
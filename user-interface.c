@@ -33,6 +33,7 @@
 #include <dlfcn.h>
 #include <errno.h>
 #include <signal.h>
+#include <pthread.h>
 #include "nvidia-installer.h"
 #include "nvidia-installer-ui.h"
 #include "misc.h"
@@ -51,6 +52,14 @@ InstallerUI *__ui = NULL;
 
 char *__extracted_user_interface_filename = NULL;
 
+/*
+ * lock serializing message output; file operations executed by the
+ * install worker threads (see execute_command_list()) may report
+ * errors concurrently with the main thread
+ */
+
+static pthread_mutex_t ui_message_lock = PTHREAD_MUTEX_INITIALIZER;
+
 /* pull in the default stream_ui dispatch table from stream_ui.c */
 
 extern InstallerUI stream_ui_dispatch_table;
@@ -258,8 +267,10 @@ void ui_error(Options *op, const char *fmt, ...)
     
     NV_VSNPRINTF(msg, fmt);
 
+    pthread_mutex_lock(&ui_message_lock);
     __ui->message(op, NV_MSG_LEVEL_ERROR, msg);
     log_printf(op, "ERROR: ", "%s", msg);
+    pthread_mutex_unlock(&ui_message_lock);
     
     free(msg);
 
@@ -273,8 +284,10 @@ void ui_warn(Options *op, const char *fmt, ...)
 
     NV_VSNPRINTF(msg, fmt);
 
+    pthread_mutex_lock(&ui_message_lock);
     __ui->message(op, NV_MSG_LEVEL_WARNING, msg);
     log_printf(op, "WARNING: ", "%s", msg);
+    pthread_mutex_unlock(&ui_message_lock);
  
     free(msg);
     
@@ -303,8 +316,10 @@ void ui_log(Options *op, const char *fmt, ...)
 
     NV_VSNPRINTF(msg, fmt);
 
+    pthread_mutex_lock(&ui_message_lock);
     if (!op->silent) __ui->message(op, NV_MSG_LEVEL_LOG, msg);
     log_printf(op, NV_BULLET_STR, "%s", msg);
+    pthread_mutex_unlock(&ui_message_lock);
 
     free(msg);
 
@@ -324,8 +339,10 @@ void ui_expert(Options *op, const char *fmt, ...)
 
     NV_VSNPRINTF(msg, fmt);
 
+    pthread_mutex_lock(&ui_message_lock);
     if (!op->silent) __ui->message(op, NV_MSG_LEVEL_LOG, msg);
     log_printf(op, NV_BULLET_STR, "%s", msg);
+    pthread_mutex_unlock(&ui_message_lock);
 
     free (msg);
     